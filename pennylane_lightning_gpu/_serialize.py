@@ -49,8 +49,12 @@ try:
         SparseHamiltonianGPU_C128,
         HermitianObsGPU_C64,
         HermitianObsGPU_C128,
+        op_stream_gate_names,
     )
 
+    # Op codes of the flat op streams, mapped from the names once.
+    _OP_CODES = {name: code for code, name in enumerate(op_stream_gate_names())}
+
     try:
         from .lightning_gpu_qubit_ops import (
             LightningGPUMPI_C128,
@@ -100,12 +104,14 @@ def _tensor_ob_dtype(use_csingle, use_mpi: bool):
 def _hermitian_ob_dtype(use_csingle, use_mpi: bool):
     if not use_mpi:
         return (
-            [HermitianObsGPU_C64, np.float32] if use_csingle else [HermitianObsGPU_C128, np.float64]
+            [HermitianObsGPU_C64, np.complex64]
+            if use_csingle
+            else [HermitianObsGPU_C128, np.complex128]
         )
     return (
-        [HermitianObsGPUMPI_C64, np.float32]
+        [HermitianObsGPUMPI_C64, np.complex64]
         if use_csingle
-        else [HermitianObsGPUMPI_C128, np.float64]
+        else [HermitianObsGPUMPI_C128, np.complex128]
     )
 
 
@@ -193,10 +199,10 @@ def _serialize_sparsehamiltonian(ob, wires_map: dict, use_csingle: bool, use_mpi
 
 
 def _serialize_hermitian(ob, wires_map: dict, use_csingle: bool, use_mpi: bool):
-    hermitian_obs, rtype = _hermitian_ob_dtype(use_csingle, use_mpi)
+    hermitian_obs, ctype = _hermitian_ob_dtype(use_csingle, use_mpi)
 
-    data = qml.matrix(ob).astype(rtype).ravel(order="C")
-    return hermitian_obs(data, ob.wires.tolist())
+    data = qml.matrix(ob).astype(ctype).ravel(order="C")
+    return hermitian_obs(data, [wires_map[w] for w in ob.wires])
 
 
 def _serialize_pauli_word(ob, wires_map: dict, use_csingle: bool, use_mpi: bool):
@@ -227,6 +233,19 @@ def _serialize_pauli_sentence(
     return hamiltonian_obs(coeffs, terms)
 
 
+def _is_serializable_ob(ob) -> bool:
+    """Whether :func:`_serialize_ob` supports an observable, checked before serializing it."""
+    if isinstance(ob, Tensor):
+        return all(_is_serializable_ob(o) for o in ob.obs)
+    if ob.name == "Hamiltonian":
+        return all(_is_serializable_ob(o) for o in ob.ops)
+    if ob.name == "SparseHamiltonian":
+        return True
+    if isinstance(ob, (PauliX, PauliY, PauliZ, Identity, Hadamard)):
+        return True
+    return ob._pauli_rep is not None
+
+
 def _serialize_ob(ob, wires_map, use_csingle, use_mpi: bool = False, use_splitting: bool = True):
     if isinstance(ob, Tensor):
         return _serialize_tensor_ob(ob, wires_map, use_csingle, use_mpi)
@@ -334,3 +353,93 @@ def _serialize_ops(
             inverses.append(is_inverse)
 
     return (names, params, wires, inverses, mats), uses_stateprep
+
+
+def _serialize_ops_flat(
+    tape: QuantumTape, wires_map: dict, use_csingle: bool = False, use_mpi: bool = False
+) -> Tuple[tuple, bool]:
+    """Serializes the operations of an input tape into flat arrays.
+
+    This is the struct-of-arrays counterpart of ``_serialize_ops``. Names are mapped to integer op
+    codes, and the wires, parameters and matrices of all operations are concatenated into one
+    buffer each, where ``wire_offsets[k]:wire_offsets[k + 1]`` indexes the wires of operation
+    ``k``, and likewise for the parameters and matrices. The buffers are read in place by the
+    bindings instead of being converted element by element.
+
+    The state preparation operations are not included.
+
+    Args:
+        tape (QuantumTape): the input quantum tape
+        wires_map (dict): a dictionary mapping input wires to the device's backend wires
+        use_csingle (bool): whether to use np.complex64 instead of np.complex128
+        use_mpi (bool): whether MPI is used or not
+
+    Returns:
+        Tuple[tuple, bool]: A serialization of the operations, containing the names of the
+        operations without a fixed op code, the op codes, the wire offsets and wires, the
+        parameter offsets and parameters, the inverses, and the matrix offsets and matrices.
+        The second element indicates whether the tape uses state preparation.
+    """
+    rtype = np.float32 if use_csingle else np.float64
+    ctype = np.complex64 if use_csingle else np.complex128
+
+    extra_codes = {}
+    codes = []
+    wires = []
+    wire_offsets = [0]
+    params = []
+    param_offsets = [0]
+    inverses = []
+    mats = []
+    mat_offsets = [0]
+
+    uses_stateprep = False
+
+    sv_py = _sv_py_dtype(use_csingle, use_mpi)
+
+    for o in tape.operations:
+        if isinstance(o, (BasisState, StatePrep)):
+            uses_stateprep = True
+            continue
+        elif isinstance(o, Rot):
+            op_list = o.expand().operations
+        else:
+            op_list = [o]
+
+        for single_op in op_list:
+            is_inverse = isinstance(single_op, Adjoint)
+
+            name = single_op.name if not is_inverse else single_op.base.name
+            code = _OP_CODES.get(name)
+            if code is None:
+                code = extra_codes.setdefault(name, len(_OP_CODES) + len(extra_codes))
+            codes.append(code)
+
+            if getattr(sv_py, name, None) is None:
+                mat = np.ravel(qml.matrix(single_op))
+                mats.append(mat)
+                mat_offsets.append(mat_offsets[-1] + mat.size)
+
+                if is_inverse:
+                    is_inverse = False
+            else:
+                params.extend(single_op.parameters)
+                mat_offsets.append(mat_offsets[-1])
+            param_offsets.append(len(params))
+
+            wires.extend(wires_map[w] for w in single_op.wires.tolist())
+            wire_offsets.append(len(wires))
+            inverses.append(is_inverse)
+
+    ops = (
+        list(extra_codes),
+        np.array(codes, dtype=np.int64),
+        np.array(wire_offsets, dtype=np.int64),
+        np.array(wires, dtype=np.int64),
+        np.array(param_offsets, dtype=np.int64),
+        np.array(params, dtype=rtype),
+        np.array(inverses, dtype=np.bool_),
+        np.array(mat_offsets, dtype=np.int64),
+        np.concatenate(mats).astype(ctype) if mats else np.zeros(0, dtype=ctype),
+    )
+    return ops, uses_stateprep
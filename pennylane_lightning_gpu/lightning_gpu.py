@@ -93,7 +93,13 @@ try:
     except:
         MPI_SUPPORT = False
 
-    from ._serialize import _serialize_ob, _serialize_observables, _serialize_ops
+    from ._serialize import (
+        _is_serializable_ob,
+        _serialize_hermitian,
+        _serialize_ob,
+        _serialize_observables,
+        _serialize_ops_flat,
+    )
     from ctypes.util import find_library
     from importlib import util as imp_util
 
@@ -635,41 +641,25 @@ if CPP_BINARY_AVAILABLE:
                         'the "adjoint" differentiation method'
                     )
 
-        def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False, **kwargs):
-            if self.shots is not None:
-                warn(
-                    "Requested adjoint differentiation to be computed with finite shots."
-                    " The derivative is always exact when using the adjoint differentiation method.",
-                    UserWarning,
-                )
-
-            tape_return_type = self._check_adjdiff_supported_measurements(tape.measurements)
+        def _process_jacobian_tape(self, tape):
+            """Serialize the observables and operations of a tape for the adjoint method.
 
-            if len(tape.trainable_params) == 0:
-                return np.array(0)
-
-            # Check adjoint diff support
-            self._check_adjdiff_supported_operations(tape.operations)
-
-            # Initialization of state
-            if starting_state is not None:
-                ket = np.ravel(starting_state, order="C")
-            else:
-                if not use_device_state:
-                    self.reset()
-                    self.execute(tape)
+            Returns:
+                tuple: the adjoint method object, the serialized observables and their
+                offsets per measurement, the serialized operations, the trainable
+                parameters passed to the backend, their positions among all trainable
+                parameters, and the number of trainable parameters
+            """
             adj = _adj_dtype(self.use_csingle, self._mpi)()
-            if self.use_csingle:
-                ket = ket.astype(np.complex64)
 
             obs_serialized, obs_offsets = _serialize_observables(
                 tape, self.wire_map, use_csingle=self.use_csingle, use_mpi=self._mpi
             )
 
-            ops_serialized, use_sp = _serialize_ops(
+            ops_serialized, use_sp = _serialize_ops_flat(
                 tape, self.wire_map, use_csingle=self.use_csingle, use_mpi=self._mpi
             )
-            ops_serialized = adj.create_ops_list(*ops_serialized)
+            ops_serialized = adj.create_ops_list_flat(*ops_serialized)
 
             trainable_params = sorted(tape.trainable_params)
 
@@ -692,6 +682,52 @@ if CPP_BINARY_AVAILABLE:
                 # whether there must be only one state preparation...
                 tp_shift = [i - 1 for i in tp_shift]
 
+            return (
+                adj,
+                obs_serialized,
+                obs_offsets,
+                ops_serialized,
+                tp_shift,
+                record_tp_rows,
+                all_params,
+            )
+
+        def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False, **kwargs):
+            if self.shots is not None:
+                warn(
+                    "Requested adjoint differentiation to be computed with finite shots."
+                    " The derivative is always exact when using the adjoint differentiation method.",
+                    UserWarning,
+                )
+
+            tape_return_type = self._check_adjdiff_supported_measurements(tape.measurements)
+
+            if len(tape.trainable_params) == 0:
+                return np.array(0)
+
+            # Check adjoint diff support
+            self._check_adjdiff_supported_operations(tape.operations)
+
+            # Initialization of state
+            if starting_state is not None:
+                ket = np.ravel(starting_state, order="C")
+            else:
+                if not use_device_state:
+                    self.reset()
+                    self.execute(tape)
+            if self.use_csingle:
+                ket = ket.astype(np.complex64)
+
+            (
+                adj,
+                obs_serialized,
+                obs_offsets,
+                ops_serialized,
+                tp_shift,
+                _,
+                all_params,
+            ) = self._process_jacobian_tape(tape)
+
             """
             This path enables controlled batching over the requested observables, be they explicit, or part of a Hamiltonian.
             The traditional path will assume there exists enough free memory to preallocate all arrays and run through each observable iteratively.
@@ -793,6 +829,15 @@ if CPP_BINARY_AVAILABLE:
                         "The vjp method only works with a real-valued dy when the tape is returning an expectation value"
                     )
 
+                if not self._mpi:
+
+                    def processing_fn(tape):
+                        return self._vector_jacobian_product(
+                            tape, dy, starting_state, use_device_state
+                        )
+
+                    return processing_fn
+
                 ham = qml.Hamiltonian(dy, [m.obs for m in measurements])
 
                 def processing_fn(tape):
@@ -809,6 +854,42 @@ if CPP_BINARY_AVAILABLE:
 
                 return processing_fn
 
+        def _vector_jacobian_product(self, tape, dy, starting_state=None, use_device_state=False):
+            """Contract the Jacobian of an expectation-value tape with ``dy`` in a single
+            adjoint sweep, through the ``vector_jacobian_product`` binding."""
+            if len(tape.trainable_params) == 0:
+                return np.array([], dtype=self.C_DTYPE)
+
+            self._check_adjdiff_supported_operations(tape.operations)
+
+            if starting_state is None and not use_device_state:
+                self.reset()
+                self.execute(tape)
+
+            (
+                adj,
+                obs_serialized,
+                obs_offsets,
+                ops_serialized,
+                tp_shift,
+                record_tp_rows,
+                all_params,
+            ) = self._process_jacobian_tape(tape)
+
+            # Every serialized term of a measurement shares its cotangent
+            dy = np.asarray(math.unwrap(dy), dtype=np.float64).ravel()
+            dy_serialized = np.repeat(dy, np.diff(obs_offsets)).tolist()
+
+            vjp = adj.vector_jacobian_product(
+                self._gpu_state, dy_serialized, obs_serialized, ops_serialized, tp_shift
+            )
+            jac_r = np.zeros((1, all_params))
+            jac_r[0, record_tp_rows] = vjp
+
+            if hasattr(qml, "active_return"):
+                return self._adjoint_jacobian_processing(jac_r) if qml.active_return() else jac_r
+            return self._adjoint_jacobian_processing(jac_r)
+
         def sample(self, observable, shot_range=None, bin_size=None, counts=False):
             if observable.name != "PauliZ":
                 self.apply_cq(observable.diagonalizing_gates())
@@ -817,6 +898,19 @@ if CPP_BINARY_AVAILABLE:
                 observable, shot_range=shot_range, bin_size=bin_size, counts=counts
             )
 
+        def _pauli_words(self, observable):
+            """Pauli words and device wires of the terms of a Hamiltonian, or ``None`` if a
+            term is not a Pauli word."""
+            pauli_words = []
+            word_wires = []
+            for word in observable.ops:
+                names = word.name if isinstance(word.name, list) else [word.name]
+                if not all(name in _name_map for name in names):
+                    return None
+                pauli_words.append("".join(_name_map[name] for name in names))
+                word_wires.append(self.map_wires(word.wires).tolist())
+            return pauli_words, word_wires
+
         def expval(self, observable, shot_range=None, bin_size=None):
             if observable.name in [
                 "Projector",
@@ -854,31 +948,16 @@ if CPP_BINARY_AVAILABLE:
                     )
 
             if observable.name in ["Hamiltonian"]:
+                words = self._pauli_words(observable)
+                if words is not None:
+                    # Matrix-free: grouped, or as one compiled Pauli sentence
+                    return self._gpu_state.ExpectationValue(*words, observable.coeffs)
                 device_wires = self.map_wires(observable.wires)
                 if not self._mpi and len(device_wires) < 14:
                     return self._gpu_state.ExpectationValue(
                         device_wires, qml.matrix(observable).ravel(order="C")
                     )
-                else:
-                    coeffs = observable.coeffs
-                    pauli_words = []
-                    word_wires = []
-                    for word in observable.ops:
-                        compressed_word = []
-                        if isinstance(word.name, list):
-                            for char in word.name:
-                                if char in _name_map:
-                                    compressed_word.append(_name_map[char])
-                                else:
-                                    raise ValueError("Pauli word only for Hamiltionian expval.")
-                        else:
-                            if word.name in _name_map:
-                                compressed_word.append(_name_map[word.name])
-                            else:
-                                raise ValueError("Pauli word only for Hamiltionian expval.")
-                        word_wires.append(word.wires.tolist())
-                        pauli_words.append("".join(compressed_word))
-                    return self._gpu_state.ExpectationValue(pauli_words, word_wires, coeffs)
+                raise ValueError("Pauli word only for Hamiltionian expval.")
 
             par = (
                 observable.parameters
@@ -940,6 +1019,23 @@ if CPP_BINARY_AVAILABLE:
                 samples = self.sample(observable, shot_range=shot_range, bin_size=bin_size)
                 return np.squeeze(np.var(samples, axis=0))
 
+            ob_serialized = None
+            if observable.name == "Hermitian":
+                ob_serialized = _serialize_hermitian(
+                    observable, self.wire_map, self.use_csingle, self._mpi
+                )
+            elif observable.name != "Projector" and _is_serializable_ob(observable):
+                ob_serialized = _serialize_ob(
+                    observable,
+                    self.wire_map,
+                    self.use_csingle,
+                    self._mpi,
+                    use_splitting=False,
+                )
+            if ob_serialized is not None:
+                # Both moments from a single reduction, or a single application of the observable
+                return self._gpu_state.Variance(ob_serialized)
+
             adjoint_matrix = math.T(math.conj(qml.matrix(observable)))
             sqr_matrix = np.matmul(adjoint_matrix, qml.matrix(observable))
 
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <future>
+#include <memory>
 #include <omp.h>
 #include <thread>
 #include <variant>
@@ -114,51 +116,50 @@ template <class T = double> class AdjointJacobianGPU {
         {"MultiRZ", -static_cast<T>(0.5)}};
 
     /**
-     * @brief Utility method to update the Jacobian at a given index by
-     * calculating the overlap between two given states.
+     * @brief Utility method to queue the overlaps between the given states
+     * for one Jacobian column.
      *
-     * @param sv1s vector of statevector <sv1| (one for each observable). Data
-     * will be conjugated.
-     * @param sv2 Statevector |sv2>
-     * @param jac Jacobian receiving the values.
-     * @param scaling_coeff Generator coefficient for given gate derivative.
-     * @param num_observables the number of observables of Jacobian to update.
+     * Each overlap is computed on the stream of its observable state once
+     * `sv2` is ready, and written to the device-resident Jacobian buffer.
+     * Nothing is copied back to the host here.
+     *
+     * @param sv1s vector of statevector <sv1| (one for each observable), with
+     * the qubit map applied. Data will be conjugated.
+     * @param sv2 Statevector |sv2>, with the qubit map applied. `sv2_ready` is
+     * recorded here, after any swap kernels queued by `applyQubitMap()`.
+     * @param device_jac Device buffer of `num_observables * tp_size` elements
+     * receiving the overlaps in row-major order.
+     * @param tp_size Number of trainable parameters.
      * @param param_index Parameter index position of Jacobian to update.
-     * @param device_buffer_jac_single_param a workspace buffer on the device of
-     * size num_observables elements. Data will be ignored and overwritten.
-     * @param host_buffer_jac_single_param a workspace buffer on the host of
-     * size num_observables elements. Data will be ignored and overwritten.
+     * @param sv2_ready Event recorded on the stream of `sv2`.
+     * @param obs_done Events recorded on the stream of each observable state
+     * after its overlap has been queued.
      */
     inline void
     updateJacobian(const std::vector<StateVectorCudaManaged<T>> &sv1s,
                    const StateVectorCudaManaged<T> &sv2,
-                   std::vector<std::vector<T>> &jac, T scaling_coeff,
-                   size_t num_observables, size_t param_index,
-                   DataBuffer<CFP_t, int> &device_buffer_jac_single_param,
-                   std::vector<CFP_t> &host_buffer_jac_single_param) {
-        host_buffer_jac_single_param.clear();
-        for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+                   DataBuffer<CFP_t, int> &device_jac, size_t tp_size,
+                   size_t param_index, cudaEvent_t sv2_ready,
+                   const std::vector<cuUtil::SharedCudaEvent> &obs_done) {
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(
+            sv2_ready, sv2.getDataBuffer().getDevTag().getStreamID()));
+        for (size_t obs_idx = 0; obs_idx < sv1s.size(); obs_idx++) {
             const StateVectorCudaManaged<T> &sv1 = sv1s[obs_idx];
             PL_ABORT_IF_NOT(sv1.getDataBuffer().getDevTag().getDeviceID() ==
                                 sv2.getDataBuffer().getDevTag().getDeviceID(),
                             "Data exists on different GPUs. Aborting.");
+            const auto stream_id =
+                sv1.getDataBuffer().getDevTag().getStreamID();
+            PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(stream_id, sv2_ready, 0));
             innerProdC_CUDA_device(
                 sv1.getData(), sv2.getData(), sv1.getLength(),
-                sv1.getDataBuffer().getDevTag().getDeviceID(),
-                sv1.getDataBuffer().getDevTag().getStreamID(),
+                sv1.getDataBuffer().getDevTag().getDeviceID(), stream_id,
                 sv1.getCublasCaller(),
-                device_buffer_jac_single_param.getData() + obs_idx);
-        }
-        host_buffer_jac_single_param.resize(num_observables);
-        device_buffer_jac_single_param.CopyGpuDataToHost(
-            host_buffer_jac_single_param.data(),
-            host_buffer_jac_single_param.size(), false);
-        for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
-            jac[obs_idx][param_index] =
-                -2 * scaling_coeff * host_buffer_jac_single_param[obs_idx].y;
+                device_jac.getData() +
+                    getJacIndex(obs_idx, param_index, tp_size));
+            PL_CUDA_IS_SUCCESS(
+                cudaEventRecord(obs_done[obs_idx].get(), stream_id));
         }
-
-        host_buffer_jac_single_param.clear();
     }
 
     /**
@@ -219,16 +220,23 @@ template <class T = double> class AdjointJacobianGPU {
 
     /**
      * @brief OpenMP accelerated application of observables to given
-     * statevectors
+     * statevectors. The reference state is copied asynchronously on the
+     * stream of each target statevector, so the caller must ensure those
+     * streams are ordered after any pending work on `reference_state`. The
+     * qubit map of `reference_state` must have been applied beforehand, so
+     * that the threads only read it.
      *
      * @param states Vector of statevector copies, one per observable.
-     * @param reference_state Reference statevector
+     * @param reference_state Reference statevector, in logical qubit order.
      * @param observables Vector of observables to apply to each statevector.
      */
     inline void applyObservables(
         std::vector<StateVectorCudaManaged<T>> &states,
         const StateVectorCudaManaged<T> &reference_state,
         const std::vector<std::shared_ptr<ObservableGPU<T>>> &observables) {
+        PL_ABORT_IF_NOT(reference_state.getQubitMap().isIdentity(),
+                        "Apply the qubit map before copying the reference "
+                        "state");
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
@@ -243,7 +251,7 @@ template <class T = double> class AdjointJacobianGPU {
         #endif
             for (size_t h_i = 0; h_i < num_observables; h_i++) {
                 try {
-                    states[h_i].updateData(reference_state);
+                    states[h_i].updateData(reference_state, true);
                     applyObservable(states[h_i], *observables[h_i]);
                 } catch (...) {
                     #if defined(_OPENMP)
@@ -349,9 +357,87 @@ template <class T = double> class AdjointJacobianGPU {
         return scaling_factors.at(op_name);
     }
 
+    /**
+     * @brief Number of operations a backward sweep applies to lambda before
+     * all trainable parameters have been visited.
+     *
+     * @param ops Operations used to create the state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @return size_t
+     */
+    static auto countSweepOps(
+        const Pennylane::Algorithms::OpsData<StateVectorCudaManaged<T>> &ops,
+        const std::vector<size_t> &trainableParams) -> size_t {
+        const std::vector<std::string> &ops_name = ops.getOpsName();
+        size_t current_param_idx = ops.getNumParOps() - 1;
+        auto tp_it = trainableParams.rbegin();
+        size_t num_swept = 0;
+        for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
+             op_idx--) {
+            if ((ops_name[op_idx] == "QubitStateVector") ||
+                (ops_name[op_idx] == "StatePrep") ||
+                (ops_name[op_idx] == "BasisState")) {
+                continue;
+            }
+            if (tp_it == trainableParams.rend()) {
+                break;
+            }
+            num_swept++;
+            if (ops.hasParams(op_idx)) {
+                if (current_param_idx == *tp_it) {
+                    ++tp_it;
+                }
+                current_param_idx--;
+            }
+        }
+        return num_swept;
+    }
+
+    /**
+     * @brief Fold observables into the single observable
+     * \f$\sum_i w_i O_i\f$. Terms with a zero weight are dropped.
+     *
+     * @param obs Observables to fold.
+     * @param weights Weight of each observable.
+     * @return std::shared_ptr<ObservableGPU<T>>
+     */
+    static auto
+    foldObservables(const std::vector<std::shared_ptr<ObservableGPU<T>>> &obs,
+                    const std::vector<T> &weights)
+        -> std::shared_ptr<ObservableGPU<T>> {
+        PL_ABORT_IF_NOT(weights.size() == obs.size(),
+                        "The number of weights must match the number of "
+                        "observables.");
+        std::vector<T> coeffs;
+        std::vector<std::shared_ptr<ObservableGPU<T>>> terms;
+        for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+            if (weights[obs_idx] != T{0}) {
+                coeffs.push_back(weights[obs_idx]);
+                terms.push_back(obs[obs_idx]);
+            }
+        }
+        return std::make_shared<HamiltonianGPU<T>>(std::move(coeffs),
+                                                   std::move(terms));
+    }
+
   public:
     AdjointJacobianGPU() = default;
 
+    /**
+     * @brief Statistics of a memory-bounded adjoint calculation.
+     */
+    struct AdjointSweepStats {
+        /// Number of backward sweeps over the operations.
+        size_t num_sweeps{0};
+        /// Number of state vectors checkpointed to restart the sweeps.
+        size_t num_checkpoints{0};
+        /// Upper bound on the number of state vectors resident at once.
+        size_t max_resident_states{0};
+        /// Operations re-applied to lambda after the first sweep.
+        size_t num_recomputed_ops{0};
+    };
+
     /**
      * @brief Utility to create a given operations object.
      *
@@ -373,10 +459,33 @@ template <class T = double> class AdjointJacobianGPU {
         return {ops_name, ops_params, ops_wires, ops_inverses, ops_matrices};
     }
 
+    /**
+     * @brief Utility to create a given operations object from a flat op
+     * stream, in a single pass over its buffers.
+     *
+     * @param ops Operations, read in place.
+     * @return const Pennylane::Algorithms::OpsData<StateVectorCudaManaged<T>>
+     */
+    auto createOpsData(const cuUtil::OpStream<T> &ops)
+        -> Pennylane::Algorithms::OpsData<StateVectorCudaManaged<T>> {
+        const auto num_ops = ops.getNumOps();
+        std::vector<std::string> ops_name(num_ops);
+        std::vector<std::vector<T>> ops_params(num_ops);
+        std::vector<std::vector<size_t>> ops_wires(num_ops);
+        std::vector<bool> ops_inverses(num_ops);
+        std::vector<std::vector<std::complex<T>>> ops_matrices(num_ops);
+        for (size_t op = 0; op < num_ops; op++) {
+            ops_name[op] = ops.getName(op);
+            ops_params[op] = ops.getParams(op);
+            ops_wires[op] = ops.getWires(op);
+            ops_inverses[op] = ops.getInverse(op);
+            ops_matrices[op] = ops.getMatrix(op);
+        }
+        return {ops_name, ops_params, ops_wires, ops_inverses, ops_matrices};
+    }
+
     /**
      * @brief Batches the adjoint_jacobian method over the available GPUs.
-     * Explicitly forbids OMP_NUM_THREADS>1 to avoid issues with std::thread
-     * contention and state access issues.
      *
      * @param ref_data Pointer to the statevector data.
      * @param length Length of the statevector data.
@@ -424,10 +533,6 @@ template <class T = double> class AdjointJacobianGPU {
             auto adj_lambda =
                 [&](std::promise<std::vector<std::vector<T>>> j_promise,
                     std::size_t offset_first, std::size_t offset_last) {
-                    // Ensure No OpenMP threads spawned;
-                    // to be resolved with streams in future releases
-                    omp_set_num_threads(1);
-
                     // Grab a GPU index, and set a device tag
                     const auto id = dp.acquireDevice();
                     DevTag<int> dt_local(id, 0);
@@ -521,41 +626,76 @@ template <class T = double> class AdjointJacobianGPU {
 
         DevTag<int> dt_local(std::move(dev_tag));
         dt_local.refresh();
+        const auto device_id = dt_local.getDeviceID();
+
+        // lambda and mu run on the given stream, or on a dedicated one when
+        // none is provided, so that they never serialize with the
+        // observable streams through the legacy default stream.
+        cuUtil::SharedCudaStream main_stream;
+        if (dt_local.getStreamID() == nullptr) {
+            main_stream = cuUtil::make_shared_cuda_stream();
+        }
+        const DevTag<int> dt_main =
+            main_stream ? DevTag<int>{device_id, main_stream.get()} : dt_local;
+        const auto stream_id = dt_main.getStreamID();
+
         // Create $U_{1:p}\vert \lambda \rangle$
-        SharedCusvHandle cusvhandle = make_shared_cusv_handle();
+        SharedCusvHandle cusvhandle = make_shared_cusv_handle(stream_id);
         SharedCublasCaller cublascaller = make_shared_cublas_caller();
         SharedCusparseHandle cusparsehandle = make_shared_cusparse_handle();
-        StateVectorCudaManaged<T> lambda(ref_data, length, dt_local, cusvhandle,
+        StateVectorCudaManaged<T> lambda(ref_data, length, dt_main, cusvhandle,
                                          cublascaller, cusparsehandle);
 
         // Apply given operations to statevector if requested
         if (apply_operations) {
             applyOperations(lambda, ops);
         }
-
-        // Create observable-applied state-vectors
+        // Restore the logical layout once, before lambda is shared by the
+        // observable copies.
+        lambda.applyQubitMap();
+
+        // Create observable-applied state-vectors. Each one owns a stream and
+        // the handles bound to it, so that the observables are applied,
+        // adjointed and contracted concurrently.
+        std::vector<cuUtil::SharedCudaStream> obs_streams;
+        std::vector<cuUtil::SharedCudaEvent> obs_done;
         std::vector<StateVectorCudaManaged<T>> H_lambda;
+        obs_streams.reserve(num_observables);
+        obs_done.reserve(num_observables);
+        H_lambda.reserve(num_observables);
+        const auto lambda_ready = cuUtil::make_shared_cuda_event();
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(lambda_ready.get(), stream_id));
         for (size_t n = 0; n < num_observables; n++) {
-            H_lambda.emplace_back(lambda.getNumQubits(), dt_local, true,
-                                  cusvhandle, cublascaller, cusparsehandle);
+            obs_streams.emplace_back(cuUtil::make_shared_cuda_stream());
+            obs_done.emplace_back(cuUtil::make_shared_cuda_event());
+            cudaStream_t obs_stream = obs_streams.back().get();
+            PL_CUDA_IS_SUCCESS(
+                cudaStreamWaitEvent(obs_stream, lambda_ready.get(), 0));
+            H_lambda.emplace_back(lambda.getNumQubits(),
+                                  DevTag<int>{device_id, obs_stream}, true,
+                                  make_shared_cusv_handle(obs_stream),
+                                  make_shared_cublas_caller(), nullptr);
         }
         applyObservables(H_lambda, lambda, obs);
+        // The copies of lambda into H_lambda run on the observable streams:
+        // lambda must not be updated before they have completed.
+        for (size_t n = 0; n < num_observables; n++) {
+            PL_CUDA_IS_SUCCESS(
+                cudaEventRecord(obs_done[n].get(), obs_streams[n].get()));
+            PL_CUDA_IS_SUCCESS(
+                cudaStreamWaitEvent(stream_id, obs_done[n].get(), 0));
+        }
 
-        StateVectorCudaManaged<T> mu(lambda.getNumQubits(), dt_local, true,
+        StateVectorCudaManaged<T> mu(lambda.getNumQubits(), dt_main, true,
                                      cusvhandle, cublascaller, cusparsehandle);
 
-        auto device_id = mu.getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = mu.getDataBuffer().getDevTag().getStreamID();
-
-        // The following buffers are only used as temporary workspace
-        // inside updateJacobian and do not carry any state beyond a
-        // single updateJacobian function call.
-        // We create the buffers here instead of inside updateJacobian
-        // to avoid expensive reallocations.
-        DataBuffer<CFP_t, int> device_buffer_jac_single_param{
-            static_cast<std::size_t>(num_observables), device_id, stream_id,
-            true};
-        std::vector<CFP_t> host_buffer_jac_single_param;
+        // Overlaps stay on the device until the end of the sweep; only the
+        // generator scaling factors are kept on the host.
+        DataBuffer<CFP_t, int> device_jac{num_observables * tp_size,
+                                          device_id, stream_id, true};
+        std::vector<T> scaling_factors_tp(tp_size, 0);
+        size_t num_updated = 0;
+        const auto mu_ready = cuUtil::make_shared_cuda_event();
 
         for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
              op_idx--) {
@@ -570,22 +710,34 @@ template <class T = double> class AdjointJacobianGPU {
             if (tp_it == tp_rend) {
                 break; // All done
             }
-            mu.updateData(lambda);
+            // mu must not be overwritten while it is still being read by the
+            // overlaps of the previous trainable parameter
+            if (num_updated > 0) {
+                for (const auto &event : obs_done) {
+                    PL_CUDA_IS_SUCCESS(
+                        cudaStreamWaitEvent(stream_id, event.get(), 0));
+                }
+            }
+            mu.updateData(lambda, true);
             applyOperationAdj(lambda, ops, op_idx);
 
             if (ops.hasParams(op_idx)) {
                 if (current_param_idx == *tp_it) {
-                    const T scalingFactor =
+                    scaling_factors_tp[trainableParamNumber] =
                         applyGenerator(mu, ops.getOpsName()[op_idx],
                                        ops.getOpsWires()[op_idx],
                                        !ops.getOpsInverses()[op_idx]) *
                         (ops.getOpsInverses()[op_idx] ? -1 : 1);
 
-                    updateJacobian(H_lambda, mu, jac, scalingFactor,
-                                   num_observables, trainableParamNumber,
-                                   device_buffer_jac_single_param,
-                                   host_buffer_jac_single_param);
+                    mu.applyQubitMap();
+                    for (auto &h_lambda : H_lambda) {
+                        h_lambda.applyQubitMap();
+                    }
+                    updateJacobian(H_lambda, mu, device_jac, tp_size,
+                                   trainableParamNumber, mu_ready.get(),
+                                   obs_done);
 
+                    num_updated++;
                     trainableParamNumber--;
                     ++tp_it;
                 }
@@ -593,6 +745,188 @@ template <class T = double> class AdjointJacobianGPU {
             }
             applyOperationsAdj(H_lambda, ops, static_cast<size_t>(op_idx));
         }
+
+        // Single synchronization point for the whole sweep
+        for (const auto &stream : obs_streams) {
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream.get()));
+        }
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream_id));
+
+        std::vector<CFP_t> host_jac(device_jac.getLength());
+        device_jac.CopyGpuDataToHost(host_jac.data(), host_jac.size(), false);
+        for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+            for (size_t tp_idx = tp_size - num_updated; tp_idx < tp_size;
+                 tp_idx++) {
+                jac[obs_idx][tp_idx] =
+                    -2 * scaling_factors_tp[tp_idx] *
+                    host_jac[getJacIndex(obs_idx, tp_idx, tp_size)].y;
+            }
+        }
+    }
+
+    /**
+     * @brief Calculates the vector-Jacobian product of the given observables
+     * with `dy`, without forming the full Jacobian.
+     *
+     * The observables are folded into \f$\sum_i dy_i O_i\f$, so that a
+     * single backward sweep with one observable-applied statevector is
+     * needed.
+     *
+     * @param dy Cotangent vector, one entry per observable.
+     * @param ref_data Pointer to the statevector data.
+     * @param length Length of the statevector data.
+     * @param obs ObservableGPUs contracted with `dy`.
+     * @param ops Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     * @param dev_tag Device and stream to run on.
+     * @return std::vector<T> Gradient with respect to each trainable parameter.
+     */
+    auto vectorJacobianProduct(
+        const std::vector<T> &dy, const CFP_t *ref_data, std::size_t length,
+        const std::vector<std::shared_ptr<ObservableGPU<T>>> &obs,
+        const Pennylane::Algorithms::OpsData<StateVectorCudaManaged<T>> &ops,
+        const std::vector<size_t> &trainableParams,
+        bool apply_operations = false, CUDA::DevTag<int> dev_tag = {0, 0})
+        -> std::vector<T> {
+        PL_ABORT_IF_NOT(dy.size() == obs.size(),
+                        "The length of dy must match the number of "
+                        "observables.");
+        std::vector<std::vector<T>> vjp(
+            1, std::vector<T>(trainableParams.size(), 0));
+        if (std::all_of(dy.begin(), dy.end(),
+                        [](T dy_i) { return dy_i == T{0}; })) {
+            return vjp.front();
+        }
+        adjointJacobian(ref_data, length, vjp, {foldObservables(obs, dy)}, ops,
+                        trainableParams, apply_operations, std::move(dev_tag));
+        return vjp.front();
+    }
+
+    /**
+     * @brief Number of state vectors of `length` elements fitting in the free
+     * memory of the current device.
+     *
+     * @param length Length of the statevector data.
+     * @param reserve Fraction of the free memory left untouched.
+     * @return size_t
+     */
+    static auto getMaxResidentStates(std::size_t length, double reserve = 0.1)
+        -> size_t {
+        std::size_t free_bytes = 0;
+        std::size_t total_bytes = 0;
+        PL_CUDA_IS_SUCCESS(cudaMemGetInfo(&free_bytes, &total_bytes));
+        const auto usable = static_cast<std::size_t>(
+            static_cast<double>(free_bytes) * (1.0 - reserve));
+        return usable / (length * sizeof(CFP_t));
+    }
+
+    /**
+     * @brief Memory-bounded variant of `adjointJacobian`.
+     *
+     * At most `max_states` state vectors are kept on the device. Observables
+     * are processed in chunks sized to fit, each chunk running its own
+     * backward sweep from the post-circuit state. When the operations have
+     * to be applied first, that state is checkpointed once so that later
+     * sweeps only recompute the backward pass of lambda. Operations are
+     * exactly invertible on the device, so no intermediate checkpoints are
+     * required.
+     *
+     * If `obs_weights` is given, the observables are folded into the single
+     * observable \f$\sum_i w_i O_i\f$ and `jac` receives one row, the
+     * vector-Jacobian product with `obs_weights`.
+     *
+     * @param ref_data Pointer to the statevector data.
+     * @param length Length of the statevector data.
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param obs ObservableGPUs for which to calculate Jacobian.
+     * @param ops Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     * @param obs_weights Optional weights folding the observables together.
+     * @param max_states Maximum number of resident state vectors. Derived from
+     * the free device memory when 0.
+     * @param dev_tag Device and stream to run on.
+     * @return AdjointSweepStats Sweeps, checkpoints and recomputed operations.
+     */
+    auto adjointJacobianLowMemory(
+        const CFP_t *ref_data, std::size_t length,
+        std::vector<std::vector<T>> &jac,
+        const std::vector<std::shared_ptr<ObservableGPU<T>>> &obs,
+        const Pennylane::Algorithms::OpsData<StateVectorCudaManaged<T>> &ops,
+        const std::vector<size_t> &trainableParams,
+        bool apply_operations = false, const std::vector<T> &obs_weights = {},
+        std::size_t max_states = 0, CUDA::DevTag<int> dev_tag = {0, 0})
+        -> AdjointSweepStats {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
+        PL_ABORT_IF(obs.empty(), "No observables provided.");
+
+        DevTag<int> dt_local(std::move(dev_tag));
+        dt_local.refresh();
+        if (max_states == 0) {
+            max_states = getMaxResidentStates(length);
+        }
+
+        std::vector<std::shared_ptr<ObservableGPU<T>>> sweep_obs = obs;
+        if (!obs_weights.empty()) {
+            PL_ABORT_IF_NOT(jac.size() == 1,
+                            "Folded observables fill a single Jacobian row.");
+            sweep_obs = {foldObservables(obs, obs_weights)};
+        }
+        const size_t num_observables = sweep_obs.size();
+
+        // lambda and mu are always resident
+        constexpr size_t num_work_states = 2;
+        const bool needs_checkpoint =
+            apply_operations &&
+            (num_observables + num_work_states > max_states);
+        const size_t num_reserved =
+            num_work_states + (needs_checkpoint ? 1 : 0);
+        PL_ABORT_IF(max_states <= num_reserved,
+                    "Not enough device memory for an adjoint sweep.");
+        const size_t chunk_size =
+            std::min(num_observables, max_states - num_reserved);
+
+        AdjointSweepStats stats;
+        stats.num_checkpoints = needs_checkpoint ? 1 : 0;
+        stats.max_resident_states = chunk_size + num_reserved;
+
+        std::unique_ptr<StateVectorCudaManaged<T>> checkpoint;
+        const CFP_t *sweep_data = ref_data;
+        bool sweep_apply = apply_operations;
+        if (needs_checkpoint) {
+            checkpoint = std::make_unique<StateVectorCudaManaged<T>>(
+                ref_data, length, dt_local);
+            applyOperations(*checkpoint, ops);
+            checkpoint->applyQubitMap();
+            sweep_data = checkpoint->getData();
+            sweep_apply = false;
+        }
+
+        const size_t num_sweep_ops = countSweepOps(ops, trainableParams);
+        std::vector<std::vector<T>> jac_chunk;
+        for (size_t first = 0; first < num_observables; first += chunk_size) {
+            const size_t last = std::min(first + chunk_size, num_observables);
+            jac_chunk.assign(last - first,
+                             std::vector<T>(trainableParams.size(), 0));
+            adjointJacobian(sweep_data, length, jac_chunk,
+                            {sweep_obs.begin() + first,
+                             sweep_obs.begin() + last},
+                            ops, trainableParams, sweep_apply, dt_local);
+            for (size_t row = 0; row < jac_chunk.size(); row++) {
+                jac.at(first + row) = std::move(jac_chunk[row]);
+            }
+            if (stats.num_sweeps > 0) {
+                stats.num_recomputed_ops += num_sweep_ops;
+            }
+            stats.num_sweeps++;
+        }
+        return stats;
     }
 };
 
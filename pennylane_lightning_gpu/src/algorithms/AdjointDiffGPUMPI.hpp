@@ -101,32 +101,74 @@ class AdjointJacobianGPUMPI {
 
     /**
      * @brief Utility method to update the Jacobian at a given index by
-     * calculating the overlap between two given states.
+     * calculating the local overlap between two given states.
      *
-     * @param sv1s Statevector <sv1|. Data will be conjugated.
-     * @param sv2 Statevector |sv2>
-     * @param jac Jacobian receiving the values.
-     * @param scaling_coeff Generator coefficient for given gate derivative.
+     * The overlap of the local amplitudes is written to the device-resident
+     * Jacobian buffer without any synchronization or communication. The
+     * partial overlaps of all ranks are summed by `reduceJacobian`.
+     *
+     * @param sv1s Statevector <sv1|, with the qubit map applied. Data will be
+     * conjugated.
+     * @param sv2 Statevector |sv2>, with the qubit map applied.
+     * @param device_jac Device buffer of `num_observables * tp_size` elements
+     * receiving the local overlaps in row-major order.
+     * @param tp_size Number of trainable parameters.
      * @param obs_idx The index of observables of Jacobian to update.
      * @param param_index Parameter index position of Jacobian to update.
      */
     inline void updateJacobian(const SVType<T> &sv1s, const SVType<T> &sv2,
-                               std::vector<std::vector<T>> &jac,
-                               T scaling_coeff, size_t obs_idx,
+                               DataBuffer<CFP_t, int> &device_jac,
+                               size_t tp_size, size_t obs_idx,
                                size_t param_index) {
         PL_ABORT_IF_NOT(sv1s.getDataBuffer().getDevTag().getDeviceID() ==
                             sv2.getDataBuffer().getDevTag().getDeviceID(),
                         "Data exists on different GPUs. Aborting.");
-        CFP_t result;
-        innerProdC_CUDA_device(sv1s.getData(), sv2.getData(), sv1s.getLength(),
-                               sv1s.getDataBuffer().getDevTag().getDeviceID(),
-                               sv1s.getDataBuffer().getDevTag().getStreamID(),
-                               sv1s.getCublasCaller(), &result);
-
-        auto jac_single_param =
-            sv2.getMPIManager().template allreduce<CFP_t>(result, "sum");
+        innerProdC_CUDA_device(
+            sv1s.getData(), sv2.getData(), sv1s.getLength(),
+            sv1s.getDataBuffer().getDevTag().getDeviceID(),
+            sv1s.getDataBuffer().getDevTag().getStreamID(),
+            sv1s.getCublasCaller(),
+            device_jac.getData() + obs_idx * tp_size + param_index);
+    }
 
-        jac[obs_idx][param_index] = -2 * scaling_coeff * jac_single_param.y;
+    /**
+     * @brief Copy the local overlaps to the host once, scale them, and sum
+     * the partial Jacobians of all ranks in a single collective.
+     *
+     * @param sv Statevector whose stream computed the overlaps.
+     * @param device_jac Device buffer of the local overlaps.
+     * @param scaling_factors_tp Generator scaling factor of each trainable
+     * parameter.
+     * @param num_updated Number of trainable parameters, counted from the
+     * last one, whose overlaps have been computed.
+     * @param jac Jacobian receiving the values.
+     */
+    inline void reduceJacobian(const SVType<T> &sv,
+                               DataBuffer<CFP_t, int> &device_jac,
+                               const std::vector<T> &scaling_factors_tp,
+                               size_t num_updated,
+                               std::vector<std::vector<T>> &jac) {
+        const size_t tp_size = scaling_factors_tp.size();
+        const size_t num_observables = device_jac.getLength() / tp_size;
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(
+            sv.getDataBuffer().getDevTag().getStreamID()));
+        std::vector<CFP_t> host_overlaps(device_jac.getLength());
+        device_jac.CopyGpuDataToHost(host_overlaps.data(),
+                                     host_overlaps.size(), false);
+
+        std::vector<T> local_jac(host_overlaps.size(), 0);
+        for (size_t i = 0; i < host_overlaps.size(); i++) {
+            local_jac[i] =
+                -2 * scaling_factors_tp[i % tp_size] * host_overlaps[i].y;
+        }
+        auto global_jac =
+            sv.getMPIManager().template allreduce<T>(local_jac, "sum");
+        for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+            for (size_t tp_idx = tp_size - num_updated; tp_idx < tp_size;
+                 tp_idx++) {
+                jac[obs_idx][tp_idx] = global_jac[obs_idx * tp_size + tp_idx];
+            }
+        }
     }
 
     /**
@@ -226,6 +268,31 @@ class AdjointJacobianGPUMPI {
         return {ops_name, ops_params, ops_wires, ops_inverses, ops_matrices};
     }
 
+    /**
+     * @brief Utility to create a given operations object from a flat op
+     * stream, in a single pass over its buffers.
+     *
+     * @param ops Operations, read in place.
+     * @return const Pennylane::Algorithms::OpsData<StateVectorCudaManaged<T>>
+     */
+    auto createOpsData(const cuUtil::OpStream<T> &ops)
+        -> Pennylane::Algorithms::OpsData<StateVectorCudaManaged<T>> {
+        const auto num_ops = ops.getNumOps();
+        std::vector<std::string> ops_name(num_ops);
+        std::vector<std::vector<T>> ops_params(num_ops);
+        std::vector<std::vector<size_t>> ops_wires(num_ops);
+        std::vector<bool> ops_inverses(num_ops);
+        std::vector<std::vector<std::complex<T>>> ops_matrices(num_ops);
+        for (size_t op = 0; op < num_ops; op++) {
+            ops_name[op] = ops.getName(op);
+            ops_params[op] = ops.getParams(op);
+            ops_wires[op] = ops.getWires(op);
+            ops_inverses[op] = ops.getInverse(op);
+            ops_matrices[op] = ops.getMatrix(op);
+        }
+        return {ops_name, ops_params, ops_wires, ops_inverses, ops_matrices};
+    }
+
     /**
      * @brief The memory-optimized implementation of the Jacobian calculation
      * for the statevector is designed to reduce memory consumption at the cost
@@ -270,6 +337,7 @@ class AdjointJacobianGPUMPI {
         if (apply_operations) {
             applyOperations(lambda_ref, ops);
         }
+        lambda_ref.applyQubitMap();
 
         SVType<T> mu(dt_local, lambda_ref.getNumGlobalQubits(),
                      lambda_ref.getNumLocalQubits());
@@ -281,6 +349,14 @@ class AdjointJacobianGPUMPI {
         SVType<T> lambda(dt_local, lambda_ref.getNumGlobalQubits(),
                          lambda_ref.getNumLocalQubits(), lambda_ref.getData());
 
+        // Local overlaps stay on the device until the end of the sweeps and
+        // are summed over the ranks once.
+        DataBuffer<CFP_t, int> device_jac{num_observables * tp_size, dt_local,
+                                          true};
+        device_jac.zeroInit();
+        std::vector<T> scaling_factors_tp(tp_size, 0);
+        size_t num_updated = 0;
+
         for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
             lambda.updateData(lambda_ref);
 
@@ -316,13 +392,17 @@ class AdjointJacobianGPUMPI {
 
                 if (ops.hasParams(op_idx)) {
                     if (current_param_idx == *tp_it) {
-                        const T scalingFactor =
+                        scaling_factors_tp[trainableParamNumber] =
                             applyGenerator(mu, ops.getOpsName()[op_idx],
                                            ops.getOpsWires()[op_idx],
                                            !ops.getOpsInverses()[op_idx]) *
                             (ops.getOpsInverses()[op_idx] ? -1 : 1);
-                        updateJacobian(H_lambda, mu, jac, scalingFactor,
+                        H_lambda.applyQubitMap();
+                        mu.applyQubitMap();
+                        updateJacobian(H_lambda, mu, device_jac, tp_size,
                                        obs_idx, trainableParamNumber);
+                        num_updated = std::max(num_updated,
+                                               tp_size - trainableParamNumber);
                         trainableParamNumber--;
                         ++tp_it;
                     }
@@ -331,6 +411,7 @@ class AdjointJacobianGPUMPI {
                 applyOperationAdj(H_lambda, ops, static_cast<size_t>(op_idx));
             }
         }
+        reduceJacobian(mu, device_jac, scaling_factors_tp, num_updated, jac);
     }
 
     /**
@@ -378,6 +459,7 @@ class AdjointJacobianGPUMPI {
         if (apply_operations) {
             applyOperations(lambda, ops);
         }
+        lambda.applyQubitMap();
 
         lambda.getMPIManager().Barrier();
 
@@ -394,6 +476,14 @@ class AdjointJacobianGPUMPI {
         SVType<T> mu(dt_local, lambda.getNumGlobalQubits(),
                      lambda.getNumLocalQubits());
 
+        // Local overlaps stay on the device until the end of the sweep and
+        // are summed over the ranks once.
+        DataBuffer<CFP_t, int> device_jac{num_observables * tp_size, dt_local,
+                                          true};
+        device_jac.zeroInit();
+        std::vector<T> scaling_factors_tp(tp_size, 0);
+        size_t num_updated = 0;
+
         for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
              op_idx--) {
             PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
@@ -412,19 +502,21 @@ class AdjointJacobianGPUMPI {
 
             if (ops.hasParams(op_idx)) {
                 if (current_param_idx == *tp_it) {
-                    const T scalingFactor =
+                    scaling_factors_tp[trainableParamNumber] =
                         applyGenerator(mu, ops.getOpsName()[op_idx],
                                        ops.getOpsWires()[op_idx],
                                        !ops.getOpsInverses()[op_idx]) *
                         (ops.getOpsInverses()[op_idx] ? -1 : 1);
 
+                    mu.applyQubitMap();
                     for (size_t obs_idx = 0; obs_idx < num_observables;
                          obs_idx++) {
-                        updateJacobian(*H_lambda[obs_idx], mu, jac,
-                                       scalingFactor, obs_idx,
-                                       trainableParamNumber);
+                        H_lambda[obs_idx]->applyQubitMap();
+                        updateJacobian(*H_lambda[obs_idx], mu, device_jac,
+                                       tp_size, obs_idx, trainableParamNumber);
                     }
 
+                    num_updated++;
                     trainableParamNumber--;
                     ++tp_it;
                 }
@@ -434,6 +526,7 @@ class AdjointJacobianGPUMPI {
                 applyOperationAdj(*H_lambda[obs_idx], ops, op_idx);
             }
         }
+        reduceJacobian(mu, device_jac, scaling_factors_tp, num_updated, jac);
     }
 };
 
@@ -14,10 +14,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "DeviceCSRMatrix.hpp"
+#include "PauliSentence.hpp"
 #include "StateVectorCudaManaged.hpp"
+#include "Variance.hpp"
 
 namespace Pennylane::Algorithms {
 
@@ -65,6 +71,33 @@ class ObservableGPU : public std::enable_shared_from_this<ObservableGPU<T>> {
      */
     [[nodiscard]] virtual auto getWires() const -> std::vector<size_t> = 0;
 
+    /**
+     * @brief Append the Pauli word of this observable and its wires.
+     *
+     * @param word Pauli word to append to.
+     * @param wires Wires of the Pauli word to append to.
+     * @return bool False if the observable is not a product of Pauli
+     * operators, in which case the arguments are left in an unspecified state.
+     */
+    [[nodiscard]] virtual bool
+    appendPauliWord([[maybe_unused]] std::string &word,
+                    [[maybe_unused]] std::vector<size_t> &wires) const {
+        return false;
+    }
+
+    /**
+     * @brief Get the diagonal of the observable on the wires of `getWires()`.
+     *
+     * @param diag Diagonal to write to.
+     * @return bool False if the observable is not diagonal in the
+     * computational basis, in which case `diag` is left in an unspecified
+     * state.
+     */
+    [[nodiscard]] virtual bool
+    getDiagonal([[maybe_unused]] std::vector<T> &diag) const {
+        return false;
+    }
+
     /**
      * @brief Test whether this object is equal to another object
      */
@@ -125,6 +158,23 @@ template <typename T> class NamedObsGPU final : public ObservableGPU<T> {
     void applyInPlace(StateVectorCudaManaged<T> &sv) const override {
         sv.applyOperation(obs_name_, wires_, false, params_);
     }
+
+    [[nodiscard]] bool
+    appendPauliWord(std::string &word,
+                    std::vector<size_t> &wires) const override {
+        static const std::unordered_map<std::string, char> paulis{
+            {"Identity", 'I'},
+            {"PauliX", 'X'},
+            {"PauliY", 'Y'},
+            {"PauliZ", 'Z'}};
+        const auto it = paulis.find(obs_name_);
+        if (it == paulis.end()) {
+            return false;
+        }
+        word.append(wires_.size(), it->second);
+        wires.insert(wires.end(), wires_.begin(), wires_.end());
+        return true;
+    }
 };
 
 /**
@@ -177,6 +227,10 @@ template <typename T> class HermitianObsGPU final : public ObservableGPU<T> {
     void applyInPlace(StateVectorCudaManaged<T> &sv) const override {
         sv.applyOperation_std(getObsName(), wires_, false, {}, matrix_);
     }
+
+    [[nodiscard]] bool getDiagonal(std::vector<T> &diag) const override {
+        return CUDA::Util::getMatrixDiagonal(matrix_, diag);
+    }
 };
 
 /**
@@ -270,6 +324,14 @@ template <typename T> class TensorProdObsGPU final : public ObservableGPU<T> {
         }
     }
 
+    [[nodiscard]] bool
+    appendPauliWord(std::string &word,
+                    std::vector<size_t> &wires) const override {
+        return std::all_of(obs_.begin(), obs_.end(), [&](const auto &ob) {
+            return ob->appendPauliWord(word, wires);
+        });
+    }
+
     [[nodiscard]] auto getObsName() const -> std::string override {
         using Pennylane::Util::operator<<;
         std::ostringstream obs_stream;
@@ -295,6 +357,26 @@ template <typename T> class HamiltonianGPU final : public ObservableGPU<T> {
   private:
     std::vector<T> coeffs_;
     std::vector<std::shared_ptr<ObservableGPU<T>>> obs_;
+    // Pauli word and wires of each term, empty unless every term is a
+    // product of Pauli operators.
+    std::vector<std::string> pauli_words_;
+    std::vector<std::vector<size_t>> pauli_wires_;
+
+    /**
+     * @brief Collect the Pauli word of every term, if they all have one.
+     */
+    void initPauliWords() {
+        pauli_words_.resize(obs_.size());
+        pauli_wires_.resize(obs_.size());
+        for (size_t term_idx = 0; term_idx < obs_.size(); term_idx++) {
+            if (!obs_[term_idx]->appendPauliWord(pauli_words_[term_idx],
+                                                 pauli_wires_[term_idx])) {
+                pauli_words_.clear();
+                pauli_wires_.clear();
+                return;
+            }
+        }
+    }
 
     [[nodiscard]] bool isEqual(const ObservableGPU<T> &other) const override {
         const auto &other_cast = static_cast<const HamiltonianGPU<T> &>(other);
@@ -322,6 +404,7 @@ template <typename T> class HamiltonianGPU final : public ObservableGPU<T> {
     HamiltonianGPU(T1 &&arg1, T2 &&arg2)
         : coeffs_{std::forward<T1>(arg1)}, obs_{std::forward<T2>(arg2)} {
         PL_ASSERT(coeffs_.size() == obs_.size());
+        initPauliWords();
     }
 
     /**
@@ -342,16 +425,43 @@ template <typename T> class HamiltonianGPU final : public ObservableGPU<T> {
             new HamiltonianGPU<T>{std::move(arg1), std::move(arg2)});
     }
 
-    // to work with
+    /**
+     * @brief Whether every term is a product of Pauli operators, in which
+     * case the Hamiltonian is applied in a single pass over the state.
+     */
+    [[nodiscard]] auto isPauliSentence() const -> bool {
+        return !obs_.empty() && !pauli_words_.empty();
+    }
+
+    /**
+     * @brief Compile the Hamiltonian into bit masks for the given number of
+     * qubits. Requires `isPauliSentence()`.
+     *
+     * @param num_qubits Number of qubits of the state vector.
+     */
+    [[nodiscard]] auto getPauliSentence(size_t num_qubits) const
+        -> CUDA::Util::PauliSentence<T> {
+        PL_ABORT_IF_NOT(isPauliSentence(),
+                        "The Hamiltonian is not a sum of Pauli words");
+        return CUDA::Util::compilePauliSentence(coeffs_, pauli_words_,
+                                                pauli_wires_, num_qubits);
+    }
+
     void applyInPlace(StateVectorCudaManaged<T> &sv) const override {
+        if (isPauliSentence()) {
+            sv.applyPauliSentence(getPauliSentence(sv.getNumQubits()));
+            return;
+        }
         using CFP_t = typename StateVectorCudaManaged<T>::CFP_t;
         DataBuffer<CFP_t, int> buffer(sv.getDataBuffer().getLength(),
                                       sv.getDataBuffer().getDevTag());
         buffer.zeroInit();
+        sv.applyQubitMap();
 
         for (size_t term_idx = 0; term_idx < coeffs_.size(); term_idx++) {
             StateVectorCudaManaged<T> tmp(sv);
             obs_[term_idx]->applyInPlace(tmp);
+            tmp.applyQubitMap();
             scaleAndAddC_CUDA(std::complex<T>{coeffs_[term_idx], 0.0},
                               tmp.getData(), buffer.getData(), tmp.getLength(),
                               tmp.getDataBuffer().getDevTag().getDeviceID(),
@@ -402,12 +512,16 @@ class SparseHamiltonianGPU final : public ObservableGPU<T> {
     // cuSparse required index type
     using IdxT = typename std::conditional<std::is_same<T, float>::value,
                                            int32_t, int64_t>::type;
+    using DeviceMatrixT = CUDA::Util::DeviceCSRMatrix<T, IdxT>;
 
   private:
     std::vector<std::complex<T>> data_;
     std::vector<IdxT> indices_;
     std::vector<IdxT> offsets_;
     std::vector<std::size_t> wires_;
+    // Device copies of the matrix, created lazily per device.
+    std::shared_ptr<CUDA::Util::DeviceCSRCache<T, IdxT>> device_matrices_{
+        std::make_shared<CUDA::Util::DeviceCSRCache<T, IdxT>>()};
 
     [[nodiscard]] bool isEqual(const ObservableGPU<T> &other) const override {
         const auto &other_cast =
@@ -465,125 +579,35 @@ class SparseHamiltonianGPU final : public ObservableGPU<T> {
      * @brief Updates the statevector SV:->SV', where SV' = a*H*SV, and where H
      * is a sparse Hamiltonian.
      *
+     * The CSR matrix is uploaded to the device of `sv` on first use and kept
+     * there for later calls.
      */
     void applyInPlace(StateVectorCudaManaged<T> &sv) const override {
         PL_ABORT_IF_NOT(wires_.size() == sv.getNumQubits(),
                         "SparseH wire count does not match state-vector size");
-        using CFP_t = typename StateVectorCudaManaged<T>::CFP_t;
+        sv.applySparseMatrix(getDeviceMatrix(sv));
+    }
 
-        const std::size_t nIndexBits = sv.getNumQubits();
-        const std::size_t length = 1 << nIndexBits;
-        const int64_t num_rows = static_cast<int64_t>(
-            offsets_.size() -
-            1); // int64_t is required for num_rows by cusparseCreateCsr
-        const int64_t num_cols = static_cast<int64_t>(
-            num_rows); // int64_t is required for num_cols by cusparseCreateCsr
-        const int64_t nnz = static_cast<int64_t>(
-            data_.size()); // int64_t is required for nnz by cusparseCreateCsr
-
-        const CFP_t alpha = {1.0, 0.0};
-        const CFP_t beta = {0.0, 0.0};
-
-        auto device_id = sv.getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = sv.getDataBuffer().getDevTag().getStreamID();
-
-        // clang-format off
-        DataBuffer<IdxT> H_csrOffsets  { offsets_.size(), device_id, stream_id, true};
-        DataBuffer<IdxT> H_columns     { indices_.size(), device_id, stream_id, true};
-        DataBuffer<CFP_t> H_values     { data_.size(),    device_id, stream_id, true};
-
-        // Transfer ownership after state update to StateVectorCudaManaged
-        std::unique_ptr<DataBuffer<CFP_t>> d_sv_prime = std::make_unique<DataBuffer<CFP_t>>(length, device_id, stream_id, true);
-
-        H_csrOffsets.CopyHostDataToGpu( offsets_.data(), H_csrOffsets.getLength(), false);
-        H_columns.CopyHostDataToGpu(    indices_.data(), H_columns.getLength(),    false);
-        H_values.CopyHostDataToGpu(     data_.data(),    H_values.getLength(),     false);
-        // clang-format on
-
-        cudaDataType_t data_type;
-        cusparseIndexType_t compute_type;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-            compute_type = CUSPARSE_INDEX_64I;
-        } else {
-            data_type = CUDA_C_32F;
-            compute_type = CUSPARSE_INDEX_32I;
-        }
+    /**
+     * @brief Get the CSR matrix on the device of `sv`, uploading it on first
+     * use. The matrix is shared by copies of this observable.
+     *
+     * @param sv State vector whose device is used.
+     */
+    [[nodiscard]] auto
+    getDeviceMatrix(const StateVectorCudaManaged<T> &sv) const
+        -> const DeviceMatrixT & {
+        return device_matrices_->get(offsets_, indices_, data_,
+                                     sv.getDataBuffer().getDevTag());
+    }
 
-        // CUSPARSE APIs
-        cusparseHandle_t handle = sv.getCusparseHandle();
-        cusparseSpMatDescr_t sparseH_descriptor;
-        cusparseDnVecDescr_t sv_descriptor, sv_prime_descriptor;
-
-        size_t bufferSize = 0;
-
-        // Create sparse matrix descriptor for H in CSR format
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
-            /* cusparseSpMatDescr_t* */ &sparseH_descriptor,
-            /* int64_t */ num_rows,
-            /* int64_t */ num_cols,
-            /* int64_t */ nnz,
-            /* void* */ H_csrOffsets.getData(),
-            /* void* */ H_columns.getData(),
-            /* void* */ H_values.getData(),
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexBase_t */ CUSPARSE_INDEX_BASE_ZERO,
-            /* cudaDataType */ data_type));
-
-        // Create dense statevector descriptor
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &sv_descriptor,
-            /* int64_t */ num_cols,
-            /* void* */ sv.getData(),
-            /* cudaDataType */ data_type));
-
-        // Create dense statevector prime descriptor
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &sv_prime_descriptor,
-            /* int64_t */ num_rows,
-            /* void* */ d_sv_prime->getData(),
-            /* cudaDataType */ data_type));
-
-        // allocate an external buffer if needed
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ sparseH_descriptor,
-            /* cusparseDnVecDescr_t */ sv_descriptor,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ sv_prime_descriptor,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */
-            CUSPARSE_SPMV_CSR_ALG1, // Can also use CUSPARSE_MV_ALG_DEFAULT
-            /* size_t* */ &bufferSize));
-
-        DataBuffer<cudaDataType_t> dBuffer{bufferSize, device_id, stream_id,
-                                           true};
-
-        // execute SpMV
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ sparseH_descriptor,
-            /* cusparseDnVecDescr_t */ sv_descriptor,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ sv_prime_descriptor,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */
-            CUSPARSE_SPMV_ALG_DEFAULT,
-            /* void* */ reinterpret_cast<void *>(dBuffer.getData())));
-
-        // destroy matrix/vector descriptors
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(sparseH_descriptor));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(sv_descriptor));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(sv_prime_descriptor));
-
-        sv.updateData(std::move(d_sv_prime));
+    /**
+     * @brief Get the number of uploads and reuses of the device CSR matrix,
+     * with the bytes and upload time saved by reusing it.
+     */
+    [[nodiscard]] auto getDeviceMatrixStats() const
+        -> CUDA::Util::DeviceCSRCacheStats {
+        return device_matrices_->getStats();
     }
 
     [[nodiscard]] auto getObsName() const -> std::string override {
@@ -14,12 +14,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "CSRMatrix.hpp"
 #include "MPIManager.hpp"
 #include "StateVectorCudaMPI.hpp"
+#include "Variance.hpp"
 
 namespace Pennylane::Algorithms {
 
@@ -69,6 +73,33 @@ class ObservableGPUMPI
      */
     [[nodiscard]] virtual auto getWires() const -> std::vector<size_t> = 0;
 
+    /**
+     * @brief Append the Pauli word of this observable and its wires.
+     *
+     * @param word Pauli word to append to.
+     * @param wires Wires of the Pauli word to append to.
+     * @return bool False if the observable is not a product of Pauli
+     * operators, in which case the arguments are left in an unspecified state.
+     */
+    [[nodiscard]] virtual bool
+    appendPauliWord([[maybe_unused]] std::string &word,
+                    [[maybe_unused]] std::vector<size_t> &wires) const {
+        return false;
+    }
+
+    /**
+     * @brief Get the diagonal of the observable on the wires of `getWires()`.
+     *
+     * @param diag Diagonal to write to.
+     * @return bool False if the observable is not diagonal in the
+     * computational basis, in which case `diag` is left in an unspecified
+     * state.
+     */
+    [[nodiscard]] virtual bool
+    getDiagonal([[maybe_unused]] std::vector<T> &diag) const {
+        return false;
+    }
+
     /**
      * @brief Test whether this object is equal to another object
      */
@@ -130,6 +161,23 @@ template <typename T> class NamedObsGPUMPI final : public ObservableGPUMPI<T> {
     inline void applyInPlace(StateVectorCudaMPI<T> &sv) const override {
         sv.applyOperation(obs_name_, wires_, false, params_);
     }
+
+    [[nodiscard]] bool
+    appendPauliWord(std::string &word,
+                    std::vector<size_t> &wires) const override {
+        static const std::unordered_map<std::string, char> paulis{
+            {"Identity", 'I'},
+            {"PauliX", 'X'},
+            {"PauliY", 'Y'},
+            {"PauliZ", 'Z'}};
+        const auto it = paulis.find(obs_name_);
+        if (it == paulis.end()) {
+            return false;
+        }
+        word.append(wires_.size(), it->second);
+        wires.insert(wires.end(), wires_.begin(), wires_.end());
+        return true;
+    }
 };
 
 /**
@@ -184,6 +232,10 @@ class HermitianObsGPUMPI final : public ObservableGPUMPI<T> {
     inline void applyInPlace(StateVectorCudaMPI<T> &sv) const override {
         sv.applyOperation_std(getObsName(), wires_, false, {}, matrix_);
     }
+
+    [[nodiscard]] bool getDiagonal(std::vector<T> &diag) const override {
+        return CUDA::Util::getMatrixDiagonal(matrix_, diag);
+    }
 };
 
 /**
@@ -279,6 +331,14 @@ class TensorProdObsGPUMPI final : public ObservableGPUMPI<T> {
         }
     }
 
+    [[nodiscard]] bool
+    appendPauliWord(std::string &word,
+                    std::vector<size_t> &wires) const override {
+        return std::all_of(obs_.begin(), obs_.end(), [&](const auto &ob) {
+            return ob->appendPauliWord(word, wires);
+        });
+    }
+
     [[nodiscard]] auto getObsName() const -> std::string override {
         using Pennylane::Util::operator<<;
         std::ostringstream obs_stream;
@@ -360,6 +420,7 @@ class HamiltonianGPUMPI final : public ObservableGPUMPI<T> {
         DataBuffer<CFP_t, int> buffer(sv.getDataBuffer().getLength(),
                                       sv.getDataBuffer().getDevTag());
         buffer.zeroInit();
+        sv.applyQubitMap();
 
         for (size_t term_idx = 0; term_idx < coeffs_.size(); term_idx++) {
             DevTag<int> dt_local(sv.getDataBuffer().getDevTag());
@@ -367,6 +428,7 @@ class HamiltonianGPUMPI final : public ObservableGPUMPI<T> {
             StateVectorCudaMPI<T> tmp(dt_local, sv.getNumGlobalQubits(),
                                       sv.getNumLocalQubits(), sv.getData());
             obs_[term_idx]->applyInPlace(tmp);
+            tmp.applyQubitMap();
             scaleAndAddC_CUDA(std::complex<T>{coeffs_[term_idx], 0.0},
                               tmp.getData(), buffer.getData(), tmp.getLength(),
                               tmp.getDataBuffer().getDevTag().getDeviceID(),
@@ -493,202 +555,60 @@ class SparseHamiltonianGPUMPI final : public ObservableGPUMPI<T> {
                 "SparseH wire count does not match state-vector size");
         }
 
-        // Distribute sparse matrix across multi-nodes/multi-gpus
-        size_t num_rows = size_t{1} << sv.getTotalNumQubits();
-        size_t local_num_rows = size_t{1} << sv.getNumLocalQubits();
-
-        std::vector<std::vector<CSRMatrix<PrecisionT, IdxT>>> csrmatrix_blocks;
-
-        if (mpi_manager.getRank() == 0) {
-            csrmatrix_blocks = splitCSRMatrix<PrecisionT, IdxT>(
-                mpi_manager, num_rows, offsets_.data(), indices_.data(),
-                data_.data());
-        }
-        mpi_manager.Barrier();
-
-        std::vector<CSRMatrix<PrecisionT, IdxT>> localCSRMatVector;
-        for (size_t i = 0; i < mpi_manager.getSize(); i++) {
-            auto localCSRMat = scatterCSRMatrix<PrecisionT, IdxT>(
-                mpi_manager, csrmatrix_blocks[i], local_num_rows, 0);
-            localCSRMatVector.push_back(localCSRMat);
+        // Each rank receives only its row range of the sparse matrix and
+        // builds its column blocks locally
+        sv.applyQubitMap();
+        const size_t rank = mpi_manager.getRank();
+        const size_t num_ranks = mpi_manager.getSize();
+        const size_t local_num_rows = size_t{1} << sv.getNumLocalQubits();
+        auto blocks = scatterCSRMatrixBlocks<PrecisionT, IdxT>(
+            mpi_manager, local_num_rows, offsets_.data(), indices_.data(),
+            data_.data(), 0);
+
+        // Column blocks needed by each rank, i.e. the segments it fetches
+        std::vector<size_t> needed(num_ranks);
+        for (size_t j = 0; j < num_ranks; j++) {
+            needed[j] = blocks[j].getValues().empty() ? 0 : 1;
         }
-
-        mpi_manager.Barrier();
+        const auto all_needed = mpi_manager.template allgather<size_t>(needed);
 
         using CFP_t = typename StateVectorCudaMPI<T>::CFP_t;
-        const CFP_t alpha = {1.0, 0.0};
-        const CFP_t beta = {0.0, 0.0};
-
-        auto device_id = sv.getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = sv.getDataBuffer().getDevTag().getStreamID();
-
-        cudaDataType_t data_type;
-        cusparseIndexType_t compute_type;
-        const cusparseOperation_t operation_type =
-            CUSPARSE_OPERATION_NON_TRANSPOSE;
-        const cusparseSpMVAlg_t spmvalg_type = CUSPARSE_SPMV_ALG_DEFAULT;
-        const cusparseIndexBase_t index_base_type = CUSPARSE_INDEX_BASE_ZERO;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-        } else {
-            data_type = CUDA_C_32F;
-        }
-
-        if constexpr (std::is_same_v<IdxT, int64_t>) {
-            compute_type = CUSPARSE_INDEX_64I;
-        } else {
-            compute_type = CUSPARSE_INDEX_32I;
+        using DeviceMatrixT = CUDA::Util::DeviceCSRMatrix<PrecisionT, IdxT>;
+        const auto &dev_tag = sv.getDataBuffer().getDevTag();
+
+        DataBuffer<CFP_t, int> d_sv_prime{local_num_rows, dev_tag, true};
+        d_sv_prime.zeroInit();
+        if (needed[rank]) {
+            const DeviceMatrixT matrix{blocks[rank].getCsrOffsets(),
+                                       blocks[rank].getColumns(),
+                                       blocks[rank].getValues(), dev_tag};
+            sv.applySpMV(matrix, sv.getData(), d_sv_prime.getData(), true);
         }
 
-        const size_t length_local = size_t{1} << sv.getNumLocalQubits();
-
-        std::unique_ptr<DataBuffer<CFP_t>> d_sv_prime =
-            std::make_unique<DataBuffer<CFP_t>>(length_local, device_id,
-                                                stream_id, true);
-        std::unique_ptr<DataBuffer<CFP_t>> d_tmp =
-            std::make_unique<DataBuffer<CFP_t>>(length_local, device_id,
-                                                stream_id, true);
-        d_sv_prime->zeroInit();
-        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-        mpi_manager.Barrier();
-
-        for (size_t i = 0; i < mpi_manager.getSize(); i++) {
-            auto &localCSRMatrix = localCSRMatVector[i];
-
-            int64_t num_rows_local =
-                static_cast<int64_t>(localCSRMatrix.getCsrOffsets().size() - 1);
-            int64_t num_cols_local = num_rows_local;
-            int64_t nnz_local =
-                static_cast<int64_t>(localCSRMatrix.getValues().size());
-
-            size_t color = 0;
-
-            if (localCSRMatrix.getValues().size() != 0) {
-                DataBuffer<IdxT, int> d_csrOffsets{
-                    localCSRMatrix.getCsrOffsets().size(), device_id, stream_id,
-                    true};
-                DataBuffer<IdxT, int> d_columns{
-                    localCSRMatrix.getColumns().size(), device_id, stream_id,
-                    true};
-                DataBuffer<CFP_t, int> d_values{
-                    localCSRMatrix.getValues().size(), device_id, stream_id,
-                    true};
-
-                d_csrOffsets.CopyHostDataToGpu(
-                    localCSRMatrix.getCsrOffsets().data(),
-                    localCSRMatrix.getCsrOffsets().size(), false);
-                d_columns.CopyHostDataToGpu(localCSRMatrix.getColumns().data(),
-                                            localCSRMatrix.getColumns().size(),
-                                            false);
-                d_values.CopyHostDataToGpu(localCSRMatrix.getValues().data(),
-                                           localCSRMatrix.getValues().size(),
-                                           false);
-
-                // CUSPARSE APIs
-                cusparseSpMatDescr_t mat;
-                cusparseDnVecDescr_t vecX, vecY;
-
-                size_t bufferSize = 0;
-                cusparseHandle_t handle = sv.getCusparseHandle();
-
-                // Create sparse matrix A in CSR format
-                PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
-                    /* cusparseSpMatDescr_t* */ &mat,
-                    /* int64_t */ num_rows_local,
-                    /* int64_t */ num_cols_local,
-                    /* int64_t */ nnz_local,
-                    /* void* */ d_csrOffsets.getData(),
-                    /* void* */ d_columns.getData(),
-                    /* void* */ d_values.getData(),
-                    /* cusparseIndexType_t */ compute_type,
-                    /* cusparseIndexType_t */ compute_type,
-                    /* cusparseIndexBase_t */ index_base_type,
-                    /* cudaDataType */ data_type));
-
-                // Create dense vector X
-                PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-                    /* cusparseDnVecDescr_t* */ &vecX,
-                    /* int64_t */ num_cols_local,
-                    /* void* */ sv.getData(),
-                    /* cudaDataType */ data_type));
-
-                // Create dense vector y
-                PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-                    /* cusparseDnVecDescr_t* */ &vecY,
-                    /* int64_t */ num_rows_local,
-                    /* void* */ d_tmp->getData(),
-                    /* cudaDataType */ data_type));
-
-                // allocate an external buffer if needed
-                PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
-                    /* cusparseHandle_t */ handle,
-                    /* cusparseOperation_t */ operation_type,
-                    /* const void* */ &alpha,
-                    /* cusparseSpMatDescr_t */ mat,
-                    /* cusparseDnVecDescr_t */ vecX,
-                    /* const void* */ &beta,
-                    /* cusparseDnVecDescr_t */ vecY,
-                    /* cudaDataType */ data_type,
-                    /* cusparseSpMVAlg_t */ spmvalg_type,
-                    /* size_t* */ &bufferSize));
-
-                DataBuffer<cudaDataType_t, int> dBuffer{bufferSize, device_id,
-                                                        stream_id, true};
-
-                // execute SpMV
-                PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
-                    /* cusparseHandle_t */ handle,
-                    /* cusparseOperation_t */ operation_type,
-                    /* const void* */ &alpha,
-                    /* cusparseSpMatDescr_t */ mat,
-                    /* cusparseDnVecDescr_t */ vecX,
-                    /* const void* */ &beta,
-                    /* cusparseDnVecDescr_t */ vecY,
-                    /* cudaDataType */ data_type,
-                    /* cusparseSpMVAlg_t */ spmvalg_type,
-                    /* void* */ reinterpret_cast<void *>(dBuffer.getData())));
-
-                // destroy matrix/vector descriptors
-                PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(mat));
-                PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecX));
-                PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecY));
-
-                color = 1;
-            }
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-            mpi_manager.Barrier();
-
-            if (mpi_manager.getRank() == i) {
-                color = 1;
-                if (localCSRMatrix.getValues().size() == 0) {
-                    d_tmp->zeroInit();
-                }
-            }
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-            mpi_manager.Barrier();
-
-            auto new_mpi_manager =
-                mpi_manager.split(color, mpi_manager.getRank());
-            int reduce_root_rank = -1;
-
-            if (mpi_manager.getRank() == i) {
-                reduce_root_rank = new_mpi_manager.getRank();
-            }
-
-            mpi_manager.template Bcast<int>(reduce_root_rank, i);
-
-            if (new_mpi_manager.getComm() != MPI_COMM_NULL) {
-                new_mpi_manager.template Reduce<CFP_t>(
-                    d_tmp->getData(), d_sv_prime->getData(), length_local,
-                    reduce_root_rank, "sum");
+        // Fetch the remote segments referenced by the row blocks, one shifted
+        // pair of ranks at a time. Segments nobody needs are not sent.
+        DataBuffer<CFP_t, int> d_empty{0, dev_tag, true};
+        DataBuffer<CFP_t, int> d_remote{local_num_rows, dev_tag, true};
+        for (size_t shift = 1; shift < num_ranks; shift++) {
+            const size_t dest = (rank + shift) % num_ranks;
+            const size_t source = (rank + num_ranks - shift) % num_ranks;
+            auto &sendBuf = all_needed[dest * num_ranks + rank]
+                                ? sv.getDataBuffer()
+                                : d_empty;
+            auto &recvBuf = needed[source] ? d_remote : d_empty;
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(dev_tag.getStreamID()));
+            mpi_manager.template Sendrecv<CFP_t>(sendBuf, dest, recvBuf,
+                                                 source);
+            if (needed[source]) {
+                const DeviceMatrixT matrix{blocks[source].getCsrOffsets(),
+                                           blocks[source].getColumns(),
+                                           blocks[source].getValues(),
+                                           dev_tag};
+                sv.applySpMV(matrix, d_remote.getData(), d_sv_prime.getData(),
+                             true);
             }
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-            mpi_manager.Barrier();
         }
-        sv.CopyGpuDataToGpuIn(d_sv_prime->getData(), d_sv_prime->getLength());
-        mpi_manager.Barrier();
+        sv.CopyGpuDataToGpuIn(d_sv_prime.getData(), d_sv_prime.getLength());
     }
 
     [[nodiscard]] auto getObsName() const -> std::string override {
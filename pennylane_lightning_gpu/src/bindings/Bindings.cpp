@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <set>
+#include <span>
 #include <tuple>
 #include <variant>
 #include <vector>
@@ -57,6 +58,46 @@ using std::vector;
 
 namespace py = pybind11;
 
+/**
+ * @brief View of a flat op stream over NumPy buffers. The buffers are only
+ * copied if their dtype or layout differ from the stream's.
+ *
+ * @tparam PrecisionT Precision of the parameters and matrices.
+ * @param extra_names Names of the operations whose op codes follow the
+ * fixed op codes of `getOpStreamGateNames()`.
+ */
+template <class PrecisionT>
+auto createOpStream(
+    const std::vector<std::string> &extra_names,
+    const py::array_t<int64_t, py::array::c_style | py::array::forcecast>
+        &op_codes,
+    const py::array_t<int64_t, py::array::c_style | py::array::forcecast>
+        &wire_offsets,
+    const py::array_t<int64_t, py::array::c_style | py::array::forcecast>
+        &wires,
+    const py::array_t<int64_t, py::array::c_style | py::array::forcecast>
+        &param_offsets,
+    const py::array_t<PrecisionT, py::array::c_style | py::array::forcecast>
+        &params,
+    const py::array_t<bool, py::array::c_style | py::array::forcecast>
+        &inverses,
+    const py::array_t<int64_t, py::array::c_style | py::array::forcecast>
+        &matrix_offsets,
+    const py::array_t<std::complex<PrecisionT>,
+                      py::array::c_style | py::array::forcecast> &matrices)
+    -> OpStream<PrecisionT> {
+    std::vector<std::string> names = getOpStreamGateNames();
+    names.insert(names.end(), extra_names.begin(), extra_names.end());
+    const auto view = [](const auto &arr) {
+        return std::span{arr.data(), static_cast<size_t>(arr.size())};
+    };
+    return OpStream<PrecisionT>(std::move(names), view(op_codes),
+                                view(wire_offsets), view(wires),
+                                view(param_offsets), view(params),
+                                view(inverses), view(matrix_offsets),
+                                view(matrices));
+}
+
 /**
  * @brief Templated class to build all required precisions for Python module.
  *
@@ -70,6 +111,10 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
         py::array_t<ParamT, py::array::c_style | py::array::forcecast>;
     using np_arr_c = py::array_t<std::complex<ParamT>,
                                  py::array::c_style | py::array::forcecast>;
+    using np_arr_i64 =
+        py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+    using np_arr_b =
+        py::array_t<bool, py::array::c_style | py::array::forcecast>;
     using np_arr_sparse_ind = typename std::conditional<
         std::is_same<ParamT, float>::value,
         py::array_t<int32_t, py::array::c_style | py::array::forcecast>,
@@ -525,6 +570,15 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
             },
             "Calculate the expectation value of a Hamiltonian composed solely "
             "from sums of Pauli-words")
+        .def(
+            "Variance",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const ObservableGPU<PrecisionT> &ob) {
+                return sv.variance(ob);
+            },
+            "Calculate the variance of the given observable, computing both "
+            "moments from a single reduction or a single application of the "
+            "observable.")
         .def(
             "Probability",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -533,48 +587,120 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
             },
             "Calculate the probabilities for given wires. Results returned in "
             "Col-major order.")
-        .def("GenerateSamples",
-             [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_wires,
-                size_t num_shots) {
-                 auto &&result = sv.generate_samples(num_shots);
-                 const size_t ndim = 2;
-                 const std::vector<size_t> shape{num_shots, num_wires};
-                 constexpr auto sz = sizeof(size_t);
-                 const std::vector<size_t> strides{sz * num_wires, sz};
-                 // return 2-D NumPy array
-                 return py::array(py::buffer_info(
-                     result.data(), /* data as contiguous array  */
-                     sz,            /* size of one scalar        */
-                     py::format_descriptor<size_t>::format(), /* data type */
-                     ndim,   /* number of dimensions      */
-                     shape,  /* shape of the matrix       */
-                     strides /* strides for each axis     */
-                     ));
-             })
+        .def(
+            "Probability",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const std::vector<std::size_t> &wires,
+               const std::vector<std::size_t> &condition_wires,
+               const std::vector<std::size_t> &condition_bits) {
+                return py::array_t<ParamT>(py::cast(
+                    sv.probability(wires, condition_wires, condition_bits)));
+            },
+            "Calculate the probabilities for given wires, conditioned on the "
+            "condition wires having the given bits. Results returned in "
+            "Col-major order.")
+        .def("Measure", &StateVectorCudaManaged<PrecisionT>::measure,
+             "Measure a wire, collapse the state onto the outcome and "
+             "return the outcome.")
+        .def("Collapse", &StateVectorCudaManaged<PrecisionT>::collapse,
+             "Project a wire onto the given outcome and renormalize.")
+        .def("Reset", &StateVectorCudaManaged<PrecisionT>::reset,
+             "Reset a wire to the zero state.")
+        .def("MeasurementOutcomes",
+             &StateVectorCudaManaged<PrecisionT>::getMeasurementOutcomes,
+             "Get the outcomes of the mid-circuit measurements.")
+        .def("SeedMeasurements",
+             &StateVectorCudaManaged<PrecisionT>::seedMeasurements,
+             "Seed the random number generator of mid-circuit measurements.")
+        .def(
+            "ApplyOpStream",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const std::vector<std::string> &extra_names,
+               const np_arr_i64 &op_codes, const np_arr_i64 &wire_offsets,
+               const np_arr_i64 &wires, const np_arr_i64 &param_offsets,
+               const np_arr_r &params, const np_arr_b &inverses,
+               const np_arr_i64 &matrix_offsets, const np_arr_c &matrices) {
+                sv.applyOperation(createOpStream<PrecisionT>(
+                    extra_names, op_codes, wire_offsets, wires, param_offsets,
+                    params, inverses, matrix_offsets, matrices));
+            },
+            "Apply the operations of a flat op stream, reading its buffers "
+            "in place.")
+        .def(
+            "GenerateSamples",
+            [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_wires,
+               size_t num_shots, const std::string &mode) -> py::object {
+                if (mode == "packed") {
+                    return py::array_t<std::uint64_t>(
+                        py::cast(sv.generate_samples_packed(num_shots)));
+                }
+                if (mode == "counts") {
+                    const auto counts = sv.generate_counts(num_shots);
+                    py::array_t<std::uint64_t> bit_strings(counts.size());
+                    py::array_t<std::size_t> occurrences(counts.size());
+                    auto bit_strings_view = bit_strings.mutable_unchecked<1>();
+                    auto occurrences_view = occurrences.mutable_unchecked<1>();
+                    for (std::size_t i = 0; i < counts.size(); i++) {
+                        bit_strings_view(i) = counts[i].first;
+                        occurrences_view(i) = counts[i].second;
+                    }
+                    return py::make_tuple(bit_strings, occurrences);
+                }
+                PL_ABORT_IF_NOT(mode == "unpacked",
+                                "Sample mode must be one of 'unpacked', "
+                                "'packed' or 'counts'.");
+                auto &&result = sv.generate_samples(num_shots);
+                const size_t ndim = 2;
+                const std::vector<size_t> shape{num_shots, num_wires};
+                constexpr auto sz = sizeof(size_t);
+                const std::vector<size_t> strides{sz * num_wires, sz};
+                // return 2-D NumPy array
+                return py::array(py::buffer_info(
+                    result.data(), /* data as contiguous array  */
+                    sz,            /* size of one scalar        */
+                    py::format_descriptor<size_t>::format(), /* data type */
+                    ndim,   /* number of dimensions      */
+                    shape,  /* shape of the matrix       */
+                    strides /* strides for each axis     */
+                    ));
+            },
+            py::arg("num_wires"), py::arg("num_shots"),
+            py::arg("mode") = "unpacked",
+            "Sample the state. The 'unpacked' mode returns one row of wire "
+            "values per shot, 'packed' one integer per shot with wire 0 as "
+            "the most significant bit, and 'counts' a tuple of distinct "
+            "packed samples and their number of occurrences.")
         .def(
             "DeviceToDevice",
             [](StateVectorCudaManaged<PrecisionT> &sv,
                const StateVectorCudaManaged<PrecisionT> &other,
                bool async) { sv.updateData(other, async); },
             "Synchronize data from another GPU device to current device.")
-        .def("DeviceToHost",
-             py::overload_cast<StateVectorLQubitManaged<PrecisionT> &, bool>(
-                 &StateVectorCudaManaged<PrecisionT>::CopyGpuDataToHost,
-                 py::const_),
-             "Synchronize data from the GPU device to host.")
-        .def("DeviceToHost",
-             py::overload_cast<std::complex<PrecisionT> *, size_t, bool>(
-                 &StateVectorCudaManaged<PrecisionT>::CopyGpuDataToHost,
-                 py::const_),
-             "Synchronize data from the GPU device to host.")
         .def(
             "DeviceToHost",
-            [](const StateVectorCudaManaged<PrecisionT> &gpu_sv,
-               np_arr_c &cpu_sv, bool) {
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv,
+               StateVectorLQubitManaged<PrecisionT> &cpu_sv, bool async) {
+                gpu_sv.applyQubitMap();
+                gpu_sv.CopyGpuDataToHost(cpu_sv, async);
+            },
+            "Synchronize data from the GPU device to host.")
+        .def(
+            "DeviceToHost",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv,
+               std::complex<PrecisionT> *host_sv, size_t length, bool async) {
+                gpu_sv.applyQubitMap();
+                gpu_sv.CopyGpuDataToHost(host_sv, length, async);
+            },
+            "Synchronize data from the GPU device to host.")
+        .def(
+            "DeviceToHost",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv, np_arr_c &cpu_sv,
+               bool) {
                 py::buffer_info numpyArrayInfo = cpu_sv.request();
                 auto *data_ptr =
                     static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
                 if (cpu_sv.size()) {
+                    gpu_sv.applyQubitMap();
                     gpu_sv.CopyGpuDataToHost(data_ptr, cpu_sv.size());
                 }
             },
@@ -753,6 +879,20 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
         .def("__repr__", &SparseHamiltonianGPU<PrecisionT>::getObsName)
         .def("get_wires", &SparseHamiltonianGPU<PrecisionT>::getWires,
              "Get wires of observables")
+        .def(
+            "get_device_matrix_stats",
+            [](const SparseHamiltonianGPU<PrecisionT> &self) {
+                const auto stats = self.getDeviceMatrixStats();
+                py::dict result;
+                result["num_uploads"] = stats.num_uploads;
+                result["num_reuses"] = stats.num_reuses;
+                result["bytes_uploaded"] = stats.bytes_uploaded;
+                result["bytes_saved"] = stats.bytes_saved;
+                result["upload_seconds"] = stats.upload_seconds;
+                result["seconds_saved"] = stats.seconds_saved;
+                return result;
+            },
+            "Get the uploads and reuses of the device-resident CSR matrix.")
         .def(
             "__eq__",
             [](const SparseHamiltonianGPU<PrecisionT> &self,
@@ -838,11 +978,22 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                      ops_name, conv_params, ops_wires, ops_inverses,
                      conv_matrices};
              })
+        .def("create_ops_list_flat",
+             [](AdjointJacobianGPU<PrecisionT> &adj,
+                const std::vector<std::string> &extra_names,
+                const np_arr_i64 &op_codes, const np_arr_i64 &wire_offsets,
+                const np_arr_i64 &wires, const np_arr_i64 &param_offsets,
+                const np_arr_r &params, const np_arr_b &inverses,
+                const np_arr_i64 &matrix_offsets, const np_arr_c &matrices) {
+                 return adj.createOpsData(createOpStream<PrecisionT>(
+                     extra_names, op_codes, wire_offsets, wires, param_offsets,
+                     params, inverses, matrix_offsets, matrices));
+             })
         .def("adjoint_jacobian",
              &AdjointJacobianGPU<PrecisionT>::adjointJacobian)
         .def("adjoint_jacobian",
              [](AdjointJacobianGPU<PrecisionT> &adj,
-                const StateVectorCudaManaged<PrecisionT> &sv,
+                StateVectorCudaManaged<PrecisionT> &sv,
                 const std::vector<std::shared_ptr<ObservableGPU<PrecisionT>>>
                     &observables,
                 const Pennylane::Algorithms::OpsData<
@@ -852,6 +1003,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                      observables.size(),
                      std::vector<PrecisionT>(trainableParams.size(), 0));
 
+                 sv.applyQubitMap();
                  adj.adjointJacobian(sv.getData(), sv.getLength(), jac,
                                      observables, operations, trainableParams,
                                      false, sv.getDataBuffer().getDevTag());
@@ -859,7 +1011,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
              })
         .def("adjoint_jacobian_batched",
              [](AdjointJacobianGPU<PrecisionT> &adj,
-                const StateVectorCudaManaged<PrecisionT> &sv,
+                StateVectorCudaManaged<PrecisionT> &sv,
                 const std::vector<std::shared_ptr<ObservableGPU<PrecisionT>>>
                     &observables,
                 const Pennylane::Algorithms::OpsData<
@@ -869,10 +1021,27 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                      observables.size(),
                      std::vector<PrecisionT>(trainableParams.size(), 0));
 
+                 sv.applyQubitMap();
                  adj.batchAdjointJacobian(sv.getData(), sv.getLength(), jac,
                                           observables, operations,
                                           trainableParams, false);
                  return py::array_t<ParamT>(py::cast(jac));
+             })
+        .def("vector_jacobian_product",
+             [](AdjointJacobianGPU<PrecisionT> &adj,
+                StateVectorCudaManaged<PrecisionT> &sv,
+                const std::vector<PrecisionT> &dy,
+                const std::vector<std::shared_ptr<ObservableGPU<PrecisionT>>>
+                    &observables,
+                const Pennylane::Algorithms::OpsData<
+                    StateVectorCudaManaged<PrecisionT>> &operations,
+                const std::vector<size_t> &trainableParams) {
+                 sv.applyQubitMap();
+                 const auto vjp = adj.vectorJacobianProduct(
+                     dy, sv.getData(), sv.getLength(), observables,
+                     operations, trainableParams, false,
+                     sv.getDataBuffer().getDevTag());
+                 return py::array_t<ParamT>(py::cast(vjp));
              });
 }
 
@@ -934,6 +1103,10 @@ void StateVectorCudaMPI_class_bindings(py::module &m) {
         py::array_t<ParamT, py::array::c_style | py::array::forcecast>;
     using np_arr_c = py::array_t<std::complex<ParamT>,
                                  py::array::c_style | py::array::forcecast>;
+    using np_arr_i64 =
+        py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+    using np_arr_b =
+        py::array_t<bool, py::array::c_style | py::array::forcecast>;
     using np_arr_sparse_ind = typename std::conditional<
         std::is_same<ParamT, float>::value,
         py::array_t<int32_t, py::array::c_style | py::array::forcecast>,
@@ -1393,6 +1566,15 @@ void StateVectorCudaMPI_class_bindings(py::module &m) {
             },
             "Calculate the expectation value of a Hamiltonian composed solely "
             "from sums of Pauli-words")
+        .def(
+            "Variance",
+            [](StateVectorCudaMPI<PrecisionT> &sv,
+               const ObservableGPUMPI<PrecisionT> &ob) {
+                return sv.variance(ob);
+            },
+            "Calculate the variance of the given observable, computing both "
+            "moments from a single reduction or a single application of the "
+            "observable.")
         .def(
             "Probability",
             [](StateVectorCudaMPI<PrecisionT> &sv,
@@ -1401,24 +1583,80 @@ void StateVectorCudaMPI_class_bindings(py::module &m) {
             },
             "Calculate the probabilities for given wires. Results returned in "
             "Col-major order.")
-        .def("GenerateSamples",
-             [](StateVectorCudaMPI<PrecisionT> &sv, size_t num_wires,
-                size_t num_shots) {
-                 auto &&result = sv.generate_samples(num_shots);
-                 const size_t ndim = 2;
-                 const std::vector<size_t> shape{num_shots, num_wires};
-                 constexpr auto sz = sizeof(size_t);
-                 const std::vector<size_t> strides{sz * num_wires, sz};
-                 // return 2-D NumPy array
-                 return py::array(py::buffer_info(
-                     result.data(), /* data as contiguous array  */
-                     sz,            /* size of one scalar        */
-                     py::format_descriptor<size_t>::format(), /* data type */
-                     ndim,   /* number of dimensions      */
-                     shape,  /* shape of the matrix       */
-                     strides /* strides for each axis     */
-                     ));
-             })
+        .def(
+            "Probability",
+            [](StateVectorCudaMPI<PrecisionT> &sv,
+               const std::vector<std::size_t> &wires,
+               const std::vector<std::size_t> &condition_wires,
+               const std::vector<std::size_t> &condition_bits) {
+                return py::array_t<ParamT>(py::cast(
+                    sv.probability(wires, condition_wires, condition_bits)));
+            },
+            "Calculate the probabilities for given wires, conditioned on the "
+            "condition wires having the given bits. Results returned in "
+            "Col-major order.")
+        .def("Measure", &StateVectorCudaMPI<PrecisionT>::measure,
+             "Measure a wire, collapse the state onto the outcome and "
+             "return the outcome.")
+        .def("Collapse", &StateVectorCudaMPI<PrecisionT>::collapse,
+             "Project a wire onto the given outcome and renormalize.")
+        .def("Reset", &StateVectorCudaMPI<PrecisionT>::reset,
+             "Reset a wire to the zero state.")
+        .def("MeasurementOutcomes",
+             &StateVectorCudaMPI<PrecisionT>::getMeasurementOutcomes,
+             "Get the outcomes of the mid-circuit measurements.")
+        .def("SeedMeasurements",
+             &StateVectorCudaMPI<PrecisionT>::seedMeasurements,
+             "Seed the random number generator of mid-circuit measurements.")
+        .def("SetPipelinedSwaps",
+             &StateVectorCudaMPI<PrecisionT>::setPipelinedSwaps,
+             "Overlap the index bit swaps of global-wire gates with the gates "
+             "(enabled by default). Disabling it synchronizes all ranks after "
+             "every swap batch.")
+        .def(
+            "GenerateSamples",
+            [](StateVectorCudaMPI<PrecisionT> &sv, size_t num_wires,
+               size_t num_shots, const std::string &mode) -> py::object {
+                if (mode == "packed") {
+                    return py::array_t<std::uint64_t>(
+                        py::cast(sv.generate_samples_packed(num_shots)));
+                }
+                if (mode == "counts") {
+                    const auto counts = sv.generate_counts(num_shots);
+                    py::array_t<std::uint64_t> bit_strings(counts.size());
+                    py::array_t<std::size_t> occurrences(counts.size());
+                    auto bit_strings_view = bit_strings.mutable_unchecked<1>();
+                    auto occurrences_view = occurrences.mutable_unchecked<1>();
+                    for (std::size_t i = 0; i < counts.size(); i++) {
+                        bit_strings_view(i) = counts[i].first;
+                        occurrences_view(i) = counts[i].second;
+                    }
+                    return py::make_tuple(bit_strings, occurrences);
+                }
+                PL_ABORT_IF_NOT(mode == "unpacked",
+                                "Sample mode must be one of 'unpacked', "
+                                "'packed' or 'counts'.");
+                auto &&result = sv.generate_samples(num_shots);
+                const size_t ndim = 2;
+                const std::vector<size_t> shape{num_shots, num_wires};
+                constexpr auto sz = sizeof(size_t);
+                const std::vector<size_t> strides{sz * num_wires, sz};
+                // return 2-D NumPy array
+                return py::array(py::buffer_info(
+                    result.data(), /* data as contiguous array  */
+                    sz,            /* size of one scalar        */
+                    py::format_descriptor<size_t>::format(), /* data type */
+                    ndim,   /* number of dimensions      */
+                    shape,  /* shape of the matrix       */
+                    strides /* strides for each axis     */
+                    ));
+            },
+            py::arg("num_wires"), py::arg("num_shots"),
+            py::arg("mode") = "unpacked",
+            "Sample the state. The 'unpacked' mode returns one row of wire "
+            "values per shot, 'packed' one integer per shot with wire 0 as "
+            "the most significant bit, and 'counts' a tuple of distinct "
+            "packed samples and their number of occurrences.")
         .def(
             "DeviceToDevice",
             [](StateVectorCudaMPI<PrecisionT> &sv,
@@ -1427,22 +1665,29 @@ void StateVectorCudaMPI_class_bindings(py::module &m) {
             "Synchronize data from another GPU device to current device.")
         .def(
             "DeviceToHost",
-            py::overload_cast<StateVectorLQubitManaged<PrecisionT> &, bool>(
-                &StateVectorCudaMPI<PrecisionT>::CopyGpuDataToHost, py::const_),
+            [](StateVectorCudaMPI<PrecisionT> &gpu_sv,
+               StateVectorLQubitManaged<PrecisionT> &cpu_sv, bool async) {
+                gpu_sv.applyQubitMap();
+                gpu_sv.CopyGpuDataToHost(cpu_sv, async);
+            },
             "Synchronize data from the GPU device to host.")
         .def(
             "DeviceToHost",
-            py::overload_cast<std::complex<PrecisionT> *, size_t, bool>(
-                &StateVectorCudaMPI<PrecisionT>::CopyGpuDataToHost, py::const_),
+            [](StateVectorCudaMPI<PrecisionT> &gpu_sv,
+               std::complex<PrecisionT> *host_sv, size_t length, bool async) {
+                gpu_sv.applyQubitMap();
+                gpu_sv.CopyGpuDataToHost(host_sv, length, async);
+            },
             "Synchronize data from the GPU device to host.")
         .def(
             "DeviceToHost",
-            [](const StateVectorCudaMPI<PrecisionT> &gpu_sv, np_arr_c &cpu_sv,
+            [](StateVectorCudaMPI<PrecisionT> &gpu_sv, np_arr_c &cpu_sv,
                bool) {
                 py::buffer_info numpyArrayInfo = cpu_sv.request();
                 auto *data_ptr =
                     static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
                 if (cpu_sv.size()) {
+                    gpu_sv.applyQubitMap();
                     gpu_sv.CopyGpuDataToHost(data_ptr, cpu_sv.size());
                 }
             },
@@ -1682,12 +1927,23 @@ void StateVectorCudaMPI_class_bindings(py::module &m) {
                      ops_name, conv_params, ops_wires, ops_inverses,
                      conv_matrices};
              })
+        .def("create_ops_list_flat",
+             [](AdjointJacobianGPUMPI<PrecisionT, StateVectorCudaMPI> &adj,
+                const std::vector<std::string> &extra_names,
+                const np_arr_i64 &op_codes, const np_arr_i64 &wire_offsets,
+                const np_arr_i64 &wires, const np_arr_i64 &param_offsets,
+                const np_arr_r &params, const np_arr_b &inverses,
+                const np_arr_i64 &matrix_offsets, const np_arr_c &matrices) {
+                 return adj.createOpsData(createOpStream<PrecisionT>(
+                     extra_names, op_codes, wire_offsets, wires, param_offsets,
+                     params, inverses, matrix_offsets, matrices));
+             })
         .def("adjoint_jacobian",
              &AdjointJacobianGPUMPI<PrecisionT,
                                     StateVectorCudaMPI>::adjointJacobian)
         .def("adjoint_jacobian",
              [](AdjointJacobianGPUMPI<PrecisionT, StateVectorCudaMPI> &adj,
-                const StateVectorCudaMPI<PrecisionT> &sv,
+                StateVectorCudaMPI<PrecisionT> &sv,
                 const std::vector<std::shared_ptr<ObservableGPUMPI<PrecisionT>>>
                     &observables,
                 const Pennylane::Algorithms::OpsData<
@@ -1697,13 +1953,14 @@ void StateVectorCudaMPI_class_bindings(py::module &m) {
                      observables.size(),
                      std::vector<PrecisionT>(trainableParams.size(), 0));
 
+                 sv.applyQubitMap();
                  adj.adjointJacobian(sv, jac, observables, operations,
                                      trainableParams, false);
                  return py::array_t<ParamT>(py::cast(jac));
              })
         .def("adjoint_jacobian_serial",
              [](AdjointJacobianGPUMPI<PrecisionT, StateVectorCudaMPI> &adj,
-                const StateVectorCudaMPI<PrecisionT> &sv,
+                StateVectorCudaMPI<PrecisionT> &sv,
                 const std::vector<std::shared_ptr<ObservableGPUMPI<PrecisionT>>>
                     &observables,
                 const Pennylane::Algorithms::OpsData<
@@ -1713,6 +1970,7 @@ void StateVectorCudaMPI_class_bindings(py::module &m) {
                      observables.size(),
                      std::vector<PrecisionT>(trainableParams.size(), 0));
 
+                 sv.applyQubitMap();
                  adj.adjointJacobian_serial(sv, jac, observables, operations,
                                             trainableParams, false);
                  return py::array_t<ParamT>(py::cast(jac));
@@ -1745,6 +2003,9 @@ PYBIND11_MODULE(lightning_gpu_qubit_ops, // NOLINT: No control over
           "support for the PennyLane-Lightning-GPU device.");
     m.def("get_gpu_arch", &getGPUArch, py::arg("device_number") = 0,
           "Returns the given GPU major and minor GPU support.");
+    m.def("op_stream_gate_names", &getOpStreamGateNames,
+          "Names of the operations with a fixed op code in flat op streams, "
+          "indexed by op code.");
     py::class_<DevicePool<int>>(m, "DevPool")
         .def(py::init<>())
         .def("getActiveDevices", &DevicePool<int>::getActiveDevices)
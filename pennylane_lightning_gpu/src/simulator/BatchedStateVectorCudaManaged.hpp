@@ -0,0 +1,481 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file BatchedStateVectorCudaManaged.hpp
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <cuComplex.h>
+#include <cuda_runtime_api.h>
+#include <custatevec.h>
+
+#include "CudaWorkspaceAllocator.hpp"
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "Error.hpp"
+#include "Util.hpp"
+#include "WorkspaceArena.hpp"
+#include "cuGates_host.hpp"
+#include "cuda_helpers.hpp"
+
+/// @cond DEV
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+using namespace Pennylane::CUDA;
+} // namespace
+/// @endcond
+
+namespace Pennylane {
+
+/**
+ * @brief A batch of independent state vectors of the same number of qubits,
+ * stored contiguously in a single device allocation.
+ *
+ * Gates and reductions use the batched custatevec API, so a single call
+ * covers every state vector of the batch. Gate matrices are either shared by
+ * the whole batch or given per state vector, e.g. for broadcasted
+ * parameters.
+ *
+ * @tparam Precision Floating-point precision type.
+ */
+template <class Precision> class BatchedStateVectorCudaManaged {
+  public:
+    using PrecisionT = Precision;
+    using ComplexT = std::complex<PrecisionT>;
+    using CFP_t = decltype(cuUtil::getCudaType(PrecisionT{}));
+
+    /**
+     * @brief Construct a batch of state vectors, each initialized to
+     * \f$\vert 0 \rangle\f$.
+     *
+     * @param batch_size Number of state vectors.
+     * @param num_qubits Number of qubits of each state vector.
+     * @param dev_tag Device and stream holding the batch.
+     * @param cusvhandle_in custatevec handle used for every call.
+     */
+    BatchedStateVectorCudaManaged(
+        std::size_t batch_size, std::size_t num_qubits,
+        const DevTag<int> &dev_tag = {0, 0},
+        SharedCusvHandle cusvhandle_in = make_shared_cusv_handle())
+        : batch_size_{batch_size}, num_qubits_{num_qubits},
+          data_buffer_{batch_size * Util::exp2(num_qubits), dev_tag, true},
+          handle_{std::move(cusvhandle_in)},
+          workspace_{std::make_unique<cuUtil::CudaWorkspaceAllocator>(
+              data_buffer_.getDevTag())} {
+        PL_ABORT_IF(batch_size == 0, "The batch must not be empty.");
+        initSV();
+    }
+
+    BatchedStateVectorCudaManaged(const BatchedStateVectorCudaManaged &) =
+        delete;
+    BatchedStateVectorCudaManaged &
+    operator=(const BatchedStateVectorCudaManaged &) = delete;
+
+    [[nodiscard]] auto getBatchSize() const -> std::size_t {
+        return batch_size_;
+    }
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return num_qubits_;
+    }
+    /// Number of elements of each state vector of the batch.
+    [[nodiscard]] auto getLength() const -> std::size_t {
+        return Util::exp2(num_qubits_);
+    }
+    [[nodiscard]] auto getData() const -> const CFP_t * {
+        return data_buffer_.getData();
+    }
+    [[nodiscard]] auto getData() -> CFP_t * { return data_buffer_.getData(); }
+    [[nodiscard]] auto getDataBuffer() const -> const DataBuffer<CFP_t> & {
+        return data_buffer_;
+    }
+
+    /**
+     * @brief Reset every state vector of the batch to \f$\vert 0 \rangle\f$.
+     */
+    void initSV() {
+        data_buffer_.zeroInit();
+        // One strided copy places the leading amplitude of every state.
+        const std::vector<CFP_t> ones(batch_size_, cuUtil::ONE<CFP_t>());
+        PL_CUDA_IS_SUCCESS(cudaMemcpy2D(
+            data_buffer_.getData(), getLength() * sizeof(CFP_t), ones.data(),
+            sizeof(CFP_t), sizeof(CFP_t), batch_size_,
+            cudaMemcpyHostToDevice));
+    }
+
+    /**
+     * @brief Copy the whole batch from the host. State vector `b` occupies
+     * elements `[b * getLength(), (b + 1) * getLength())`.
+     *
+     * @param host_sv Host data of `getBatchSize() * getLength()` elements.
+     * @param length Number of elements.
+     * @param async Use an asynchronous copy.
+     */
+    void CopyHostDataToGpu(const ComplexT *host_sv, std::size_t length,
+                           bool async = false) {
+        data_buffer_.CopyHostDataToGpu(host_sv, length, async);
+    }
+
+    /**
+     * @brief Copy the whole batch to the host, in the layout of
+     * `CopyHostDataToGpu`.
+     *
+     * @param host_sv Host data of `getBatchSize() * getLength()` elements.
+     * @param length Number of elements.
+     * @param async Use an asynchronous copy.
+     */
+    void CopyGpuDataToHost(ComplexT *host_sv, std::size_t length,
+                           bool async = false) const {
+        data_buffer_.CopyGpuDataToHost(host_sv, length, async);
+    }
+
+    /**
+     * @brief Apply a named gate to every state vector of the batch.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires the gate acts on, controls included.
+     * @param adjoint Indicates whether to use the adjoint of the gate.
+     * @param params Gate parameters. Either empty or a single parameter set
+     * shared by the batch, or one parameter set per state vector. Each set
+     * holds exactly the parameters of the gate.
+     */
+    void
+    applyOperation(const std::string &opName,
+                   const std::vector<std::size_t> &wires, bool adjoint = false,
+                   const std::vector<std::vector<PrecisionT>> &params = {}) {
+        const auto &gates = cuGates::getDenseGateMap<CFP_t, PrecisionT>();
+        const auto gate_it = gates.find(opName);
+        PL_ABORT_IF(gate_it == gates.end(),
+                    "The gate is not supported by the batched state vector.");
+        PL_ABORT_IF_NOT(params.size() <= 1 || params.size() == batch_size_,
+                        "Parameters must be shared by the batch or given for "
+                        "each state vector.");
+        const std::size_t dim = Util::exp2(wires.size());
+
+        if (params.size() <= 1) {
+            const std::vector<PrecisionT> shared =
+                params.empty() ? std::vector<PrecisionT>{} : params.front();
+            const auto matrix = gate_it->second(shared);
+            PL_ABORT_IF_NOT(matrix.size() == dim * dim,
+                            "The gate does not match the number of wires.");
+            applyDeviceMatrices(matrix, 1, wires, adjoint);
+            return;
+        }
+
+        std::vector<CFP_t> matrices;
+        matrices.reserve(batch_size_ * dim * dim);
+        for (const auto &param : params) {
+            const auto matrix = gate_it->second(param);
+            PL_ABORT_IF_NOT(matrix.size() == dim * dim,
+                            "The gate does not match the number of wires.");
+            matrices.insert(matrices.end(), matrix.begin(), matrix.end());
+        }
+        applyDeviceMatrices(matrices, batch_size_, wires, adjoint);
+    }
+
+    /**
+     * @brief Apply dense row-major matrices to the batch.
+     *
+     * @param matrices One matrix shared by the batch, or `getBatchSize()`
+     * matrices stored one after the other.
+     * @param wires Wires the matrices act on.
+     * @param adjoint Indicates whether to use the adjoint of the matrices.
+     */
+    void applyMatrix(const std::vector<ComplexT> &matrices,
+                     const std::vector<std::size_t> &wires,
+                     bool adjoint = false) {
+        const std::size_t dim = Util::exp2(wires.size());
+        const std::size_t num_matrices = matrices.size() / (dim * dim);
+        PL_ABORT_IF_NOT(
+            num_matrices * dim * dim == matrices.size() &&
+                (num_matrices == 1 || num_matrices == batch_size_),
+            "Matrices must be shared by the batch or given for each state "
+            "vector.");
+        std::vector<CFP_t> matrices_cu(matrices.size());
+        std::transform(matrices.begin(), matrices.end(), matrices_cu.begin(),
+                       [](const ComplexT &x) {
+                           return cuUtil::complexToCu<ComplexT>(x);
+                       });
+        applyDeviceMatrices(matrices_cu, num_matrices, wires, adjoint);
+    }
+
+    /**
+     * @brief Probabilities of each computational basis state of the given
+     * wires, for every state vector of the batch.
+     *
+     * @param wires Wires to return probabilities for in lexicographical
+     * order.
+     * @return std::vector<std::vector<double>> One row per state vector.
+     */
+    auto probability(const std::vector<std::size_t> &wires)
+        -> std::vector<std::vector<double>> {
+        const std::size_t num_probs = Util::exp2(wires.size());
+        std::vector<double> probs_flat(batch_size_ * num_probs);
+        const auto wires_int = toCuQuantumWires(wires);
+
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecAbs2SumArrayBatched(
+            /* custatevecHandle_t */ handle_.get(),
+            /* const void* */ getData(),
+            /* cudaDataType_t */ getDataType(),
+            /* const uint32_t */ num_qubits_,
+            /* const uint32_t */ batch_size_,
+            /* const custatevecIndex_t */ getLength(),
+            /* double* */ probs_flat.data(),
+            /* const custatevecIndex_t */ num_probs,
+            /* const int32_t* */ wires_int.data(),
+            /* const uint32_t */ wires_int.size(),
+            /* const custatevecIndex_t* */ nullptr,
+            /* const int32_t* */ nullptr,
+            /* const uint32_t */ 0));
+
+        std::vector<std::vector<double>> probs(batch_size_);
+        for (std::size_t b = 0; b < batch_size_; b++) {
+            probs[b].assign(probs_flat.begin() + b * num_probs,
+                            probs_flat.begin() + (b + 1) * num_probs);
+        }
+        return probs;
+    }
+
+    /**
+     * @brief Expectation value of a dense observable for every state vector
+     * of the batch.
+     *
+     * @param matrix Row-major matrix of the observable.
+     * @param wires Wires the observable acts on.
+     * @return std::vector<PrecisionT> One value per state vector.
+     */
+    auto expval(const std::vector<ComplexT> &matrix,
+                const std::vector<std::size_t> &wires)
+        -> std::vector<PrecisionT> {
+        const std::size_t dim = Util::exp2(wires.size());
+        PL_ABORT_IF_NOT(matrix.size() == dim * dim,
+                        "The matrix does not match the number of wires.");
+        std::vector<CFP_t> matrix_cu(matrix.size());
+        std::transform(matrix.begin(), matrix.end(), matrix_cu.begin(),
+                       [](const ComplexT &x) {
+                           return cuUtil::complexToCu<ComplexT>(x);
+                       });
+        return getExpectationValueBatched(matrix_cu, wires);
+    }
+
+    /**
+     * @brief Expectation value of a named observable for every state vector
+     * of the batch.
+     *
+     * @param obsName Name of the observable.
+     * @param wires Wires the observable acts on.
+     * @param params Parameters of the observable, if any.
+     * @return std::vector<PrecisionT> One value per state vector.
+     */
+    auto expval(const std::string &obsName,
+                const std::vector<std::size_t> &wires,
+                const std::vector<PrecisionT> &params = {})
+        -> std::vector<PrecisionT> {
+        const auto &gates = cuGates::getDenseGateMap<CFP_t, PrecisionT>();
+        const auto gate_it = gates.find(obsName);
+        PL_ABORT_IF(gate_it == gates.end(),
+                    "The observable is not supported by the batched state "
+                    "vector.");
+        const auto matrix = gate_it->second(params);
+        const std::size_t dim = Util::exp2(wires.size());
+        PL_ABORT_IF_NOT(matrix.size() == dim * dim,
+                        "The observable does not match the number of wires.");
+        return getExpectationValueBatched(matrix, wires);
+    }
+
+  private:
+    std::size_t batch_size_;
+    std::size_t num_qubits_;
+    DataBuffer<CFP_t> data_buffer_;
+    SharedCusvHandle handle_;
+    // Scratch memory shared by every custatevec call requiring a workspace.
+    cuUtil::WorkspaceArena workspace_;
+    // Device copy of the per-batch gate matrices, grown as needed.
+    std::unique_ptr<DataBuffer<CFP_t>> matrix_buffer_;
+
+    [[nodiscard]] static auto getDataType() -> cudaDataType_t {
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            return CUDA_C_64F;
+        } else {
+            return CUDA_C_32F;
+        }
+    }
+
+    [[nodiscard]] static auto getComputeType() -> custatevecComputeType_t {
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            return CUSTATEVEC_COMPUTE_64F;
+        } else {
+            return CUSTATEVEC_COMPUTE_32F;
+        }
+    }
+
+    /**
+     * @brief Transform indices between PL & cuQuantum ordering.
+     */
+    [[nodiscard]] auto
+    toCuQuantumWires(const std::vector<std::size_t> &wires) const
+        -> std::vector<int> {
+        std::vector<int> wires_int(wires.size());
+        std::transform(wires.begin(), wires.end(), wires_int.begin(),
+                       [&](std::size_t x) {
+                           return static_cast<int>(num_qubits_ - 1 - x);
+                       });
+        return wires_int;
+    }
+
+    /**
+     * @brief Apply host matrices to the batch with a single custatevec call.
+     *
+     * @param matrices Row-major matrices stored one after the other.
+     * @param num_matrices Either 1 (broadcast) or the batch size.
+     * @param wires Wires the matrices act on.
+     * @param adjoint Indicates whether to use the adjoint of the matrices.
+     */
+    void applyDeviceMatrices(const std::vector<CFP_t> &matrices,
+                             std::size_t num_matrices,
+                             const std::vector<std::size_t> &wires,
+                             bool adjoint) {
+        if (!matrix_buffer_ || matrix_buffer_->getLength() < matrices.size()) {
+            matrix_buffer_ = std::make_unique<DataBuffer<CFP_t>>(
+                matrices.size(), data_buffer_.getDevTag(), true);
+        }
+        PL_CUDA_IS_SUCCESS(cudaMemcpy(matrix_buffer_->getData(),
+                                      matrices.data(),
+                                      sizeof(CFP_t) * matrices.size(),
+                                      cudaMemcpyHostToDevice));
+
+        // Wire order reversed to match the custatevec matrix ordering
+        const auto tgts_int = toCuQuantumWires({wires.rbegin(), wires.rend()});
+        const auto map_type = (num_matrices == 1)
+                                  ? CUSTATEVEC_MATRIX_MAP_TYPE_BROADCAST
+                                  : CUSTATEVEC_MATRIX_MAP_TYPE_MATRIX_INDEXED;
+        // Matrix b is applied to state vector b when indexed
+        std::vector<int32_t> matrix_indices_host;
+        if (num_matrices > 1) {
+            matrix_indices_host.resize(batch_size_);
+            std::iota(matrix_indices_host.begin(), matrix_indices_host.end(),
+                      0);
+        }
+        const int32_t *matrix_indices =
+            matrix_indices_host.empty() ? nullptr : matrix_indices_host.data();
+        std::size_t extraWorkspaceSizeInBytes = 0;
+
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrixBatchedGetWorkspaceSize(
+            /* custatevecHandle_t */ handle_.get(),
+            /* cudaDataType_t */ getDataType(),
+            /* const uint32_t */ num_qubits_,
+            /* const uint32_t */ batch_size_,
+            /* const custatevecIndex_t */ getLength(),
+            /* custatevecMatrixMapType_t */ map_type,
+            /* const int32_t* */ matrix_indices,
+            /* const void* */ matrix_buffer_->getData(),
+            /* cudaDataType_t */ getDataType(),
+            /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+            /* const int32_t */ adjoint,
+            /* const uint32_t */ num_matrices,
+            /* const uint32_t */ tgts_int.size(),
+            /* const uint32_t */ 0,
+            /* custatevecComputeType_t */ getComputeType(),
+            /* size_t* */ &extraWorkspaceSizeInBytes));
+
+        void *extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
+
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrixBatched(
+            /* custatevecHandle_t */ handle_.get(),
+            /* void* */ getData(),
+            /* cudaDataType_t */ getDataType(),
+            /* const uint32_t */ num_qubits_,
+            /* const uint32_t */ batch_size_,
+            /* custatevecIndex_t */ getLength(),
+            /* custatevecMatrixMapType_t */ map_type,
+            /* const int32_t* */ matrix_indices,
+            /* const void* */ matrix_buffer_->getData(),
+            /* cudaDataType_t */ getDataType(),
+            /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+            /* const int32_t */ adjoint,
+            /* const uint32_t */ num_matrices,
+            /* const int32_t* */ tgts_int.data(),
+            /* const uint32_t */ tgts_int.size(),
+            /* const int32_t* */ nullptr,
+            /* const int32_t* */ nullptr,
+            /* const uint32_t */ 0,
+            /* custatevecComputeType_t */ getComputeType(),
+            /* void* */ extraWorkspace,
+            /* size_t */ extraWorkspaceSizeInBytes));
+    }
+
+    /**
+     * @brief Expectation value of a host matrix for every state vector of
+     * the batch, with a single custatevec call.
+     */
+    auto getExpectationValueBatched(const std::vector<CFP_t> &matrix,
+                                    const std::vector<std::size_t> &wires)
+        -> std::vector<PrecisionT> {
+        // Wire order reversed to match the custatevec matrix ordering
+        const auto tgts_int = toCuQuantumWires({wires.rbegin(), wires.rend()});
+        std::size_t extraWorkspaceSizeInBytes = 0;
+
+        PL_CUSTATEVEC_IS_SUCCESS(
+            custatevecComputeExpectationBatchedGetWorkspaceSize(
+                /* custatevecHandle_t */ handle_.get(),
+                /* cudaDataType_t */ getDataType(),
+                /* const uint32_t */ num_qubits_,
+                /* const uint32_t */ batch_size_,
+                /* const custatevecIndex_t */ getLength(),
+                /* const void* */ matrix.data(),
+                /* cudaDataType_t */ getDataType(),
+                /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+                /* const uint32_t */ 1,
+                /* const uint32_t */ tgts_int.size(),
+                /* custatevecComputeType_t */ getComputeType(),
+                /* size_t* */ &extraWorkspaceSizeInBytes));
+
+        void *extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
+
+        std::vector<double2> expect(batch_size_);
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectationBatched(
+            /* custatevecHandle_t */ handle_.get(),
+            /* const void* */ getData(),
+            /* cudaDataType_t */ getDataType(),
+            /* const uint32_t */ num_qubits_,
+            /* const uint32_t */ batch_size_,
+            /* custatevecIndex_t */ getLength(),
+            /* double2* */ expect.data(),
+            /* const void* */ matrix.data(),
+            /* cudaDataType_t */ getDataType(),
+            /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+            /* const uint32_t */ 1,
+            /* const int32_t* */ tgts_int.data(),
+            /* const uint32_t */ tgts_int.size(),
+            /* custatevecComputeType_t */ getComputeType(),
+            /* void* */ extraWorkspace,
+            /* size_t */ extraWorkspaceSizeInBytes));
+
+        std::vector<PrecisionT> result(batch_size_);
+        std::transform(expect.begin(), expect.end(), result.begin(),
+                       [](const double2 &x) {
+                           return static_cast<PrecisionT>(x.x);
+                       });
+        return result;
+    }
+};
+} // namespace Pennylane
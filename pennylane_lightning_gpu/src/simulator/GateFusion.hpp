@@ -0,0 +1,250 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GateFusion.hpp
+ * Host-side planner and matrix composition used to fuse runs of small gates
+ * into a single dense unitary. This file has no CUDA dependencies.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief A contiguous run of operations to be applied as a single gate.
+ *
+ * The `wires` of a block are stored in the order they were first touched, and
+ * this order defines the layout of the fused matrix: `wires[0]` maps to the
+ * most significant bit of the matrix row/column index, following the
+ * PennyLane convention.
+ */
+struct FusedBlock {
+    std::vector<std::size_t> wires;
+    std::vector<std::size_t> op_indices;
+    bool fused;
+};
+
+/**
+ * @brief Greedy gate-fusion planner.
+ *
+ * Consecutive fusable operations are merged into a block for as long as the
+ * union of their wires does not exceed `max_fused_qubits`. Non-fusable
+ * operations terminate the current block and are emitted on their own. Blocks
+ * containing a single operation are not marked as fused, as there is no
+ * benefit in rebuilding their matrix.
+ */
+class GateFusionPlanner {
+  private:
+    std::size_t max_fused_qubits_;
+
+  public:
+    /**
+     * @brief Construct a new planner.
+     *
+     * @param max_fused_qubits Largest number of qubits a fused block may span.
+     */
+    explicit GateFusionPlanner(std::size_t max_fused_qubits = 5)
+        : max_fused_qubits_{max_fused_qubits} {
+        PL_ABORT_IF(max_fused_qubits_ == 0,
+                    "The number of fused qubits must be positive.");
+    }
+
+    [[nodiscard]] auto getMaxFusedQubits() const -> std::size_t {
+        return max_fused_qubits_;
+    }
+
+    /**
+     * @brief Partition a list of operations into fusion blocks.
+     *
+     * @param wires Wires of each operation.
+     * @param fusable Whether each operation may be folded into a dense matrix.
+     * @return std::vector<FusedBlock> Blocks in application order.
+     */
+    [[nodiscard]] auto plan(const std::vector<std::vector<std::size_t>> &wires,
+                            const std::vector<bool> &fusable) const
+        -> std::vector<FusedBlock> {
+        PL_ABORT_IF(wires.size() != fusable.size(),
+                    "Incompatible number of ops and fusable flags");
+
+        std::vector<FusedBlock> blocks;
+        FusedBlock current{{}, {}, true};
+
+        auto flush = [&]() {
+            if (!current.op_indices.empty()) {
+                current.fused = current.op_indices.size() > 1;
+                blocks.push_back(std::move(current));
+            }
+            current = FusedBlock{{}, {}, true};
+        };
+
+        for (std::size_t op_idx = 0; op_idx < wires.size(); op_idx++) {
+            const auto &op_wires = wires[op_idx];
+            if (!fusable[op_idx] || op_wires.size() > max_fused_qubits_) {
+                flush();
+                blocks.push_back(FusedBlock{op_wires, {op_idx}, false});
+                continue;
+            }
+
+            std::vector<std::size_t> new_wires;
+            for (const auto w : op_wires) {
+                if (std::find(current.wires.begin(), current.wires.end(), w) ==
+                        current.wires.end() &&
+                    std::find(new_wires.begin(), new_wires.end(), w) ==
+                        new_wires.end()) {
+                    new_wires.push_back(w);
+                }
+            }
+            if (current.wires.size() + new_wires.size() > max_fused_qubits_) {
+                flush();
+                new_wires = op_wires;
+            }
+            current.wires.insert(current.wires.end(), new_wires.begin(),
+                                 new_wires.end());
+            current.op_indices.push_back(op_idx);
+        }
+        flush();
+        return blocks;
+    }
+};
+
+/**
+ * @brief Apply a dense row-major matrix to a host state vector.
+ *
+ * Wires follow the PennyLane convention: wire 0 is the most significant bit
+ * of the state index, and `wires[0]` is the most significant bit of the
+ * matrix index.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param data Pointer to the state vector of length 2^num_qubits.
+ * @param num_qubits Number of qubits of the state vector.
+ * @param matrix Row-major matrix of dimension 2^wires.size().
+ * @param wires Wires the matrix acts on.
+ * @param adjoint Apply the conjugate transpose of the matrix.
+ */
+template <class PrecisionT>
+void applyMatrixHost(std::complex<PrecisionT> *data, std::size_t num_qubits,
+                     const std::complex<PrecisionT> *matrix,
+                     const std::vector<std::size_t> &wires,
+                     bool adjoint = false) {
+    const std::size_t nw = wires.size();
+    const std::size_t dim = std::size_t{1} << nw;
+    const std::size_t length = std::size_t{1} << num_qubits;
+
+    std::vector<std::size_t> wire_bits(nw);
+    std::size_t wire_mask = 0;
+    for (std::size_t k = 0; k < nw; k++) {
+        PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index");
+        wire_bits[k] = std::size_t{1} << (num_qubits - 1 - wires[k]);
+        wire_mask |= wire_bits[k];
+    }
+
+    // Offset of every local basis state relative to the base index.
+    std::vector<std::size_t> offsets(dim, 0);
+    for (std::size_t i = 0; i < dim; i++) {
+        for (std::size_t k = 0; k < nw; k++) {
+            if ((i >> (nw - 1 - k)) & 1U) {
+                offsets[i] |= wire_bits[k];
+            }
+        }
+    }
+
+    std::vector<std::complex<PrecisionT>> local(dim);
+    for (std::size_t base = 0; base < length; base++) {
+        if (base & wire_mask) {
+            continue;
+        }
+        for (std::size_t i = 0; i < dim; i++) {
+            local[i] = data[base | offsets[i]];
+        }
+        for (std::size_t i = 0; i < dim; i++) {
+            std::complex<PrecisionT> acc{0, 0};
+            for (std::size_t j = 0; j < dim; j++) {
+                acc += (adjoint ? std::conj(matrix[j * dim + i])
+                                : matrix[i * dim + j]) *
+                       local[j];
+            }
+            data[base | offsets[i]] = acc;
+        }
+    }
+}
+
+/**
+ * @brief Compose a sequence of gates into the dense unitary of a fused block.
+ *
+ * The gates are applied in order, i.e. the result is
+ * \f$U = G_{n-1} \cdots G_1 G_0\f$ expressed on `block_wires`.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param block_wires Wires of the fused block.
+ * @param matrices Row-major matrix of each gate.
+ * @param gate_wires Wires of each gate, all contained in `block_wires`.
+ * @param adjoints Whether each gate is applied as its adjoint.
+ * @return std::vector<std::complex<PrecisionT>> Row-major fused matrix.
+ */
+template <class PrecisionT>
+auto composeFusedMatrix(
+    const std::vector<std::size_t> &block_wires,
+    const std::vector<std::vector<std::complex<PrecisionT>>> &matrices,
+    const std::vector<std::vector<std::size_t>> &gate_wires,
+    const std::vector<bool> &adjoints)
+    -> std::vector<std::complex<PrecisionT>> {
+    PL_ABORT_IF(matrices.size() != gate_wires.size() ||
+                    matrices.size() != adjoints.size(),
+                "Incompatible number of matrices, wires and adjoints");
+    const std::size_t nq = block_wires.size();
+    const std::size_t dim = std::size_t{1} << nq;
+
+    // Column j of the fused matrix is the image of basis state |j>; the
+    // columns are built by applying every gate to the local basis states.
+    std::vector<std::complex<PrecisionT>> columns(dim * dim, {0, 0});
+    for (std::size_t j = 0; j < dim; j++) {
+        columns[j * dim + j] = {1, 0};
+    }
+
+    for (std::size_t g = 0; g < matrices.size(); g++) {
+        std::vector<std::size_t> local_wires(gate_wires[g].size());
+        for (std::size_t k = 0; k < gate_wires[g].size(); k++) {
+            auto it = std::find(block_wires.begin(), block_wires.end(),
+                                gate_wires[g][k]);
+            PL_ABORT_IF(it == block_wires.end(),
+                        "Gate wire outside of the fused block");
+            local_wires[k] = static_cast<std::size_t>(
+                std::distance(block_wires.begin(), it));
+        }
+        PL_ABORT_IF(matrices[g].size() !=
+                        (std::size_t{1} << (2 * local_wires.size())),
+                    "Gate matrix size does not match its number of wires");
+        for (std::size_t j = 0; j < dim; j++) {
+            applyMatrixHost(columns.data() + j * dim, nq, matrices[g].data(),
+                            local_wires, adjoints[g]);
+        }
+    }
+
+    std::vector<std::complex<PrecisionT>> fused(dim * dim);
+    for (std::size_t i = 0; i < dim; i++) {
+        for (std::size_t j = 0; j < dim; j++) {
+            fused[i * dim + j] = columns[j * dim + i];
+        }
+    }
+    return fused;
+}
+
+} // namespace Pennylane::CUDA
@@ -42,6 +42,36 @@ inline double bytesToMebibytes(const size_t bytes) {
     return static_cast<double>(bytes) / (1024.0 * 1024.0);
 }
 
+/**
+ * @brief Size in bytes of the transfer workspace of a swap worker.
+ *
+ * @param mpi_buf_size Size to set MPI buffer in MiB (mebibytes). By default
+ * (0), the size of the local state vector, limited to 64 MiB.
+ * @param numLocalQubits Number of local qubits.
+ */
+template <typename CFP_t>
+inline size_t getTransferWorkspaceSize(const size_t mpi_buf_size,
+                                       const size_t numLocalQubits) {
+    if (mpi_buf_size != 0) {
+        return mebibyteToBytes(mpi_buf_size);
+    }
+    size_t transferWorkspaceSize = size_t{1} << numLocalQubits;
+    if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                  std::is_same_v<CFP_t, double2>) {
+        transferWorkspaceSize = transferWorkspaceSize * sizeof(double) * 2;
+    } else {
+        transferWorkspaceSize = transferWorkspaceSize * sizeof(float) * 2;
+    }
+    // With the default setting, transfer work space is limited to 64 MiB
+    // based on the benchmark tests on the Perlmutter.
+    size_t buffer_limit = 64;
+    double transferWorkspaceSizeInMiB = bytesToMebibytes(transferWorkspaceSize);
+    if (transferWorkspaceSizeInMiB > static_cast<double>(buffer_limit)) {
+        transferWorkspaceSize = mebibyteToBytes(buffer_limit);
+    }
+    return transferWorkspaceSize;
+}
+
 /**
  * @brief Create wire pairs for bit index swap and transform all control and
  * target wires to local ones.
@@ -270,29 +300,9 @@ make_shared_mpi_worker(custatevecHandle_t handle, MPIManager &mpi_manager,
         /* void* */ d_extraWorkspace,
         /* size_t */ extraWorkspaceSize));
 
-    size_t transferWorkspaceSize; // In bytes and its value should be power
-                                  // of 2.
-
-    if (mpi_buf_size == 0) {
-        transferWorkspaceSize = size_t{1} << numLocalQubits;
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            transferWorkspaceSize = transferWorkspaceSize * sizeof(double) * 2;
-        } else {
-            transferWorkspaceSize = transferWorkspaceSize * sizeof(float) * 2;
-        }
-        // With the default setting, transfer work space is limited to 64 MiB
-        // based on the benchmark tests on the Perlmutter.
-        size_t buffer_limit = 64;
-        double transferWorkspaceSizeInMiB =
-            bytesToMebibytes(transferWorkspaceSize);
-        if (transferWorkspaceSizeInMiB > static_cast<double>(buffer_limit)) {
-            transferWorkspaceSize = mebibyteToBytes(buffer_limit);
-        }
-    } else {
-        transferWorkspaceSize = mebibyteToBytes(mpi_buf_size);
-    }
-
+    // In bytes and its value should be power of 2.
+    size_t transferWorkspaceSize =
+        getTransferWorkspaceSize<CFP_t>(mpi_buf_size, numLocalQubits);
     transferWorkspaceSize =
         std::max(minTransferWorkspaceSize, transferWorkspaceSize);
     PL_CUDA_IS_SUCCESS(cudaMalloc(&d_transferWorkspace, transferWorkspaceSize));
@@ -48,6 +48,12 @@ extern void setBasisState_CUDA(cuDoubleComplex *sv, cuDoubleComplex &value,
 /**
  * @brief CRTP-enabled base class for CUDA-capable state-vector simulators.
  *
+ * The derived class may store its amplitudes with permuted index bits. It
+ * provides `applyQubitMap()`, restoring the logical layout, and
+ * `resetQubitMap()`, called after the data is overwritten. Callers apply the
+ * qubit map explicitly before reading the data; the copies to the host abort
+ * otherwise, and the copies between devices carry the map along.
+ *
  * @tparam Precision Floating point precision.
  * @tparam Derived Derived class to instantiate using CRTP.
  */
@@ -106,6 +112,8 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         PL_ABORT_IF_NOT(BaseType::getNumQubits() == sv.getNumQubits(),
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyHostDataToGpu(sv.getData(), sv.getLength(), async);
+        static_cast<Derived *>(this)->resetQubitMap();
+        markStateModified();
     }
 
     /**
@@ -119,6 +127,8 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         PL_ABORT_IF_NOT(BaseType::getLength() == sv.size(),
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyHostDataToGpu(sv.data(), sv.size(), async);
+        static_cast<Derived *>(this)->resetQubitMap();
+        markStateModified();
     }
 
     /**
@@ -132,6 +142,8 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         PL_ABORT_IF_NOT(BaseType::getLength() == length,
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyGpuDataToGpu(gpu_sv, length, async);
+        static_cast<Derived *>(this)->resetQubitMap();
+        markStateModified();
     }
     /**
      * @brief Explicitly copy data from another GPU device memory block to this
@@ -149,7 +161,10 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                decltype(sv.getData())>>>;
         PL_ABORT_IF_NOT(same,
                         "Data types are incompatible for GPU-GPU transfer");
-        data_buffer_->CopyGpuDataToGpu(sv.getData(), sv.getLength(), async);
+        data_buffer_->CopyGpuDataToGpu(sv.getDataBuffer().getData(),
+                                       sv.getLength(), async);
+        static_cast<Derived *>(this)->resetQubitMap(sv.getQubitMap());
+        markStateModified();
     }
 
     /**
@@ -164,6 +179,8 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyHostDataToGpu(
             reinterpret_cast<const CFP_t *>(host_sv), length, async);
+        static_cast<Derived *>(this)->resetQubitMap();
+        markStateModified();
     }
 
     /**
@@ -175,6 +192,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                   bool async = false) const {
         PL_ABORT_IF_NOT(BaseType::getNumQubits() == sv.getNumQubits(),
                         "Sizes do not match for Host and GPU data");
+        checkLogicalLayout();
         data_buffer_->CopyGpuDataToHost(sv.getData(), sv.getLength(), async);
     }
     /**
@@ -186,6 +204,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                   size_t length, bool async = false) const {
         PL_ABORT_IF_NOT(BaseType::getLength() == length,
                         "Sizes do not match for Host and GPU data");
+        checkLogicalLayout();
         data_buffer_->CopyGpuDataToHost(host_sv, length, async);
     }
 
@@ -200,6 +219,8 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                         "Sizes do not match for GPU data objects");
         sv.getDataBuffer()->CopyGpuDataToGpu(getData(),
                                              data_buffer_->getLength(), async);
+        sv.resetQubitMap(static_cast<const Derived *>(this)->getQubitMap());
+        sv.markStateModified();
     }
 
     const CUDA::DataBuffer<CFP_t> &getDataBuffer() const {
@@ -225,6 +246,8 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
      */
     void updateData(std::unique_ptr<CUDA::DataBuffer<CFP_t>> &&other) {
         data_buffer_ = std::move(other);
+        static_cast<Derived *>(this)->resetQubitMap();
+        markStateModified();
     }
 
     /**
@@ -237,8 +260,26 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         data_buffer_->zeroInit();
         setBasisState_CUDA(data_buffer_->getData(), value, index, async,
                            data_buffer_->getStream());
+        static_cast<Derived *>(this)->resetQubitMap();
+        markStateModified();
     }
 
+    /**
+     * @brief Return a counter incremented by every operation modifying the
+     * state, used to invalidate data derived from it.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto getStateVersion() const -> std::size_t {
+        return state_version_;
+    }
+
+    /**
+     * @brief Record a modification of the state, e.g. after writing to the
+     * pointer returned by `getData()`.
+     */
+    void markStateModified() { state_version_++; }
+
   protected:
     using ParFunc = std::function<void(const std::vector<size_t> &, bool,
                                        const std::vector<Precision> &)>;
@@ -280,8 +321,18 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         return ctrl_map_;
     }
 
+    /**
+     * @brief Abort unless the amplitudes are stored in logical qubit order.
+     */
+    void checkLogicalLayout() const {
+        PL_ABORT_IF_NOT(
+            static_cast<const Derived *>(this)->getQubitMap().isIdentity(),
+            "Apply the qubit map before reading the data");
+    }
+
   private:
     std::unique_ptr<CUDA::DataBuffer<CFP_t>> data_buffer_;
+    std::size_t state_version_{0};
     const std::unordered_set<std::string> const_gates_{
         "Identity", "PauliX", "PauliY", "PauliZ", "Hadamard", "T",      "S",
         "CNOT",     "SWAP",   "CY",     "CZ",     "CSWAP",    "Toffoli"};
@@ -28,11 +28,20 @@
 #include <custatevec.h> // custatevecApplyMatrix
 
 #include "CSRMatrix.hpp"
+#include "ConditionalProbability.hpp"
 #include "Constant.hpp"
+#include "DeviceCSRMatrix.hpp"
+#include "DiagonalPhase.hpp"
 #include "Error.hpp"
 #include "MPIManager.hpp"
 #include "MPIWorker.hpp"
+#include "PauliGrouping.hpp"
+#include "PauliSentence.hpp"
+#include "QubitMap.hpp"
+#include "QubitPlanner.hpp"
+#include "SampleUtils.hpp"
 #include "StateVectorCudaBase.hpp"
+#include "Variance.hpp"
 #include "cuGateCache.hpp"
 #include "cuGates_host.hpp"
 #include "cuda_helpers.hpp"
@@ -65,6 +74,34 @@ extern void setBasisState_CUDA(cuDoubleComplex *sv, cuDoubleComplex &value,
                                const size_t index, bool async,
                                cudaStream_t stream_id);
 
+// declarations of external functions (defined in pauliSentence.cu).
+extern void applyPauliSentence_CUDA(const cuComplex *sv_in, cuComplex *sv_out,
+                                    size_t length, const uint64_t *x_masks,
+                                    const size_t *group_offsets,
+                                    size_t num_groups, const uint64_t *z_masks,
+                                    const cuComplex *coeffs, bool accumulate,
+                                    size_t thread_per_block,
+                                    cudaStream_t stream_id);
+extern void applyPauliSentence_CUDA(
+    const cuDoubleComplex *sv_in, cuDoubleComplex *sv_out, size_t length,
+    const uint64_t *x_masks, const size_t *group_offsets, size_t num_groups,
+    const uint64_t *z_masks, const cuDoubleComplex *coeffs, bool accumulate,
+    size_t thread_per_block, cudaStream_t stream_id);
+
+// declarations of external functions (defined in diagonalPhase.cu).
+extern void applyDiagonalPhase_CUDA(cuComplex *sv, size_t length,
+                                    uint64_t index_offset,
+                                    const uint64_t *z_masks,
+                                    const float *angles, size_t num_terms,
+                                    size_t thread_per_block,
+                                    cudaStream_t stream_id);
+extern void applyDiagonalPhase_CUDA(cuDoubleComplex *sv, size_t length,
+                                    uint64_t index_offset,
+                                    const uint64_t *z_masks,
+                                    const double *angles, size_t num_terms,
+                                    size_t thread_per_block,
+                                    cudaStream_t stream_id);
+
 /**
  * @brief Managed memory CUDA state-vector class using custateVec backed
  * gate-calls.
@@ -79,6 +116,11 @@ class StateVectorCudaMPI
 
     size_t numGlobalQubits_;
     size_t numLocalQubits_;
+    size_t mpiBufSize_{0};
+    // Logical-to-physical map of all index bits, where the physical bits
+    // from `numLocalQubits_` upwards are global. It persists between gates so
+    // that global qubits swapped in stay local until they are read out.
+    cuUtil::QubitMap qubit_map_{numGlobalQubits_ + numLocalQubits_};
     MPIManager mpi_manager_;
 
     SharedCusvHandle handle_;
@@ -87,7 +129,17 @@ class StateVectorCudaMPI
         cusparsehandle_; // This member is mutable to allow lazy initialization.
     SharedLocalStream localStream_;
     SharedMPIWorker svSegSwapWorker_;
+    // Pipelined index bit swaps, and the stream of the gates overlapping
+    // them, created on first use.
+    bool pipelinedSwaps_{true};
+    // Number of (local, global) index bit pairs swapped across ranks.
+    size_t numGlobalIndexBitSwaps_{0};
+    SharedLocalStream computeStream_;
     GateCache<Precision> gate_cache_;
+    // Generator of the mid-circuit measurements, only drawn from on rank 0,
+    // and outcomes of the measurements, identical on all ranks.
+    std::mt19937 measurement_rng_{std::random_device{}()};
+    std::vector<size_t> measurement_outcomes_;
 
   public:
     using CFP_t =
@@ -103,7 +155,8 @@ class StateVectorCudaMPI
         : StateVectorCudaBase<Precision, StateVectorCudaMPI<Precision>>(
               num_local_qubits, dev_tag, true),
           numGlobalQubits_(num_global_qubits),
-          numLocalQubits_(num_local_qubits), mpi_manager_(mpi_manager),
+          numLocalQubits_(num_local_qubits), mpiBufSize_(mpi_buf_size),
+          mpi_manager_(mpi_manager),
           handle_(make_shared_cusv_handle()),
           cublascaller_(make_shared_cublas_caller()),
           localStream_(make_shared_local_stream()),
@@ -121,7 +174,8 @@ class StateVectorCudaMPI
         : StateVectorCudaBase<Precision, StateVectorCudaMPI<Precision>>(
               num_local_qubits, dev_tag, true),
           numGlobalQubits_(num_global_qubits),
-          numLocalQubits_(num_local_qubits), mpi_manager_(mpi_communicator),
+          numLocalQubits_(num_local_qubits), mpiBufSize_(mpi_buf_size),
+          mpi_manager_(mpi_communicator),
           handle_(make_shared_cusv_handle()),
           cublascaller_(make_shared_cublas_caller()),
           localStream_(make_shared_local_stream()),
@@ -138,7 +192,8 @@ class StateVectorCudaMPI
         : StateVectorCudaBase<Precision, StateVectorCudaMPI<Precision>>(
               num_local_qubits, dev_tag, true),
           numGlobalQubits_(num_global_qubits),
-          numLocalQubits_(num_local_qubits), mpi_manager_(MPI_COMM_WORLD),
+          numLocalQubits_(num_local_qubits), mpiBufSize_(mpi_buf_size),
+          mpi_manager_(MPI_COMM_WORLD),
           handle_(make_shared_cusv_handle()),
           cublascaller_(make_shared_cublas_caller()),
           localStream_(make_shared_local_stream()),
@@ -217,6 +272,99 @@ class StateVectorCudaMPI
     auto getSwapWorker() -> custatevecSVSwapWorkerDescriptor_t {
         return svSegSwapWorker_.get();
     }
+
+    /**
+     * @brief Enable or disable pipelined index bit swaps. A pipelined swap
+     * sends chunks of half the MPI buffer, applies the gate to each chunk
+     * once it has arrived, while the next one is in flight, and completes
+     * pairwise with the swap partners instead of through global barriers.
+     * Enabled by default; disabling it restores the swaps synchronized by a
+     * device synchronization and a barrier after every batch.
+     */
+    void setPipelinedSwaps(bool pipelined) { pipelinedSwaps_ = pipelined; }
+
+    /**
+     * @brief Whether index bit swaps are pipelined.
+     */
+    [[nodiscard]] auto getPipelinedSwaps() const -> bool {
+        return pipelinedSwaps_;
+    }
+
+    /**
+     * @brief Number of (local, global) index bit pairs swapped across ranks
+     * since the construction of the state vector.
+     */
+    [[nodiscard]] auto getNumGlobalIndexBitSwaps() const -> size_t {
+        return numGlobalIndexBitSwaps_;
+    }
+
+    /**
+     * @brief Number of amplitudes of a chunk of a pipelined swap: half the
+     * transfer workspace, so that a chunk arrives while the previous one is
+     * consumed.
+     */
+    [[nodiscard]] auto getPipelineChunkLength() const -> size_t {
+        const size_t length =
+            getTransferWorkspaceSize<CFP_t>(mpiBufSize_, numLocalQubits_) /
+            (2 * sizeof(CFP_t));
+        return std::max(std::bit_floor(length), size_t{1});
+    }
+
+    /**
+     * @brief Return a pointer to the local GPU data, in logical qubit order.
+     * The qubit map must have been applied with `applyQubitMap()`.
+     *
+     * @return const CFP_t* Complex device pointer.
+     */
+    [[nodiscard]] auto getData() const -> const CFP_t * {
+        PL_ABORT_IF_NOT(qubit_map_.isIdentity(),
+                        "Apply the qubit map before reading the data");
+        return BaseType::getData();
+    }
+    /**
+     * @brief Return a pointer to the local GPU data, in logical qubit order.
+     * The qubit map must have been applied with `applyQubitMap()`.
+     *
+     * @return CFP_t* Complex device pointer.
+     */
+    [[nodiscard]] auto getData() -> CFP_t * {
+        PL_ABORT_IF_NOT(qubit_map_.isIdentity(),
+                        "Apply the qubit map before reading the data");
+        return BaseType::getData();
+    }
+
+    /**
+     * @brief Reorder the amplitudes across all ranks so that the qubit map is
+     * the identity. The logical state is unchanged. Collective over all ranks.
+     */
+    void applyQubitMap() {
+        if (qubit_map_.isIdentity()) {
+            return;
+        }
+        restoreLogicalLayout();
+    }
+
+    /**
+     * @brief Reset the qubit map without moving amplitudes, after the data
+     * has been overwritten in logical order.
+     */
+    void resetQubitMap() { qubit_map_.reset(); }
+
+    /**
+     * @brief Set the qubit map without moving amplitudes, after the local data
+     * has been overwritten in the layout described by `qubit_map`.
+     */
+    void resetQubitMap(const cuUtil::QubitMap &qubit_map) {
+        qubit_map_ = qubit_map;
+    }
+
+    /**
+     * @brief Logical-to-physical map of all index bits, where wire `w`
+     * is logical bit `num_qubits - 1 - w`.
+     */
+    [[nodiscard]] auto getQubitMap() const -> const cuUtil::QubitMap & {
+        return qubit_map_;
+    }
     /**
      * @brief Init 00....0>.
      */
@@ -255,6 +403,8 @@ class StateVectorCudaMPI
         }
         PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
         mpi_manager_.Barrier();
+        resetQubitMap();
+        BaseType::markStateModified();
     }
 
     /**
@@ -315,6 +465,8 @@ class StateVectorCudaMPI
                             thread_per_block, stream_id);
         PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
         mpi_manager_.Barrier();
+        resetQubitMap();
+        BaseType::markStateModified();
     }
 
     /**
@@ -343,6 +495,11 @@ class StateVectorCudaMPI
                                             wires.end()};
         if (opName == "Identity") {
             return;
+        } else if (opName == "Measure" || opName == "Reset" ||
+                   opName == "Collapse") {
+            applyMeasurementOperation(opName, wires, adjoint, params);
+        } else if (opName == "SWAP") {
+            applySWAP(wires, adjoint);
         } else if (native_gates_.find(opName) != native_gates_.end()) {
             applyParametricPauliGate({opName}, ctrls, tgts, params.front(),
                                      adjoint);
@@ -418,11 +575,7 @@ class StateVectorCudaMPI
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
-        const auto num_ops = opNames.size();
-        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
-            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
-                           params[op_idx]);
-        }
+        applyOperationsPlanned(opNames, wires, adjoints, params);
     }
 
     /**
@@ -441,10 +594,41 @@ class StateVectorCudaMPI
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
-        const auto num_ops = opNames.size();
-        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
-            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx]);
+        applyOperationsPlanned(
+            opNames, wires, adjoints,
+            std::vector<std::vector<Precision>>(opNames.size(), {0.0}));
+    }
+
+    /**
+     * @brief Apply a list of operations, planning the index bit swaps of the
+     * whole list ahead.
+     *
+     * The wires of each operation of `needsLocalWires` are made local by the
+     * swaps of `planLocalSwaps`, which are kept for the following operations,
+     * so that the gate paths do not swap on their own. The operations in
+     * between are applied by `applyOperationsDiagonalBatched`.
+     */
+    void applyOperationsPlanned(
+        const std::vector<std::string> &opNames,
+        const std::vector<std::vector<size_t>> &wires,
+        const std::vector<bool> &adjoints,
+        const std::vector<std::vector<Precision>> &params) {
+        const auto plan = planLocalSwaps(opNames, wires);
+        std::size_t plan_idx = 0;
+        std::size_t begin = 0;
+        for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+            if (!needsLocalWires(opNames[op_idx])) {
+                continue;
+            }
+            applyOperationsDiagonalBatched(opNames, wires, adjoints, params,
+                                           begin, op_idx);
+            applyIndexBitSwaps(plan[plan_idx++]);
+            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
+                           params[op_idx]);
+            begin = op_idx + 1;
         }
+        applyOperationsDiagonalBatched(opNames, wires, adjoints, params, begin,
+                                       opNames.size());
     }
 
     //****************************************************************************//
@@ -565,11 +749,17 @@ class StateVectorCudaMPI
                               {wires.begin(), wires.end() - 1}, {wires.back()},
                               adjoint);
     }
-    inline void applySWAP(const std::vector<std::size_t> &wires, bool adjoint) {
-        static const std::string name{"SWAP"};
-        static const Precision param = 0.0;
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(name, param), {},
-                              wires, adjoint);
+    /**
+     * @brief Apply a SWAP gate by relabelling the qubit map, without moving
+     * amplitudes or communicating.
+     */
+    inline void applySWAP(const std::vector<std::size_t> &wires,
+                          [[maybe_unused]] bool adjoint) {
+        PL_ABORT_IF_NOT(wires.size() == 2, "SWAP requires two wires");
+        const std::size_t num_qubits = this->getTotalNumQubits();
+        qubit_map_.swapLogical(num_qubits - 1 - wires[0],
+                               num_qubits - 1 - wires[1]);
+        BaseType::markStateModified();
     }
     inline void applyIsingXX(const std::vector<std::size_t> &wires,
                              bool adjoint, Precision param) {
@@ -935,15 +1125,13 @@ class StateVectorCudaMPI
      * to implement distributed Sparse Matrix-Vector multiplication. The dense
      * vector is distributed across multiple GPU devices and only the MPI rank 0
      * holds the complete sparse matrix data. The process involves the following
-     * steps: 1. The rank 0 splits the full sparse matrix into n by n blocks,
-     * where n is the size of MPI communicator. Each row of blocks is then
-     * distributed across multiple GPUs. 2. For each GPU, cuSparseSpMV is
-     * invoked to perform the local sparse matrix block and local state vector
-     * multiplication. 3. Each GPU will collect computation results for its
-     * respective row block of the sparse matrix. 4. After all sparse matrix
-     * operations are completed on each GPU, an inner product is performed and
-     * MPI reduce operation is utilized to obtain the final result for the
-     * expectation value.
+     * steps: 1. The rank 0 sends each rank the rows of its local state vector
+     * segment. 2. Each rank splits its rows into the columns of its segment
+     * and the halo, i.e. the remote amplitudes its rows reference, and the
+     * ranks exchange the halo amplitudes point to point. 3. Each GPU
+     * multiplies its rows with its segment and its halo with cuSparseSpMV.
+     * 4. An inner product is performed on each GPU and a single MPI allreduce
+     * of a scalar gives the final result for the expectation value.
      * @tparam index_type Integer type used as indices of the sparse matrix.
      * @param csr_Offsets_ptr Pointer to the array of row offsets of the sparse
      * matrix. Array of size csrOffsets_size.
@@ -965,216 +1153,65 @@ class StateVectorCudaMPI
                             "Incorrect size of CSR Offsets.");
             PL_ABORT_IF_NOT(numNNZ > 0, "Empty CSR matrix.");
         }
-
-        const CFP_t alpha = {1.0, 0.0};
-        const CFP_t beta = {0.0, 0.0};
-
-        Precision local_expect = 0;
-
-        auto device_id = BaseType::getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = BaseType::getDataBuffer().getDevTag().getStreamID();
-
-        cudaDataType_t data_type;
-        cusparseIndexType_t compute_type;
-        const cusparseOperation_t operation_type =
-            CUSPARSE_OPERATION_NON_TRANSPOSE;
-        const cusparseSpMVAlg_t spmvalg_type = CUSPARSE_SPMV_ALG_DEFAULT;
-        const cusparseIndexBase_t index_base_type = CUSPARSE_INDEX_BASE_ZERO;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-        } else {
-            data_type = CUDA_C_32F;
-        }
-
-        if constexpr (std::is_same_v<index_type, int64_t>) {
-            compute_type = CUSPARSE_INDEX_64I;
-        } else {
-            compute_type = CUSPARSE_INDEX_32I;
-        }
-
-        // Distribute sparse matrix across multi-nodes/multi-gpus
-        size_t num_rows = size_t{1} << this->getTotalNumQubits();
-        size_t local_num_rows = size_t{1} << this->getNumLocalQubits();
-
-        std::vector<std::vector<CSRMatrix<Precision, index_type>>>
-            csrmatrix_blocks;
-
-        if (mpi_manager_.getRank() == 0) {
-            csrmatrix_blocks = splitCSRMatrix<Precision, index_type>(
-                mpi_manager_, num_rows, csrOffsets_ptr, columns_ptr,
-                values_ptr);
-        }
-        mpi_manager_.Barrier();
-
-        std::vector<CSRMatrix<Precision, index_type>> localCSRMatVector;
-        for (size_t i = 0; i < mpi_manager_.getSize(); i++) {
-            auto localCSRMat = scatterCSRMatrix<Precision, index_type>(
-                mpi_manager_, csrmatrix_blocks[i], local_num_rows, 0);
-            localCSRMatVector.push_back(localCSRMat);
-        }
-
-        mpi_manager_.Barrier();
-
-        const size_t length_local = size_t{1} << this->getNumLocalQubits();
-
-        DataBuffer<CFP_t, int> d_res_per_block{length_local, device_id,
-                                               stream_id, true};
-        DataBuffer<CFP_t, int> d_res_per_rowblock{length_local, device_id,
-                                                  stream_id, true};
-        d_res_per_rowblock.zeroInit();
-
-        for (size_t i = 0; i < mpi_manager_.getSize(); i++) {
-            // Need to investigate if non-blocking MPI operation can improve
-            // performace here.
-            auto &localCSRMatrix = localCSRMatVector[i];
-
-            int64_t num_rows_local = local_num_rows;
-            int64_t num_cols_local = num_rows_local;
-            int64_t nnz_local =
-                static_cast<int64_t>(localCSRMatrix.getValues().size());
-
-            size_t color = 0;
-
-            if (localCSRMatrix.getValues().size() != 0) {
-                d_res_per_block.zeroInit();
-
-                DataBuffer<index_type, int> d_csrOffsets{
-                    localCSRMatrix.getCsrOffsets().size(), device_id, stream_id,
-                    true};
-                DataBuffer<index_type, int> d_columns{
-                    localCSRMatrix.getColumns().size(), device_id, stream_id,
-                    true};
-                DataBuffer<CFP_t, int> d_values{
-                    localCSRMatrix.getValues().size(), device_id, stream_id,
-                    true};
-
-                d_csrOffsets.CopyHostDataToGpu(
-                    localCSRMatrix.getCsrOffsets().data(),
-                    localCSRMatrix.getCsrOffsets().size(), false);
-                d_columns.CopyHostDataToGpu(localCSRMatrix.getColumns().data(),
-                                            localCSRMatrix.getColumns().size(),
-                                            false);
-                d_values.CopyHostDataToGpu(localCSRMatrix.getValues().data(),
-                                           localCSRMatrix.getValues().size(),
-                                           false);
-
-                // CUSPARSE APIs
-                cusparseSpMatDescr_t mat;
-                cusparseDnVecDescr_t vecX, vecY;
-
-                size_t bufferSize = 0;
-                cusparseHandle_t handle = getCusparseHandle();
-
-                // Create sparse matrix A in CSR format
-                PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
-                    /* cusparseSpMatDescr_t* */ &mat,
-                    /* int64_t */ num_rows_local,
-                    /* int64_t */ num_cols_local,
-                    /* int64_t */ nnz_local,
-                    /* void* */ d_csrOffsets.getData(),
-                    /* void* */ d_columns.getData(),
-                    /* void* */ d_values.getData(),
-                    /* cusparseIndexType_t */ compute_type,
-                    /* cusparseIndexType_t */ compute_type,
-                    /* cusparseIndexBase_t */ index_base_type,
-                    /* cudaDataType */ data_type));
-
-                // Create dense vector X
-                PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-                    /* cusparseDnVecDescr_t* */ &vecX,
-                    /* int64_t */ num_cols_local,
-                    /* void* */ BaseType::getData(),
-                    /* cudaDataType */ data_type));
-
-                // Create dense vector y
-                PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-                    /* cusparseDnVecDescr_t* */ &vecY,
-                    /* int64_t */ num_rows_local,
-                    /* void* */ d_res_per_block.getData(),
-                    /* cudaDataType */ data_type));
-
-                // allocate an external buffer if needed
-                PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
-                    /* cusparseHandle_t */ handle,
-                    /* cusparseOperation_t */ operation_type,
-                    /* const void* */ &alpha,
-                    /* cusparseSpMatDescr_t */ mat,
-                    /* cusparseDnVecDescr_t */ vecX,
-                    /* const void* */ &beta,
-                    /* cusparseDnVecDescr_t */ vecY,
-                    /* cudaDataType */ data_type,
-                    /* cusparseSpMVAlg_t */ spmvalg_type,
-                    /* size_t* */ &bufferSize));
-
-                DataBuffer<cudaDataType_t, int> dBuffer{bufferSize, device_id,
-                                                        stream_id, true};
-
-                // execute SpMV
-                PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
-                    /* cusparseHandle_t */ handle,
-                    /* cusparseOperation_t */ operation_type,
-                    /* const void* */ &alpha,
-                    /* cusparseSpMatDescr_t */ mat,
-                    /* cusparseDnVecDescr_t */ vecX,
-                    /* const void* */ &beta,
-                    /* cusparseDnVecDescr_t */ vecY,
-                    /* cudaDataType */ data_type,
-                    /* cusparseSpMVAlg_t */ spmvalg_type,
-                    /* void* */ reinterpret_cast<void *>(dBuffer.getData())));
-
-                // destroy matrix/vector descriptors
-                PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(mat));
-                PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecX));
-                PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecY));
-
-                color = 1;
-            }
-
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-            mpi_manager_.Barrier();
-
-            if (mpi_manager_.getRank() == i) {
-                color = 1;
-                if (localCSRMatrix.getValues().size() == 0) {
-                    d_res_per_block.zeroInit();
-                }
-            }
-
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-            mpi_manager_.Barrier();
-
-            auto new_mpi_manager =
-                mpi_manager_.split(color, mpi_manager_.getRank());
-            int reduce_root_rank = -1;
-
-            if (mpi_manager_.getRank() == i) {
-                reduce_root_rank = new_mpi_manager.getRank();
-            }
-
-            mpi_manager_.Bcast<int>(reduce_root_rank, i);
-
-            if (new_mpi_manager.getComm() != MPI_COMM_NULL) {
-                new_mpi_manager.Reduce<CFP_t>(d_res_per_block,
-                                              d_res_per_rowblock, length_local,
-                                              reduce_root_rank, "sum");
-            }
-        }
-
-        mpi_manager_.Barrier();
-
-        local_expect =
-            innerProdC_CUDA(d_res_per_rowblock.getData(), BaseType::getData(),
-                            BaseType::getLength(), device_id, stream_id,
-                            getCublasCaller())
+        applyQubitMap();
+
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const size_t rank = mpi_manager_.getRank();
+        const size_t num_ranks = mpi_manager_.getSize();
+        const size_t local_num_rows = BaseType::getLength();
+
+        // Row-partition the sparse matrix and find the halo of this rank
+        auto rows = scatterCSRMatrixRows<Precision, index_type>(
+            mpi_manager_, local_num_rows, csrOffsets_ptr, columns_ptr,
+            values_ptr, 0);
+        auto matrix = splitHaloCSRMatrix<Precision, index_type>(
+            rows, rank, num_ranks, local_num_rows);
+        exchangeHaloIndices<Precision, index_type>(mpi_manager_, matrix,
+                                                   local_num_rows);
+
+        // Exchange only the amplitudes referenced by the other ranks
+        const auto send_values = gatherLocalAmplitudes(matrix.send_indices);
+        std::vector<std::complex<Precision>> halo_values(
+            matrix.halo_columns.size());
+        for (size_t shift = 1; shift < num_ranks; shift++) {
+            const size_t dest = (rank + shift) % num_ranks;
+            const size_t source = (rank + num_ranks - shift) % num_ranks;
+            std::vector<std::complex<Precision>> sendBuf(
+                send_values.begin() + matrix.send_offsets[dest],
+                send_values.begin() + matrix.send_offsets[dest + 1]);
+            std::vector<std::complex<Precision>> recvBuf(
+                matrix.halo_offsets[source + 1] - matrix.halo_offsets[source]);
+            mpi_manager_.Sendrecv<std::complex<Precision>>(sendBuf, dest,
+                                                           recvBuf, source);
+            std::copy(recvBuf.begin(), recvBuf.end(),
+                      halo_values.begin() + matrix.halo_offsets[source]);
+        }
+
+        DataBuffer<CFP_t, int> d_result{local_num_rows, dev_tag, true};
+        d_result.zeroInit();
+        if (!matrix.local.getValues().empty()) {
+            const cuUtil::DeviceCSRMatrix<Precision, index_type> d_local{
+                matrix.local.getCsrOffsets(), matrix.local.getColumns(),
+                matrix.local.getValues(), local_num_rows, dev_tag};
+            applySpMV(d_local, BaseType::getData(), d_result.getData(), false);
+        }
+        if (!matrix.halo.getValues().empty()) {
+            DataBuffer<CFP_t, int> d_halo{halo_values.size(), dev_tag, true};
+            d_halo.CopyHostDataToGpu(halo_values.data(), halo_values.size(),
+                                     false);
+            const cuUtil::DeviceCSRMatrix<Precision, index_type> d_halo_matrix{
+                matrix.halo.getCsrOffsets(), matrix.halo.getColumns(),
+                matrix.halo.getValues(), halo_values.size(), dev_tag};
+            applySpMV(d_halo_matrix, d_halo.getData(), d_result.getData(),
+                      true);
+        }
+
+        Precision local_expect =
+            innerProdC_CUDA(BaseType::getData(), d_result.getData(),
+                            BaseType::getLength(), dev_tag.getDeviceID(),
+                            dev_tag.getStreamID(), getCublasCaller())
                 .x;
-
-        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-        mpi_manager_.Barrier();
-
-        auto expect = mpi_manager_.allreduce<Precision>(local_expect, "sum");
-        return expect;
+        return mpi_manager_.allreduce<Precision>(local_expect, "sum");
     }
 
     /**
@@ -1185,6 +1222,7 @@ class StateVectorCudaMPI
      * @return std::vector<double>
      */
     auto probability(const std::vector<size_t> &wires) -> std::vector<double> {
+        applyQubitMap();
         // Data return type fixed as double in custatevec function call
         std::vector<double> subgroup_probabilities;
 
@@ -1262,186 +1300,280 @@ class StateVectorCudaMPI
     }
 
     /**
-     * @brief Get expectation value for a sum of Pauli words. This function
-     * accepts a vector of words, where each word contains a set of Pauli
-     * operations along with their corresponding wires and coefficients of the
-     * Hamiltonian. The expval calculation is performed based on the word and
-     * its corresponding target wires. The distribution of target wires can be
-     * categorized into three different types:1. All target wires are local, and
-     * no MPI operation is required. 2. Some target wires are located at the
-     * global wires, and there are sufficient local wires available for bit swap
-     * operations. 3. Some target wires are located at the global wires, and
-     * there are insufficient local wires available for bit swap operations. For
-     * the first scenario, the `expvalOnPauliBasis` method can be called
-     * directly to obtain the `expval`. In the second scenario, bit swap
-     * operations are necessary before and after the `expvalOnPauliBasis`
-     * operation to get the `expval`. In the third scenario, a temporary state
-     * vector is created to calculate the `bra`, and then the inner product is
-     * used to calculate the `expval`. This function here will check the
-     * corresponding target wires of all word first. If all target wires for
-     * each word are local, the `expvalOnPauliBasis` will be called just once.
-     * Otherwise, each word will be looped and corresponding expval calculation
-     * methods will be adopted.
+     * @brief Probabilities of the given wires, conditioned on other wires
+     * having fixed values.
      *
-     * @param pauli_words Vector of Pauli-words to evaluate expectation value.
-     * @param tgts Coupled qubit index to apply each Pauli term.
-     * @param coeffs Numpy array buffer of size |pauli_words|
-     * @return auto Expectation value.
+     * Each rank conditions its local block on device, with a cuStateVec mask
+     * for local condition wires; ranks whose global bits contradict the
+     * condition contribute zeros. Only the 2^|wires| table is then summed
+     * over the ranks, and it is returned on every rank.
+     *
+     * @param wires List of wires to return probabilities for, with the same
+     * ordering as `StateVectorCudaManaged::probability(wires)`.
+     * @param condition_wires Wires whose values are fixed.
+     * @param condition_bits Value, 0 or 1, of each condition wire.
+     * @return std::vector<double> Probabilities divided by the probability
+     * of the condition.
      */
-    auto getExpectationValuePauliWords(
-        const std::vector<std::string> &pauli_words,
-        const std::vector<std::vector<std::size_t>> &tgts,
-        const std::complex<Precision> *coeffs) {
-
-        enum WiresSwapStatus : std::size_t { Local, Swappable, UnSwappable };
-
-        std::vector<double> expect_local(pauli_words.size());
+    auto probability(const std::vector<size_t> &wires,
+                     const std::vector<size_t> &condition_wires,
+                     const std::vector<size_t> &condition_bits)
+        -> std::vector<double> {
+        cuUtil::checkCondition(this->getTotalNumQubits(), wires,
+                               condition_wires, condition_bits);
+        applyQubitMap();
+        auto local_probabilities = localProbabilities(
+            BaseType::getData(), wires, condition_wires, condition_bits);
+        auto probabilities =
+            mpi_manager_.allreduce<double>(local_probabilities, "sum");
+        cuUtil::normalizeConditional(probabilities);
+        return probabilities;
+    }
 
-        std::vector<std::size_t> tgtsSwapStatus;
-        std::vector<std::vector<int2>> tgtswirePairs;
-        std::vector<std::vector<size_t>> tgtsIntTrans;
-        tgtsIntTrans.reserve(tgts.size());
+    /**
+     * @brief Project a wire onto a computational basis state and renormalize
+     * the state vector. A local wire is collapsed by cuStateVec on each
+     * block, while for a global wire each rank either zeroes or rescales its
+     * block. Collective over all ranks.
+     *
+     * @param wire Wire to collapse.
+     * @param outcome Value, 0 or 1, of the wire after the collapse.
+     */
+    void collapse(size_t wire, size_t outcome) {
+        PL_ABORT_IF(wire >= this->getTotalNumQubits(), "Invalid wire index");
+        PL_ABORT_IF(outcome > 1, "Measurement outcomes must be 0 or 1");
+        collapseWithProbability(wire, outcome,
+                                wireProbabilities(wire)[outcome]);
+    }
 
-        for (const auto &vec : tgts) {
-            std::vector<size_t> tmpVecInt(
-                vec.size()); // Reserve memory for efficiency
+    /**
+     * @brief Measure a wire in the computational basis. The random number is
+     * drawn on rank 0 and broadcast, so that all ranks agree on the outcome,
+     * which is appended to `getMeasurementOutcomes()`. Collective over all
+     * ranks.
+     *
+     * @param wire Wire to measure.
+     * @return size_t Measurement outcome, 0 or 1.
+     */
+    auto measure(size_t wire) -> size_t {
+        const auto outcome = measureWire(wire);
+        measurement_outcomes_.push_back(outcome);
+        return outcome;
+    }
 
-            std::transform(vec.begin(), vec.end(), tmpVecInt.begin(),
-                           [&](std::size_t x) {
-                               return this->getTotalNumQubits() - 1 - x;
-                           });
-            tgtsIntTrans.push_back(std::move(tmpVecInt));
+    /**
+     * @brief Reset a wire to |0>, by measuring it and flipping it if the
+     * outcome is 1. The outcome is not recorded. Collective over all ranks.
+     *
+     * @param wire Wire to reset.
+     */
+    void reset(size_t wire) {
+        if (measureWire(wire) == 1) {
+            applyPauliX({wire}, false);
         }
+    }
 
-        // Local target wires (required by expvalOnPauliBasis)
-        std::vector<std::vector<size_t>> localTgts;
-        localTgts.reserve(tgts.size());
-
-        for (const auto &vec : tgtsIntTrans) {
-            std::vector<int> statusWires(this->getTotalNumQubits(),
-                                         WireStatus::Default);
+    /**
+     * @brief Outcomes of the `measure` calls and `Measure` operations, in
+     * the order in which they were applied.
+     */
+    [[nodiscard]] auto getMeasurementOutcomes() const
+        -> const std::vector<size_t> & {
+        return measurement_outcomes_;
+    }
 
-            for (auto &v : vec) {
-                statusWires[v] = WireStatus::Target;
-            }
-            size_t StatusGlobalWires =
-                std::reduce(statusWires.begin() + this->getNumLocalQubits(),
-                            statusWires.end());
+    /**
+     * @brief Seed the random number generator of mid-circuit measurements.
+     * Only the generator of rank 0 is used.
+     *
+     * @param seed Seed value.
+     */
+    void seedMeasurements(size_t seed) { measurement_rng_.seed(seed); }
 
-            if (!StatusGlobalWires) {
-                tgtsSwapStatus.push_back(WiresSwapStatus::Local);
-                localTgts.push_back(vec);
-            } else {
-                size_t counts_global_wires = std::count_if(
-                    statusWires.begin(),
-                    statusWires.begin() + this->getNumLocalQubits(),
-                    [](int i) { return i != WireStatus::Default; });
-                size_t counts_local_wires_avail =
-                    this->getNumLocalQubits() -
-                    (vec.size() - counts_global_wires);
-                // Check if there are sufficent number of local wires for bit
-                // swap
-                if (counts_global_wires <= counts_local_wires_avail) {
-                    tgtsSwapStatus.push_back(WiresSwapStatus::Swappable);
-
-                    std::vector<int> localVec(vec.size());
-                    std::transform(
-                        vec.begin(), vec.end(), localVec.begin(),
-                        [&](size_t x) { return static_cast<int>(x); });
-                    auto wirePairs = createWirePairs(this->getNumLocalQubits(),
-                                                     this->getTotalNumQubits(),
-                                                     localVec, statusWires);
-                    std::vector<size_t> localVecSizeT(localVec.size());
-                    std::transform(
-                        localVec.begin(), localVec.end(), localVecSizeT.begin(),
-                        [&](int x) { return static_cast<size_t>(x); });
-                    localTgts.push_back(localVecSizeT);
-                    tgtswirePairs.push_back(wirePairs);
+    /**
+     * @brief Get expectation value for a sum of Pauli words.
+     *
+     * Words are partitioned into qubit-wise commuting groups. A group is
+     * evaluated from the probabilities of its local wires, after rotating a
+     * copy of the state into its eigenbasis, if that takes fewer passes over
+     * the state than leaving its words to the Pauli sentence; its global wires
+     * are fixed by the rank, so no bit swap is needed. The remaining words are
+     * evaluated together as one compiled Pauli sentence. See
+     * `cuUtil::planPauliExpectation`.
+     *
+     * @param pauli_words Vector of Pauli-words to evaluate expectation value.
+     * @param tgts Coupled qubit index to apply each Pauli term.
+     * @param coeffs Numpy array buffer of size |pauli_words|
+     * @return auto Expectation value.
+     */
+    auto getExpectationValuePauliWords(
+        const std::vector<std::string> &pauli_words,
+        const std::vector<std::vector<std::size_t>> &tgts,
+        const std::complex<Precision> *coeffs) -> Precision {
+        const auto plan = cuUtil::planPauliExpectation(pauli_words, tgts);
+        Precision result = 0;
+        if (!plan.groups.empty()) {
+            applyQubitMap();
+            std::vector<double> expect_local(pauli_words.size());
+            std::unique_ptr<StateVectorCudaMPI> rotated;
+            for (const auto &group : plan.groups) {
+                if (group.isDiagonal()) {
+                    cuUtil::groupExpectationValues(
+                        localProbabilities(BaseType::getData(), group.wires),
+                        group, expect_local);
                 } else {
-                    tgtsSwapStatus.push_back(WiresSwapStatus::UnSwappable);
-                    localTgts.push_back(vec);
+                    if (!rotated) {
+                        rotated = std::make_unique<StateVectorCudaMPI>(
+                            this->getDataBuffer().getDevTag(),
+                            this->getNumGlobalQubits(),
+                            this->getNumLocalQubits(), this->getData());
+                    } else {
+                        rotated->updateData(*this);
+                    }
+                    cuUtil::rotateToGroupBasis(*rotated, group);
+                    // The rotation may move wires of the copy to other bits.
+                    cuUtil::groupExpectationValues(
+                        rotated->localProbabilities(
+                            rotated->getDataBuffer().getData(), group.wires),
+                        group, expect_local);
                 }
             }
-        }
-        // Check if all target wires are local
-        auto threshold = WiresSwapStatus::Swappable;
-        bool allLocal = std::all_of(
-            tgtsSwapStatus.begin(), tgtsSwapStatus.end(),
-            [&threshold](size_t status) { return status < threshold; });
-
-        mpi_manager_.Barrier();
-
-        if (allLocal) {
-            expvalOnPauliBasis(pauli_words, localTgts, expect_local);
-        } else {
-            size_t wirePairsIdx = 0;
-            for (size_t i = 0; i < pauli_words.size(); i++) {
-                if (tgtsSwapStatus[i] == WiresSwapStatus::Local) {
-                    std::vector<std::string> pauli_words_idx(
-                        1, std::string(pauli_words[i]));
-                    std::vector<std::vector<size_t>> tgts_idx;
-                    tgts_idx.push_back(localTgts[i]);
-                    std::vector<double> expval_local(1);
-
-                    expvalOnPauliBasis(pauli_words_idx, tgts_idx, expval_local);
-                    expect_local[i] = expval_local[0];
-                } else if (tgtsSwapStatus[i] == WiresSwapStatus::Swappable) {
-                    std::vector<std::string> pauli_words_idx(
-                        1, std::string(pauli_words[i]));
-                    std::vector<std::vector<size_t>> tgts_idx;
-                    tgts_idx.push_back(localTgts[i]);
-                    std::vector<double> expval_local(1);
-
-                    applyMPI_Dispatcher(tgtswirePairs[wirePairsIdx],
-                                        &StateVectorCudaMPI::expvalOnPauliBasis,
-                                        pauli_words_idx, tgts_idx,
-                                        expval_local);
-                    wirePairsIdx++;
-                    expect_local[i] = expval_local[0];
-                } else {
-                    auto opsNames = pauliStringToOpNames(pauli_words[i]);
-                    StateVectorCudaMPI<Precision> tmp(
-                        this->getDataBuffer().getDevTag(),
-                        this->getNumGlobalQubits(), this->getNumLocalQubits(),
-                        this->getData());
-
-                    for (size_t opsIdx = 0; opsIdx < tgts[i].size(); opsIdx++) {
-                        std::vector<size_t> wires = {tgts[i][opsIdx]};
-                        tmp.applyOperation({opsNames[opsIdx]},
-                                           {tgts[i][opsIdx]}, {false});
-                    }
-
-                    expect_local[i] =
-                        innerProdC_CUDA(
-                            tmp.getData(), BaseType::getData(),
-                            BaseType::getLength(),
-                            BaseType::getDataBuffer().getDevTag().getDeviceID(),
-                            BaseType::getDataBuffer().getDevTag().getStreamID(),
-                            this->getCublasCaller())
-                            .x;
+            const auto expect =
+                mpi_manager_.allreduce<double>(expect_local, "sum");
+            for (const auto &group : plan.groups) {
+                for (const std::size_t t : group.terms) {
+                    result += static_cast<Precision>(expect[t]) *
+                              std::real(coeffs[t]);
                 }
             }
         }
+        if (!plan.sentence_terms.empty()) {
+            std::vector<Precision> sentence_coeffs;
+            std::vector<std::string> sentence_words;
+            std::vector<std::vector<std::size_t>> sentence_tgts;
+            for (const std::size_t t : plan.sentence_terms) {
+                sentence_coeffs.push_back(std::real(coeffs[t]));
+                sentence_words.push_back(pauli_words[t]);
+                sentence_tgts.push_back(tgts[t]);
+            }
+            result += getExpectationValuePauliSentence(
+                cuUtil::compilePauliSentence(sentence_coeffs, sentence_words,
+                                             sentence_tgts,
+                                             this->getTotalNumQubits()));
+        }
+        return result;
+    }
 
-        auto expect = mpi_manager_.allreduce<double>(expect_local, "sum");
-        std::complex<Precision> result{0, 0};
+    /**
+     * @brief Multiply the state vector by a product of diagonal gates in a
+     * single pass. Diagonal gates need no communication: the global index
+     * bits are fixed on each rank.
+     *
+     * @param phase Diagonal phase, where wire `w` is index bit
+     * `num_qubits - 1 - w` of the total number of qubits.
+     */
+    void applyDiagonalPhase(const cuUtil::DiagonalPhase<Precision> &phase) {
+        applyQubitMap();
+        applyDiagonalPhasePhysical(phase);
+    }
 
-        if constexpr (std::is_same_v<Precision, double>) {
-            for (std::size_t idx = 0; idx < expect.size(); idx++) {
-                result += expect[idx] * coeffs[idx];
-            }
-            return std::real(result);
-        } else {
-            std::vector<Precision> expect_cast(expect.size());
-            std::transform(expect.begin(), expect.end(), expect_cast.begin(),
-                           [](double x) { return static_cast<float>(x); });
+    /**
+     * @brief Apply a compiled Pauli sentence without forming its matrix.
+     * Each rank computes its own rows: terms flipping global qubits read the
+     * local block of the partner rank, exchanged once per distinct set of
+     * flipped global qubits.
+     *
+     * @tparam thread_per_block Number of threads set per block.
+     * @param sentence Pauli sentence compiled for the total number of qubits.
+     */
+    template <size_t thread_per_block = 256>
+    void
+    applyPauliSentence(const cuUtil::PauliSentence<Precision> &sentence) {
+        auto result = std::make_unique<DataBuffer<CFP_t>>(
+            BaseType::getLength(), BaseType::getDataBuffer().getDevTag(),
+            true);
+        applyPauliSentenceLocalRows<thread_per_block>(sentence,
+                                                      result->getData());
+        BaseType::updateData(std::move(result));
+    }
 
-            for (std::size_t idx = 0; idx < expect_cast.size(); idx++) {
-                result += expect_cast[idx] * coeffs[idx];
-            }
+    /**
+     * @brief Expectation value of a compiled Pauli sentence, computed without
+     * forming its matrix. See `applyPauliSentence`.
+     *
+     * @tparam thread_per_block Number of threads set per block.
+     * @param sentence Pauli sentence compiled for the total number of qubits.
+     * @return Precision Expectation value.
+     */
+    template <size_t thread_per_block = 256>
+    auto getExpectationValuePauliSentence(
+        const cuUtil::PauliSentence<Precision> &sentence) -> Precision {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        DataBuffer<CFP_t, int> d_tmp{BaseType::getLength(), dev_tag, true};
+        applyPauliSentenceLocalRows<thread_per_block>(sentence,
+                                                      d_tmp.getData());
+        Precision local_expect =
+            innerProdC_CUDA(BaseType::getData(), d_tmp.getData(),
+                            BaseType::getLength(), dev_tag.getDeviceID(),
+                            dev_tag.getStreamID(), getCublasCaller())
+                .x;
+        return mpi_manager_.allreduce<Precision>(local_expect, "sum");
+    }
 
-            return std::real(result);
-        }
+    /**
+     * @brief Variance of an observable.
+     *
+     * A Pauli word squares to the identity, so only its expectation value is
+     * computed. A diagonal observable takes both moments from the local
+     * probabilities of its wires. Any other observable, e.g. a Hamiltonian,
+     * is applied once to a copy of the state, and the moments are
+     * `<psi|H|psi>` and `||H|psi>||^2`. Both moments are summed over the ranks
+     * by a single allreduce.
+     *
+     * @tparam ObservableT Observable type, e.g. `ObservableGPUMPI<Precision>`.
+     * @param ob Observable.
+     * @return Precision Variance.
+     */
+    template <class ObservableT>
+    auto variance(const ObservableT &ob) -> Precision {
+        std::string word;
+        std::vector<size_t> word_wires;
+        if (ob.appendPauliWord(word, word_wires)) {
+            const std::complex<Precision> one{1.0, 0.0};
+            const auto mean = static_cast<Precision>(
+                getExpectationValuePauliWords({word}, {word_wires}, &one));
+            return 1 - mean * mean;
+        }
+        std::vector<Precision> diag;
+        if (ob.getDiagonal(diag)) {
+            return varianceDiagonal(ob.getWires(), diag);
+        }
+        applyQubitMap();
+        StateVectorCudaMPI h_sv(this->getDataBuffer().getDevTag(),
+                                this->getNumGlobalQubits(),
+                                this->getNumLocalQubits(), this->getData());
+        ob.applyInPlace(h_sv);
+        h_sv.applyQubitMap();
+        return varianceOfApplied(h_sv.getData());
+    }
+
+    /**
+     * @brief Variance of a diagonal observable, from the probabilities of its
+     * wires. Global wires need no bit swap, as their values are fixed by the
+     * rank.
+     *
+     * @param wires Wires of the observable.
+     * @param diag Diagonal of the observable matrix.
+     * @return Precision Variance.
+     */
+    auto varianceDiagonal(const std::vector<size_t> &wires,
+                          const std::vector<Precision> &diag) -> Precision {
+        applyQubitMap();
+        const auto [mean, mean_sq] = cuUtil::diagonalMoments(
+            localProbabilities(BaseType::getData(), wires), diag);
+        std::vector<double> moments{mean, mean_sq};
+        moments = mpi_manager_.allreduce<double>(moments, "sum");
+        return static_cast<Precision>(moments[1] - moments[0] * moments[0]);
     }
 
     /**
@@ -1455,10 +1587,124 @@ class StateVectorCudaMPI
      * number between 0 and num_samples-1.
      */
     auto generate_samples(size_t num_samples) -> std::vector<size_t> {
+        return cuUtil::unpackBitStrings(sampleBitStrings(num_samples),
+                                        this->getTotalNumQubits());
+    }
+
+    /**
+     * @brief Draw samples as packed bit strings.
+     *
+     * @param num_samples Number of Samples
+     * @return std::vector<cuUtil::PackedSample> One integer per sample, in
+     * ascending order, where bit `num_qubits - 1 - w` holds wire `w`.
+     */
+    auto generate_samples_packed(size_t num_samples)
+        -> std::vector<cuUtil::PackedSample> {
+        const auto bit_strings = sampleBitStrings(num_samples);
+        return {bit_strings.begin(), bit_strings.end()};
+    }
+
+    /**
+     * @brief Draw samples and histogram them.
+     *
+     * @param num_samples Number of Samples
+     * @return cuUtil::SampleCounts Distinct packed bit strings, in ascending
+     * order, and their number of occurrences.
+     */
+    auto generate_counts(size_t num_samples) -> cuUtil::SampleCounts {
+        return cuUtil::countSortedBitStrings(sampleBitStrings(num_samples));
+    }
+
+    /**
+     * @brief Compute y = matrix * x, or y += matrix * x, with cuSparseSpMV.
+     *
+     * @param matrix Device CSR matrix.
+     * @param x Device vector of the length of the matrix columns.
+     * @param y Device vector of the length of the matrix rows.
+     * @param accumulate Add the product to y instead of overwriting it.
+     */
+    template <class index_type>
+    void applySpMV(const cuUtil::DeviceCSRMatrix<Precision, index_type> &matrix,
+                   CFP_t *x, CFP_t *y, bool accumulate) {
+        const CFP_t alpha = {1.0, 0.0};
+        const CFP_t beta = accumulate ? alpha : CFP_t{0.0, 0.0};
+        const auto &dev_tag = matrix.getDevTag();
+        cudaDataType_t data_type;
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+
+        cusparseHandle_t handle = getCusparseHandle();
+        cusparseDnVecDescr_t vecX, vecY;
+        size_t bufferSize = 0;
+
+        // Create dense vectors X and y
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            /* cusparseDnVecDescr_t* */ &vecX,
+            /* int64_t */ static_cast<int64_t>(matrix.getNumCols()),
+            /* void* */ x,
+            /* cudaDataType */ data_type));
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            /* cusparseDnVecDescr_t* */ &vecY,
+            /* int64_t */ static_cast<int64_t>(matrix.getNumRows()),
+            /* void* */ y,
+            /* cudaDataType */ data_type));
+
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
+            /* cusparseHandle_t */ handle,
+            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
+            /* const void* */ &alpha,
+            /* cusparseSpMatDescr_t */ matrix.getDescriptor(),
+            /* cusparseDnVecDescr_t */ vecX,
+            /* const void* */ &beta,
+            /* cusparseDnVecDescr_t */ vecY,
+            /* cudaDataType */ data_type,
+            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
+            /* size_t* */ &bufferSize));
+
+        DataBuffer<char, int> dBuffer{bufferSize, dev_tag, true};
+
+        // execute SpMV
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
+            /* cusparseHandle_t */ handle,
+            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
+            /* const void* */ &alpha,
+            /* cusparseSpMatDescr_t */ matrix.getDescriptor(),
+            /* cusparseDnVecDescr_t */ vecX,
+            /* const void* */ &beta,
+            /* cusparseDnVecDescr_t */ vecY,
+            /* cudaDataType */ data_type,
+            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
+            /* void* */ reinterpret_cast<void *>(dBuffer.getData())));
+
+        // destroy vector descriptors; the matrix descriptor is owned by
+        // `matrix`
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecX));
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecY));
+    }
+
+  private:
+    /**
+     * @brief Draw samples from the distributed state with the custatevec
+     * sampler.
+     *
+     * The random numbers are shared by all ranks and sorted, so each rank
+     * samples the contiguous range of shots that falls in its sub-state and
+     * the reduced bit strings come out in ascending order.
+     *
+     * @param num_samples Number of Samples
+     * @return std::vector<custatevecIndex_t> Sampled basis-state indices, in
+     * ascending order, with bit `num_qubits - 1 - w` holding wire `w`.
+     */
+    auto sampleBitStrings(size_t num_samples)
+        -> std::vector<custatevecIndex_t> {
+        applyQubitMap();
         double epsilon = 1e-15;
         size_t nSubSvs = 1UL << (this->getNumGlobalQubits());
         std::vector<double> rand_nums(num_samples);
-        std::vector<size_t> samples(num_samples * this->getTotalNumQubits(), 0);
 
         size_t bitStringLen =
             this->getNumGlobalQubits() + this->getNumLocalQubits();
@@ -1585,18 +1831,347 @@ class StateVectorCudaMPI
         mpi_manager_.Allreduce<custatevecIndex_t>(localBitStrings,
                                                   globalBitStrings, "sum");
 
-        for (size_t i = 0; i < num_samples; i++) {
-            for (size_t j = 0; j < bitStringLen; j++) {
-                samples[i * bitStringLen + (bitStringLen - 1 - j)] =
-                    (globalBitStrings[i] >> j) & 1U;
-            }
+        return globalBitStrings;
+    }
+
+    /**
+     * @brief Copy the amplitudes at the given local indices to the host,
+     * gathering them on the device with cuSparseGather.
+     *
+     * @param indices Local indices of the amplitudes.
+     */
+    template <class index_type>
+    auto gatherLocalAmplitudes(const std::vector<index_type> &indices)
+        -> std::vector<std::complex<Precision>> {
+        std::vector<std::complex<Precision>> values(indices.size());
+        if (indices.empty()) {
+            return values;
         }
-        return samples;
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        cudaDataType_t data_type;
+        cusparseIndexType_t index_type_id;
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+        if constexpr (std::is_same_v<index_type, int64_t>) {
+            index_type_id = CUSPARSE_INDEX_64I;
+        } else {
+            index_type_id = CUSPARSE_INDEX_32I;
+        }
+
+        DataBuffer<index_type, int> d_indices{indices.size(), dev_tag, true};
+        DataBuffer<CFP_t, int> d_values{indices.size(), dev_tag, true};
+        d_indices.CopyHostDataToGpu(indices.data(), indices.size(), false);
+
+        cusparseSpVecDescr_t vecX;
+        cusparseDnVecDescr_t vecY;
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateSpVec(
+            /* cusparseSpVecDescr_t* */ &vecX,
+            /* int64_t */ static_cast<int64_t>(BaseType::getLength()),
+            /* int64_t */ static_cast<int64_t>(indices.size()),
+            /* void* */ d_indices.getData(),
+            /* void* */ d_values.getData(),
+            /* cusparseIndexType_t */ index_type_id,
+            /* cusparseIndexBase_t */ CUSPARSE_INDEX_BASE_ZERO,
+            /* cudaDataType */ data_type));
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            /* cusparseDnVecDescr_t* */ &vecY,
+            /* int64_t */ static_cast<int64_t>(BaseType::getLength()),
+            /* void* */ BaseType::getData(),
+            /* cudaDataType */ data_type));
+
+        PL_CUSPARSE_IS_SUCCESS(cusparseGather(
+            /* cusparseHandle_t */ getCusparseHandle(),
+            /* cusparseDnVecDescr_t */ vecY,
+            /* cusparseSpVecDescr_t */ vecX));
+
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpVec(vecX));
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecY));
+
+        d_values.CopyGpuDataToHost(values.data(), values.size(), false);
+        return values;
     }
 
-  private:
-    using ParFunc = std::function<void(const std::vector<size_t> &, bool,
-                                       const std::vector<Precision> &)>;
+    /**
+     * @brief Variance of an observable `H`, given the local block of
+     * `H|psi>` on the device.
+     *
+     * @param h_psi Observable applied to the state vector.
+     */
+    auto varianceOfApplied(const CFP_t *h_psi) -> Precision {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        std::vector<Precision> moments{
+            innerProdC_CUDA(this->getData(), h_psi, BaseType::getLength(),
+                            dev_tag.getDeviceID(), dev_tag.getStreamID(),
+                            getCublasCaller())
+                .x,
+            innerProdC_CUDA(h_psi, h_psi, BaseType::getLength(),
+                            dev_tag.getDeviceID(), dev_tag.getStreamID(),
+                            getCublasCaller())
+                .x};
+        moments = mpi_manager_.allreduce<Precision>(moments, "sum");
+        return moments[1] - moments[0] * moments[0];
+    }
+
+    /**
+     * @brief Probabilities of the given wires, restricted to the local block
+     * of a state vector: the bits of the global wires are those of this rank,
+     * and the other outcomes are zero. Summing over all ranks gives the
+     * marginal probabilities.
+     *
+     * Local condition wires are applied as a cuStateVec mask. If a global
+     * condition wire differs from the bit of this rank, all outcomes are
+     * zero and the local block is not read.
+     *
+     * Wires are located through the qubit map, so `sv_data` must be in the
+     * layout of this state vector.
+     *
+     * @param sv_data Local block of the state vector, on device.
+     * @param wires Wires to return probabilities for, in the layout of
+     * `probability(wires)`.
+     * @param condition_wires Wires whose values are fixed.
+     * @param condition_bits Value of each condition wire.
+     * @return std::vector<double> Joint probabilities of the wires and the
+     * condition on this rank.
+     */
+    auto localProbabilities(const CFP_t *sv_data,
+                            const std::vector<size_t> &wires,
+                            const std::vector<size_t> &condition_wires = {},
+                            const std::vector<size_t> &condition_bits = {})
+        -> std::vector<double> {
+        const auto rank = static_cast<std::size_t>(mpi_manager_.getRank());
+        std::vector<double> probabilities(Util::exp2(wires.size()));
+
+        std::vector<int> mask_ordering;
+        std::vector<int> mask_bit_string;
+        for (std::size_t k = 0; k < condition_wires.size(); k++) {
+            const auto bit =
+                static_cast<std::size_t>(toIndexBit(condition_wires[k]));
+            if (bit < this->getNumLocalQubits()) {
+                mask_ordering.push_back(static_cast<int>(bit));
+                mask_bit_string.push_back(static_cast<int>(condition_bits[k]));
+            } else if (((rank >> (bit - this->getNumLocalQubits())) & 1U) !=
+                       condition_bits[k]) {
+                return probabilities;
+            }
+        }
+
+        std::vector<int> local_bits;
+        std::vector<std::size_t> local_positions;
+        std::size_t global_outcome = 0;
+        for (std::size_t j = 0; j < wires.size(); j++) {
+            const auto bit = static_cast<std::size_t>(toIndexBit(wires[j]));
+            if (bit < this->getNumLocalQubits()) {
+                local_bits.push_back(static_cast<int>(bit));
+                local_positions.push_back(j);
+            } else if ((rank >> (bit - this->getNumLocalQubits())) & 1U) {
+                global_outcome |= std::size_t{1} << j;
+            }
+        }
+
+        std::vector<double> local_probabilities(Util::exp2(local_bits.size()));
+        if (local_bits.empty() && mask_ordering.empty()) {
+            local_probabilities[0] =
+                innerProdC_CUDA(
+                    sv_data, sv_data, BaseType::getLength(),
+                    BaseType::getDataBuffer().getDevTag().getDeviceID(),
+                    BaseType::getDataBuffer().getDevTag().getStreamID(),
+                    this->getCublasCaller())
+                    .x;
+        } else {
+            cudaDataType_t data_type;
+            if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                          std::is_same_v<CFP_t, double2>) {
+                data_type = CUDA_C_64F;
+            } else {
+                data_type = CUDA_C_32F;
+            }
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecAbs2SumArray(
+                /* custatevecHandle_t */ handle_.get(),
+                /* const void* */ sv_data,
+                /* cudaDataType_t */ data_type,
+                /* const uint32_t */ this->getNumLocalQubits(),
+                /* double* */ local_probabilities.data(),
+                /* const int32_t* */ local_bits.data(),
+                /* const uint32_t */ local_bits.size(),
+                /* const int32_t* */ mask_bit_string.data(),
+                /* const int32_t* */ mask_ordering.data(),
+                /* const uint32_t */ mask_ordering.size()));
+        }
+
+        for (std::size_t l = 0; l < local_probabilities.size(); l++) {
+            std::size_t outcome = global_outcome;
+            for (std::size_t k = 0; k < local_positions.size(); k++) {
+                outcome |= ((l >> k) & 1U) << local_positions[k];
+            }
+            probabilities[outcome] = local_probabilities[l];
+        }
+        return probabilities;
+    }
+
+    /**
+     * @brief Probabilities of the two values of a wire, on all ranks. The
+     * current layout is kept, so that a planned list of operations stays
+     * valid across measurements.
+     */
+    auto wireProbabilities(size_t wire) -> std::vector<double> {
+        auto local_probabilities =
+            localProbabilities(BaseType::getData(), {wire});
+        return mpi_manager_.allreduce<double>(local_probabilities, "sum");
+    }
+
+    /**
+     * @brief Draw the outcome of a measurement of a wire and collapse the
+     * state onto it.
+     */
+    auto measureWire(size_t wire) -> size_t {
+        PL_ABORT_IF(wire >= this->getTotalNumQubits(), "Invalid wire index");
+        const auto probabilities = wireProbabilities(wire);
+        double rand_num = 0.0;
+        if (mpi_manager_.getRank() == 0) {
+            std::uniform_real_distribution<double> dis(0.0, 1.0);
+            rand_num = dis(measurement_rng_);
+        }
+        mpi_manager_.Bcast<double>(rand_num, 0);
+        const size_t outcome = rand_num < probabilities[0] ? 0 : 1;
+        collapseWithProbability(wire, outcome, probabilities[outcome]);
+        return outcome;
+    }
+
+    /**
+     * @brief Collapse a wire onto an outcome of known probability, zeroing the
+     * other amplitudes and dividing the remaining ones by the square root of
+     * the probability. The wire is collapsed at its current index bit.
+     */
+    void collapseWithProbability(size_t wire, size_t outcome,
+                                 double outcome_probability) {
+        PL_ABORT_IF_NOT(outcome_probability > 0.0,
+                        "The measurement outcome has zero probability");
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const auto bit = static_cast<size_t>(toIndexBit(wire));
+        if (bit < this->getNumLocalQubits()) {
+            cudaDataType_t data_type;
+            if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                          std::is_same_v<CFP_t, double2>) {
+                data_type = CUDA_C_64F;
+            } else {
+                data_type = CUDA_C_32F;
+            }
+            const auto basis_bit = static_cast<int32_t>(bit);
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecCollapseOnZBasis(
+                /* custatevecHandle_t */ handle_.get(),
+                /* void* */ BaseType::getData(),
+                /* cudaDataType_t */ data_type,
+                /* const uint32_t */ this->getNumLocalQubits(),
+                /* const int32_t */ static_cast<int32_t>(outcome),
+                /* const int32_t* */ &basis_bit,
+                /* const uint32_t */ 1,
+                /* double */ outcome_probability));
+        } else if (((static_cast<size_t>(mpi_manager_.getRank()) >>
+                     (bit - this->getNumLocalQubits())) &
+                    1U) != outcome) {
+            BaseType::getDataBuffer().zeroInit();
+        } else {
+            const CFP_t scale{
+                static_cast<Precision>(1.0 / std::sqrt(outcome_probability)),
+                0.0};
+            scaleC_CUDA<CFP_t, CFP_t>(scale, BaseType::getData(),
+                                      BaseType::getLength(),
+                                      dev_tag.getDeviceID(),
+                                      dev_tag.getStreamID(), getCublasCaller());
+        }
+        BaseType::markStateModified();
+    }
+
+    /**
+     * @brief Apply a `Measure`, `Reset` or `Collapse` operation, the latter
+     * taking its outcome as parameter. Collective over all ranks.
+     */
+    void applyMeasurementOperation(const std::string &opName,
+                                   const std::vector<size_t> &wires,
+                                   bool adjoint,
+                                   const std::vector<Precision> &params) {
+        PL_ABORT_IF(adjoint, "Measurement operations have no adjoint");
+        PL_ABORT_IF_NOT(wires.size() == 1, "Invalid number of wires");
+        if (opName == "Measure") {
+            measure(wires[0]);
+        } else if (opName == "Reset") {
+            reset(wires[0]);
+        } else {
+            PL_ABORT_IF(params.empty(), "Collapse requires an outcome");
+            collapse(wires[0], static_cast<size_t>(params[0]));
+        }
+    }
+
+    /**
+     * @brief Write the local rows of the product of a compiled Pauli sentence
+     * and the state-vector to `out`.
+     *
+     * @tparam thread_per_block Number of threads set per block.
+     * @param sentence Pauli sentence compiled for the total number of qubits.
+     * @param out Device buffer of the length of the local state vector.
+     */
+    template <size_t thread_per_block>
+    void applyPauliSentenceLocalRows(
+        const cuUtil::PauliSentence<Precision> &sentence, CFP_t *out) {
+        applyQubitMap();
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const size_t rank = mpi_manager_.getRank();
+        // Every rank gets the same sequence of global X masks, so that the
+        // exchanges below pair up.
+        const auto blocks = cuUtil::splitPauliSentence(
+            sentence, this->getNumLocalQubits(), rank);
+
+        if (blocks.empty()) {
+            PL_CUDA_IS_SUCCESS(cudaMemsetAsync(
+                out, 0, sizeof(CFP_t) * BaseType::getLength(),
+                dev_tag.getStreamID()));
+        }
+        std::unique_ptr<DataBuffer<CFP_t, int>> d_partner;
+        for (size_t b = 0; b < blocks.size(); b++) {
+            const auto &local = blocks[b].local;
+            const CFP_t *sv_in = BaseType::getData();
+            if (blocks[b].global_x_mask != 0) {
+                if (!d_partner) {
+                    d_partner = std::make_unique<DataBuffer<CFP_t, int>>(
+                        BaseType::getLength(), dev_tag, true);
+                }
+                const size_t partner = rank ^ blocks[b].global_x_mask;
+                PL_CUDA_IS_SUCCESS(
+                    cudaStreamSynchronize(dev_tag.getStreamID()));
+                mpi_manager_.Sendrecv<CFP_t>(BaseType::getDataBuffer(),
+                                             partner, *d_partner, partner);
+                sv_in = d_partner->getData();
+            }
+
+            const size_t num_groups = local.getNumGroups();
+            const size_t num_terms = local.getNumTerms();
+            DataBuffer<uint64_t, int> d_x_masks{num_groups, dev_tag, true};
+            DataBuffer<size_t, int> d_group_offsets{num_groups + 1, dev_tag,
+                                                    true};
+            DataBuffer<uint64_t, int> d_z_masks{num_terms, dev_tag, true};
+            DataBuffer<CFP_t, int> d_coeffs{num_terms, dev_tag, true};
+            d_x_masks.CopyHostDataToGpu(local.x_masks.data(), num_groups);
+            d_group_offsets.CopyHostDataToGpu(local.group_offsets.data(),
+                                              num_groups + 1);
+            d_z_masks.CopyHostDataToGpu(local.z_masks.data(), num_terms);
+            d_coeffs.CopyHostDataToGpu(local.coeffs.data(), num_terms);
+
+            applyPauliSentence_CUDA(
+                sv_in, out, BaseType::getLength(), d_x_masks.getData(),
+                d_group_offsets.getData(), num_groups, d_z_masks.getData(),
+                d_coeffs.getData(), b != 0, thread_per_block,
+                dev_tag.getStreamID());
+            // The partner buffer is overwritten by the next exchange.
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(dev_tag.getStreamID()));
+        }
+    }
+
+    using ParFunc = std::function<void(const std::vector<size_t> &, bool,
+                                       const std::vector<Precision> &)>;
     using FMap = std::unordered_map<std::string, ParFunc>;
     const FMap par_gates_{
         {"RX",
@@ -1733,83 +2308,240 @@ class StateVectorCudaMPI
         {"Identity", CUSTATEVEC_PAULI_I}, {"I", CUSTATEVEC_PAULI_I}};
 
     /**
-     * @brief Normalize the index ordering to match PennyLane.
-     *
-     * @tparam IndexType Integer value type.
-     * @param indices Given indices to transform.
+     * @brief Whether the gate paths of an operation swap its wires to local
+     * index bits. Diagonal gates and measurements act on global bits in
+     * place, and SWAP only relabels qubits.
      */
-    template <typename IndexType>
-    inline auto NormalizeIndices(std::vector<IndexType> indices)
-        -> std::vector<IndexType> {
-        std::vector<IndexType> t_indices(std::move(indices));
-        std::transform(t_indices.begin(), t_indices.end(), t_indices.begin(),
-                       [&](IndexType i) -> IndexType {
-                           return BaseType::getNumQubits() - 1 - i;
-                       });
-        return t_indices;
+    static auto needsLocalWires(const std::string &opName) -> bool {
+        return opName != "SWAP" && opName != "Measure" &&
+               opName != "Collapse" && !cuUtil::isDiagonalGate(opName);
     }
 
     /**
-     * @brief Get expectation value for a sum of Pauli words.
+     * @brief Plan the index bit swaps making the wires of each operation of
+     * `needsLocalWires` local, looking ahead over the whole list.
      *
-     * @param pauli_words Vector of Pauli-words to evaluate expectation value.
-     * @param tgts Coupled qubit index to apply each Pauli term.
-     * @param coeffs Numpy array buffer of size |pauli_words|
-     * @return auto Expectation value.
+     * The planner follows the qubits through the relabelling of SWAP gates,
+     * so its logical bits are those of the current qubit map.
+     *
+     * @return Swaps to apply before each operation of `needsLocalWires`, in
+     * order.
      */
-    auto expvalOnPauliBasis(const std::vector<std::string> &pauli_words,
-                            const std::vector<std::vector<std::size_t>> &tgts,
-                            std::vector<double> &local_expect) {
-
-        uint32_t nIndexBits = static_cast<uint32_t>(this->getNumLocalQubits());
-        cudaDataType_t data_type;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-        } else {
-            data_type = CUDA_C_32F;
+    auto planLocalSwaps(const std::vector<std::string> &opNames,
+                        const std::vector<std::vector<size_t>> &wires)
+        -> std::vector<cuUtil::IndexBitSwaps> {
+        const std::size_t num_qubits = this->getTotalNumQubits();
+        std::vector<std::size_t> qubits(num_qubits);
+        std::iota(qubits.begin(), qubits.end(), std::size_t{0});
+        std::vector<std::vector<std::size_t>> gate_bits;
+        for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+            for (const auto w : wires[op_idx]) {
+                PL_ABORT_IF(w >= num_qubits, "Invalid wire index");
+            }
+            if (opNames[op_idx] == "SWAP") {
+                PL_ABORT_IF_NOT(wires[op_idx].size() == 2,
+                                "SWAP requires two wires");
+                std::swap(qubits[num_qubits - 1 - wires[op_idx][0]],
+                          qubits[num_qubits - 1 - wires[op_idx][1]]);
+            } else if (needsLocalWires(opNames[op_idx])) {
+                auto &bits = gate_bits.emplace_back();
+                for (const auto w : wires[op_idx]) {
+                    bits.push_back(qubits[num_qubits - 1 - w]);
+                }
+            }
         }
+        return cuUtil::planLocalQubits(this->getNumLocalQubits(), qubit_map_,
+                                       gate_bits);
+    }
 
-        // Note: due to API design, cuStateVec assumes this is always a double.
-        // Push NVIDIA to move this to behind API for future releases, and
-        // support 32/64 bits.
-
-        std::vector<std::vector<custatevecPauli_t>> pauliOps;
+    /**
+     * @brief Apply planned (local, global) index bit swaps, if any.
+     */
+    void applyIndexBitSwaps(const cuUtil::IndexBitSwaps &swaps) {
+        if (swaps.empty()) {
+            return;
+        }
+        std::vector<int2> wirePairs;
+        for (const auto &[local, global] : swaps) {
+            wirePairs.push_back(make_int2(static_cast<int>(local),
+                                          static_cast<int>(global)));
+        }
+        swapIndexBits(wirePairs);
+    }
 
-        std::vector<custatevecPauli_t *> pauliOps_ptr;
+    /**
+     * @brief Apply the operations in `[begin, end)` one by one, except for
+     * runs of at least two diagonal gates, which are collapsed into one
+     * DiagonalPhase and applied in a single pass without any index bit swap.
+     * SWAP gates only relabel qubits and do not end a run. A lone diagonal
+     * gate on a global wire is also applied as a phase.
+     */
+    void applyOperationsDiagonalBatched(
+        const std::vector<std::string> &opNames,
+        const std::vector<std::vector<size_t>> &wires,
+        const std::vector<bool> &adjoints,
+        const std::vector<std::vector<Precision>> &params, std::size_t begin,
+        std::size_t end) {
+        cuUtil::DiagonalPhase<Precision> phase;
+        std::size_t run_start = begin;
+        const auto is_local = [&](const std::vector<size_t> &op_wires) {
+            return std::all_of(op_wires.begin(), op_wires.end(),
+                               [&](std::size_t w) {
+                                   return toIndexBit(w) <
+                                          static_cast<int>(
+                                              this->getNumLocalQubits());
+                               });
+        };
+        const auto flush = [&]() {
+            if (phase.getNumGates() == 1 && is_local(wires[run_start])) {
+                applyOperation(opNames[run_start], wires[run_start],
+                               adjoints[run_start], params[run_start]);
+            } else if (phase.getNumGates() > 0) {
+                applyDiagonalPhasePhysical(phase);
+            }
+            phase.clear();
+        };
+        for (std::size_t op_idx = begin; op_idx < end; op_idx++) {
+            // The phase is on physical bits, so a relabelling SWAP does not
+            // affect it. A single pending gate is applied by wire, hence
+            // before the SWAP.
+            if (opNames[op_idx] == "SWAP" && phase.getNumGates() != 1) {
+                applySWAP(wires[op_idx], adjoints[op_idx]);
+                continue;
+            }
+            if (!cuUtil::isDiagonalGate(opNames[op_idx])) {
+                flush();
+                applyOperation(opNames[op_idx], wires[op_idx],
+                               adjoints[op_idx], params[op_idx]);
+                continue;
+            }
+            if (phase.getNumGates() == 0) {
+                run_start = op_idx;
+            }
+            std::vector<std::size_t> bits(wires[op_idx].size());
+            std::transform(wires[op_idx].begin(), wires[op_idx].end(),
+                           bits.begin(), [&](std::size_t w) {
+                               PL_ABORT_IF(w >= this->getTotalNumQubits(),
+                                           "Invalid wire index");
+                               return static_cast<std::size_t>(toIndexBit(w));
+                           });
+            phase.addGate(opNames[op_idx], bits,
+                          params[op_idx].empty() ? 0 : params[op_idx].front(),
+                          adjoints[op_idx]);
+        }
+        flush();
+    }
 
-        for (auto &p_word : pauli_words) {
-            pauliOps.push_back(cuUtil::pauliStringToEnum(p_word));
-            pauliOps_ptr.push_back((*pauliOps.rbegin()).data());
+    /**
+     * @brief Multiply the local amplitudes by a diagonal phase on the
+     * physical index bits, with the global bits set to the rank.
+     */
+    template <size_t thread_per_block = 256>
+    void
+    applyDiagonalPhasePhysical(const cuUtil::DiagonalPhase<Precision> &phase) {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const size_t num_terms = phase.getNumTerms();
+        if (num_terms == 0) {
+            return;
         }
+        DataBuffer<uint64_t, int> d_z_masks{num_terms, dev_tag, true};
+        DataBuffer<Precision, int> d_angles{num_terms, dev_tag, true};
+        d_z_masks.CopyHostDataToGpu(phase.getZMasks().data(), num_terms);
+        d_angles.CopyHostDataToGpu(phase.getAngles().data(), num_terms);
+
+        const uint64_t index_offset =
+            static_cast<uint64_t>(mpi_manager_.getRank())
+            << this->getNumLocalQubits();
+        applyDiagonalPhase_CUDA(BaseType::getData(), BaseType::getLength(),
+                                index_offset, d_z_masks.getData(),
+                                d_angles.getData(), num_terms,
+                                thread_per_block, dev_tag.getStreamID());
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        BaseType::markStateModified();
+    }
 
-        std::vector<std::vector<int32_t>> basisBits;
-        std::vector<int32_t *> basisBits_ptr;
-        std::vector<uint32_t> n_basisBits;
+    /**
+     * @brief Physical index bit of a wire, combining the PennyLane to
+     * cuQuantum ordering with the qubit map. Bits from `numLocalQubits_`
+     * upwards are global.
+     */
+    [[nodiscard]] auto toIndexBit(std::size_t wire) const -> int {
+        return static_cast<int>(qubit_map_.getPhysicalBit(
+            this->getTotalNumQubits() - 1 - wire));
+    }
 
-        for (auto &wires : tgts) {
-            std::vector<int32_t> wiresInt(wires.size());
-            std::transform(wires.begin(), wires.end(), wiresInt.begin(),
-                           [&](std::size_t x) { return static_cast<int>(x); });
-            basisBits.push_back(wiresInt);
-            basisBits_ptr.push_back((*basisBits.rbegin()).data());
-            n_basisBits.push_back(wiresInt.size());
+    /**
+     * @brief Swap two local index bits of the local state vector and record
+     * the swap in the qubit map.
+     *
+     * @param bit_a Local index bit.
+     * @param bit_b Local index bit.
+     */
+    void swapLocalIndexBits(int bit_a, int bit_b) {
+        cudaDataType_t data_type;
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
         }
-
-        // compute expectation
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectationsOnPauliBasis(
+        const int2 bit_swap = make_int2(bit_a, bit_b);
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSwapIndexBits(
             /* custatevecHandle_t */ handle_.get(),
             /* void* */ BaseType::getData(),
             /* cudaDataType_t */ data_type,
-            /* const uint32_t */ nIndexBits,
-            /* double* */ local_expect.data(),
-            /* const custatevecPauli_t ** */
-            const_cast<const custatevecPauli_t **>(pauliOps_ptr.data()),
-            /* const uint32_t */ static_cast<uint32_t>(pauliOps.size()),
-            /* const int32_t ** */
-            const_cast<const int32_t **>(basisBits_ptr.data()),
-            /* const uint32_t */ n_basisBits.data()));
+            /* const uint32_t */ this->getNumLocalQubits(),
+            /* const int2* */ &bit_swap,
+            /* const uint32_t */ 1,
+            /* const int32_t* */ nullptr,
+            /* const int32_t* */ nullptr,
+            /* const uint32_t */ 0));
+        qubit_map_.swapPhysical(bit_a, bit_b);
+    }
+
+    /**
+     * @brief Reorder the amplitudes so that the qubit map is the identity.
+     * A swap of two global bits goes through local bit 0.
+     */
+    void restoreLogicalLayout() {
+        const auto num_local = static_cast<int>(this->getNumLocalQubits());
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        for (const auto &[bit_a, bit_b] : qubit_map_.getRestoringSwaps()) {
+            const auto low = static_cast<int>(std::min(bit_a, bit_b));
+            const auto high = static_cast<int>(std::max(bit_a, bit_b));
+            if (high < num_local) {
+                swapLocalIndexBits(low, high);
+            } else if (low < num_local) {
+                std::vector<int2> wirePairs{make_int2(low, high)};
+                swapIndexBits(wirePairs);
+            } else {
+                std::vector<int2> lowPair{make_int2(0, low)};
+                std::vector<int2> highPair{make_int2(0, high)};
+                swapIndexBits(lowPair);
+                swapIndexBits(highPair);
+                swapIndexBits(lowPair);
+            }
+        }
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        mpi_manager_.Barrier();
+    }
+
+    /**
+     * @brief Normalize the index ordering to match PennyLane.
+     *
+     * @tparam IndexType Integer value type.
+     * @param indices Given indices to transform.
+     */
+    template <typename IndexType>
+    inline auto NormalizeIndices(std::vector<IndexType> indices)
+        -> std::vector<IndexType> {
+        std::vector<IndexType> t_indices(std::move(indices));
+        std::transform(t_indices.begin(), t_indices.end(), t_indices.begin(),
+                       [&](IndexType i) -> IndexType {
+                           return BaseType::getNumQubits() - 1 - i;
+                       });
+        return t_indices;
     }
 
     /**
@@ -1821,10 +2553,14 @@ class StateVectorCudaMPI
      * @param tgts target wires.
      * @param param Gate parameter.
      * @param use_adjoint Take adjoint of operation.
+     * @param mask_bits Local index bits restricting the gate, optional.
+     * @param mask_values Values of the mask bits.
      */
     void applyCuSVPauliGate(const std::vector<std::string> &pauli_words,
                             std::vector<int> &ctrls, std::vector<int> &tgts,
-                            Precision param, bool use_adjoint = false) {
+                            Precision param, bool use_adjoint = false,
+                            const std::vector<int> &mask_bits = {},
+                            const std::vector<int> &mask_values = {}) {
         int nIndexBits = BaseType::getNumQubits();
 
         cudaDataType_t data_type;
@@ -1842,6 +2578,8 @@ class StateVectorCudaMPI
             pauli_enums.push_back(native_gates_.at(pauli_str));
         }
         const auto local_angle = (use_adjoint) ? param / 2 : -param / 2;
+        const auto [all_ctrls, ctrl_values] =
+            maskedControls(ctrls, mask_bits, mask_values);
 
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyPauliRotation(
             /* custatevecHandle_t */ handle_.get(),
@@ -1852,9 +2590,11 @@ class StateVectorCudaMPI
             /* const custatevecPauli_t* */ pauli_enums.data(),
             /* const int32_t* */ tgts.data(),
             /* const uint32_t */ tgts.size(),
-            /* const int32_t* */ ctrls.data(),
-            /* const int32_t* */ nullptr,
-            /* const uint32_t */ ctrls.size()));
+            /* const int32_t* */ all_ctrls.data(),
+            /* const int32_t* */
+            mask_bits.empty() ? nullptr : ctrl_values.data(),
+            /* const uint32_t */ all_ctrls.size()));
+        BaseType::markStateModified();
     }
 
     /**
@@ -1875,13 +2615,10 @@ class StateVectorCudaMPI
 
         // Transform indices between PL & cuQuantum ordering
         std::transform(
-            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
+            ctrls.begin(), ctrls.end(), ctrlsInt.begin(),
+            [&](std::size_t x) { return toIndexBit(x); });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         // Initialize a vector to store the status of wires and default its
         // elements as zeros, which assumes there is no target and control wire.
@@ -1924,11 +2661,15 @@ class StateVectorCudaMPI
                 this->getNumLocalQubits(), this->getTotalNumQubits(),
                 localCtrls, localTgts, statusWires);
 
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-
-            applyMPI_Dispatcher(
-                wirePairs, &StateVectorCudaMPI::applyCuSVPauliGate, pauli_words,
-                localCtrls, localTgts, param, use_adjoint);
+            // The swapped-in qubits stay local for the following gates.
+            swapIndexBitsAndApply(
+                wirePairs, localCtrls, localTgts,
+                [&](const std::vector<int> &mask_bits,
+                    const std::vector<int> &mask_values) {
+                    applyCuSVPauliGate(pauli_words, localCtrls, localTgts,
+                                       param, use_adjoint, mask_bits,
+                                       mask_values);
+                });
             PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
             PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
         }
@@ -1945,11 +2686,15 @@ class StateVectorCudaMPI
      * @param ctrls Control line qubits.
      * @param tgts Target qubits.
      * @param use_adjoint Use adjoint of given gate.
+     * @param mask_bits Local index bits restricting the gate, optional.
+     * @param mask_values Values of the mask bits.
      */
     void applyCuSVDeviceMatrixGate(const CFP_t *matrix,
                                    const std::vector<int> &ctrls,
                                    const std::vector<int> &tgts,
-                                   bool use_adjoint = false) {
+                                   bool use_adjoint = false,
+                                   const std::vector<int> &mask_bits = {},
+                                   const std::vector<int> &mask_values = {}) {
         void *extraWorkspace = nullptr;
         size_t extraWorkspaceSizeInBytes = 0;
         int nIndexBits = BaseType::getNumQubits();
@@ -1965,6 +2710,8 @@ class StateVectorCudaMPI
             data_type = CUDA_C_32F;
             compute_type = CUSTATEVEC_COMPUTE_32F;
         }
+        const auto [all_ctrls, ctrl_values] =
+            maskedControls(ctrls, mask_bits, mask_values);
 
         // check the size of external workspace
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrixGetWorkspaceSize(
@@ -1976,7 +2723,7 @@ class StateVectorCudaMPI
             /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
             /* const int32_t */ use_adjoint,
             /* const uint32_t */ tgts.size(),
-            /* const uint32_t */ ctrls.size(),
+            /* const uint32_t */ all_ctrls.size(),
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
@@ -1998,14 +2745,16 @@ class StateVectorCudaMPI
             /* const int32_t */ use_adjoint,
             /* const int32_t* */ tgts.data(),
             /* const uint32_t */ tgts.size(),
-            /* const int32_t* */ ctrls.data(),
-            /* const int32_t* */ nullptr,
-            /* const uint32_t */ ctrls.size(),
+            /* const int32_t* */ all_ctrls.data(),
+            /* const int32_t* */
+            mask_bits.empty() ? nullptr : ctrl_values.data(),
+            /* const uint32_t */ all_ctrls.size(),
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
         if (extraWorkspaceSizeInBytes)
             PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        BaseType::markStateModified();
     }
 
     /**
@@ -2029,13 +2778,10 @@ class StateVectorCudaMPI
         std::vector<int> tgtsInt(tgts.size());
 
         std::transform(
-            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
+            ctrls.begin(), ctrls.end(), ctrlsInt.begin(),
+            [&](std::size_t x) { return toIndexBit(x); });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         // Initialize a vector to store the status of wires and default its
         // elements as zeros, which assumes there is no target and control wire.
@@ -2077,11 +2823,15 @@ class StateVectorCudaMPI
                 this->getNumLocalQubits(), this->getTotalNumQubits(),
                 localCtrls, localTgts, statusWires);
 
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-
-            applyMPI_Dispatcher(wirePairs,
-                                &StateVectorCudaMPI::applyCuSVDeviceMatrixGate,
-                                matrix, localCtrls, localTgts, use_adjoint);
+            // The swapped-in qubits stay local for the following gates.
+            swapIndexBitsAndApply(
+                wirePairs, localCtrls, localTgts,
+                [&](const std::vector<int> &mask_bits,
+                    const std::vector<int> &mask_values) {
+                    applyCuSVDeviceMatrixGate(matrix, localCtrls, localTgts,
+                                              use_adjoint, mask_bits,
+                                              mask_values);
+                });
             PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
             PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
         }
@@ -2096,11 +2846,15 @@ class StateVectorCudaMPI
      * @param ctrls Control line qubits.
      * @param tgts Target qubits.
      * @param use_adjoint Use adjoint of given gate.
+     * @param mask_bits Local index bits restricting the gate, optional.
+     * @param mask_values Values of the mask bits.
      */
     void applyCuSVHostMatrixGate(const std::vector<CFP_t> &matrix,
                                  const std::vector<int> &ctrls,
                                  const std::vector<int> &tgts,
-                                 bool use_adjoint = false) {
+                                 bool use_adjoint = false,
+                                 const std::vector<int> &mask_bits = {},
+                                 const std::vector<int> &mask_values = {}) {
         void *extraWorkspace = nullptr;
         size_t extraWorkspaceSizeInBytes = 0;
         int nIndexBits = BaseType::getNumQubits();
@@ -2116,6 +2870,8 @@ class StateVectorCudaMPI
             data_type = CUDA_C_32F;
             compute_type = CUSTATEVEC_COMPUTE_32F;
         }
+        const auto [all_ctrls, ctrl_values] =
+            maskedControls(ctrls, mask_bits, mask_values);
 
         // check the size of external workspace
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrixGetWorkspaceSize(
@@ -2127,7 +2883,7 @@ class StateVectorCudaMPI
             /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
             /* const int32_t */ use_adjoint,
             /* const uint32_t */ tgts.size(),
-            /* const uint32_t */ ctrls.size(),
+            /* const uint32_t */ all_ctrls.size(),
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
@@ -2149,14 +2905,16 @@ class StateVectorCudaMPI
             /* const int32_t */ use_adjoint,
             /* const int32_t* */ tgts.data(),
             /* const uint32_t */ tgts.size(),
-            /* const int32_t* */ ctrls.data(),
-            /* const int32_t* */ nullptr,
-            /* const uint32_t */ ctrls.size(),
+            /* const int32_t* */ all_ctrls.data(),
+            /* const int32_t* */
+            mask_bits.empty() ? nullptr : ctrl_values.data(),
+            /* const uint32_t */ all_ctrls.size(),
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
         if (extraWorkspaceSizeInBytes)
             PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        BaseType::markStateModified();
     }
 
     /**
@@ -2177,13 +2935,10 @@ class StateVectorCudaMPI
         std::vector<int> tgtsInt(tgts.size());
 
         std::transform(
-            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
+            ctrls.begin(), ctrls.end(), ctrlsInt.begin(),
+            [&](std::size_t x) { return toIndexBit(x); });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         // Initialize a vector to store the status of wires and default its
         // elements as zeros, which assumes there is no target and control wire.
@@ -2226,11 +2981,15 @@ class StateVectorCudaMPI
                 this->getNumLocalQubits(), this->getTotalNumQubits(),
                 localCtrls, localTgts, statusWires);
 
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-
-            applyMPI_Dispatcher(wirePairs,
-                                &StateVectorCudaMPI::applyCuSVHostMatrixGate,
-                                matrix, localCtrls, localTgts, use_adjoint);
+            // The swapped-in qubits stay local for the following gates.
+            swapIndexBitsAndApply(
+                wirePairs, localCtrls, localTgts,
+                [&](const std::vector<int> &mask_bits,
+                    const std::vector<int> &mask_values) {
+                    applyCuSVHostMatrixGate(matrix, localCtrls, localTgts,
+                                            use_adjoint, mask_bits,
+                                            mask_values);
+                });
             PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
             PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
         }
@@ -2319,10 +3078,8 @@ class StateVectorCudaMPI
                                        const std::vector<std::size_t> &tgts) {
 
         std::vector<int> tgtsInt(tgts.size());
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         // Initialize a vector to store the status of wires and default its
         // elements as zeros, which assumes there is no target and control wire.
@@ -2432,10 +3189,8 @@ class StateVectorCudaMPI
     auto getExpectationValueDeviceMatrix(const CFP_t *matrix,
                                          const std::vector<std::size_t> &tgts) {
         std::vector<int> tgtsInt(tgts.size());
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(this->getTotalNumQubits() - 1 - x);
-            });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         // Initialize a vector to store the status of wires and default its
         // elements as zeros, which assumes there is no target and control wire.
@@ -2476,29 +3231,20 @@ class StateVectorCudaMPI
     }
 
     /**
-     * @brief MPI dispatcher for the target and control gates at global qubits.
+     * @brief Swap pairs of local and global index bits across all ranks and
+     * record the swaps in the qubit map. Collective over all ranks.
      *
-     * @tparam F Return type of the callable.
-     * @tparam Args Types of arguments of t the callable.
-     *
-     * @param wirePairs Vector of wire pairs for bit index swap operations.
-     * @param functor The callable.
-     * @param args Arguments of the callable.
+     * @param wirePairs Vector of disjoint (local, global) index bit pairs.
      */
-    template <typename F, typename... Args>
-    void applyMPI_Dispatcher(std::vector<int2> &wirePairs, F &&functor,
-                             Args &&...args) {
+    void swapIndexBits(std::vector<int2> &wirePairs) {
+        if (pipelinedSwaps_) {
+            swapIndexBitsPipelined(wirePairs, {}, {});
+            return;
+        }
         int maskBitString[] = {}; // specify the values of mask qubits
         int maskOrdering[] = {};  // specify the mask qubits
 
-        cudaDataType_t svDataType;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            svDataType = CUDA_C_64F;
-        } else {
-            svDataType = CUDA_C_32F;
-        }
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
         //
         // create distributed index bit swap scheduler
         //
@@ -2530,60 +3276,309 @@ class StateVectorCudaMPI
         //
         // the main loop of index bit swaps
         //
-        constexpr size_t nLoops = 2;
-        for (size_t loop = 0; loop < nLoops; ++loop) {
-            for (int swapBatchIndex = 0;
-                 swapBatchIndex < static_cast<int>(nSwapBatches);
-                 ++swapBatchIndex) {
-                // get parameters
-                custatevecSVSwapParameters_t parameters;
-                PL_CUSTATEVEC_IS_SUCCESS(
-                    custatevecDistIndexBitSwapSchedulerGetParameters(
-                        /* custatevecHandle_t */ handle_.get(),
-                        /* custatevecDistIndexBitSwapSchedulerDescriptor_t*/
-                        scheduler,
-                        /* const int32_t */ swapBatchIndex,
-                        /* const int32_t */ mpi_manager_.getRank(),
-                        /* custatevecSVSwapParameters_t* */
-                        &parameters));
-
-                // the rank of the communication endpoint is
-                // parameters.dstSubSVIndex as "rank == subSVIndex" is assumed
-                // in the present sample.
-                int rank = parameters.dstSubSVIndex;
-                // set parameters to the worker
+        for (int swapBatchIndex = 0;
+             swapBatchIndex < static_cast<int>(nSwapBatches);
+             ++swapBatchIndex) {
+            // get parameters
+            custatevecSVSwapParameters_t parameters;
+            PL_CUSTATEVEC_IS_SUCCESS(
+                custatevecDistIndexBitSwapSchedulerGetParameters(
+                    /* custatevecHandle_t */ handle_.get(),
+                    /* custatevecDistIndexBitSwapSchedulerDescriptor_t*/
+                    scheduler,
+                    /* const int32_t */ swapBatchIndex,
+                    /* const int32_t */ mpi_manager_.getRank(),
+                    /* custatevecSVSwapParameters_t* */
+                    &parameters));
+
+            // the rank of the communication endpoint is
+            // parameters.dstSubSVIndex as "rank == subSVIndex" is assumed
+            // in the present sample.
+            int rank = parameters.dstSubSVIndex;
+            // set parameters to the worker
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSVSwapWorkerSetParameters(
+                /* custatevecHandle_t */ handle_.get(),
+                /* custatevecSVSwapWorkerDescriptor_t */
+                this->getSwapWorker(),
+                /* const custatevecSVSwapParameters_t* */
+                &parameters,
+                /* int */ rank));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
+            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize())
+            // execute swap
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSVSwapWorkerExecute(
+                /* custatevecHandle_t */ handle_.get(),
+                /* custatevecSVSwapWorkerDescriptor_t */
+                this->getSwapWorker(),
+                /* custatevecIndex_t */ 0,
+                /* custatevecIndex_t */ parameters.transferSize));
+            // all internal CUDA calls are serialized on localStream
+            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize())
+            mpi_manager_.Barrier();
+        }
+        // synchronize all operations on device
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        mpi_manager_.Barrier();
+
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecDistIndexBitSwapSchedulerDestroy(
+            handle_.get(), scheduler));
+
+        for (const auto &pair : wirePairs) {
+            qubit_map_.swapPhysical(pair.x, pair.y);
+        }
+        numGlobalIndexBitSwaps_ += wirePairs.size();
+    }
+
+    /**
+     * @brief Callable applying a gate on the local amplitudes whose index bits
+     * `mask_bits` take the values `mask_values`, or on all of them if the
+     * mask is empty.
+     */
+    using ChunkFunctor =
+        std::function<void(const std::vector<int> &mask_bits,
+                           const std::vector<int> &mask_values)>;
+
+    /**
+     * @brief Controls of a cuStateVec call restricted by a mask: the control
+     * bits, with the value 1, followed by the mask bits.
+     */
+    static auto maskedControls(const std::vector<int> &ctrls,
+                               const std::vector<int> &mask_bits,
+                               const std::vector<int> &mask_values)
+        -> std::pair<std::vector<int>, std::vector<int>> {
+        PL_ABORT_IF_NOT(mask_bits.size() == mask_values.size(),
+                        "Incompatible number of mask bits and values");
+        std::vector<int> all_ctrls{ctrls};
+        all_ctrls.insert(all_ctrls.end(), mask_bits.begin(), mask_bits.end());
+        std::vector<int> ctrl_values(ctrls.size(), 1);
+        ctrl_values.insert(ctrl_values.end(), mask_values.begin(),
+                           mask_values.end());
+        return {all_ctrls, ctrl_values};
+    }
+
+    /**
+     * @brief Swap index bits and apply a gate on the swapped state vector,
+     * overlapping the gate with the swap if swaps are pipelined.
+     *
+     * @param wirePairs Vector of disjoint (local, global) index bit pairs.
+     * @param ctrls Local control bits of the gate after the swap.
+     * @param tgts Local target bits of the gate after the swap.
+     * @param apply_gate Gate, restricted to a mask.
+     */
+    void swapIndexBitsAndApply(std::vector<int2> &wirePairs,
+                               const std::vector<int> &ctrls,
+                               const std::vector<int> &tgts,
+                               const ChunkFunctor &apply_gate) {
+        if (pipelinedSwaps_) {
+            std::vector<int> gate_bits{ctrls};
+            gate_bits.insert(gate_bits.end(), tgts.begin(), tgts.end());
+            swapIndexBitsPipelined(wirePairs, gate_bits, apply_gate);
+        } else {
+            swapIndexBits(wirePairs);
+            apply_gate({}, {});
+        }
+    }
+
+    /**
+     * @brief Exchange a message with the partner of each swap batch, so that
+     * neither partner runs ahead of the other.
+     */
+    void handshakeSwapPartners(
+        const std::vector<custatevecSVSwapParameters_t> &batches) {
+        for (const auto &parameters : batches) {
+            const auto partner = static_cast<size_t>(parameters.dstSubSVIndex);
+            size_t sent = mpi_manager_.getRank();
+            size_t received = 0;
+            mpi_manager_.Sendrecv(sent, partner, received, partner);
+        }
+    }
+
+    /**
+     * @brief Pipelined variant of `swapIndexBits`.
+     *
+     * The transfers of all swap batches are split into chunks of
+     * `getPipelineChunkLength()` amplitudes, and every batch sends a chunk
+     * before any batch sends the next one. A transfer runs over the local
+     * index bits outside the segment mask in ascending order, so a chunk is
+     * the set of amplitudes whose highest such bits take fixed values. Once
+     * a chunk has arrived, `apply_gate` is launched on it on a separate
+     * stream, overlapping the transfer of the next chunk. If a gate bit is
+     * among the bits fixing the chunks, the gate is applied once after the
+     * swap instead.
+     *
+     * Every rank starts and completes the swap with a point-to-point
+     * handshake with its partner of each batch, and no global barrier is
+     * needed.
+     *
+     * @param wirePairs Vector of disjoint (local, global) index bit pairs.
+     * @param gate_bits Local index bits of the gate after the swap.
+     * @param apply_gate Gate, restricted to a mask, optional.
+     */
+    void swapIndexBitsPipelined(std::vector<int2> &wirePairs,
+                                const std::vector<int> &gate_bits,
+                                const ChunkFunctor &apply_gate) {
+        int maskBitString[] = {}; // specify the values of mask qubits
+        int maskOrdering[] = {};  // specify the mask qubits
+
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        custatevecDistIndexBitSwapSchedulerDescriptor_t scheduler;
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecDistIndexBitSwapSchedulerCreate(
+            /* custatevecHandle_t */ handle_.get(),
+            /* custatevecDistIndexBitSwapSchedulerDescriptor_t */
+            &scheduler,
+            /* uint32_t */ this->getNumGlobalQubits(),
+            /* uint32_t */ this->getNumLocalQubits()));
+        unsigned nSwapBatches = 0;
+        PL_CUSTATEVEC_IS_SUCCESS(
+            custatevecDistIndexBitSwapSchedulerSetIndexBitSwaps(
+                /* custatevecHandle_t */ handle_.get(),
+                /* custatevecDistIndexBitSwapSchedulerDescriptor_t */
+                scheduler,
+                /* const int2* */ wirePairs.data(),
+                /* const uint32_t */
+                static_cast<unsigned>(wirePairs.size()),
+                /* const int32_t* */ maskBitString,
+                /* const int32_t* */ maskOrdering,
+                /* const uint32_t */ 0,
+                /* uint32_t* */ &nSwapBatches));
+
+        std::vector<custatevecSVSwapParameters_t> batches(nSwapBatches);
+        for (unsigned batch = 0; batch < nSwapBatches; batch++) {
+            PL_CUSTATEVEC_IS_SUCCESS(
+                custatevecDistIndexBitSwapSchedulerGetParameters(
+                    /* custatevecHandle_t */ handle_.get(),
+                    /* custatevecDistIndexBitSwapSchedulerDescriptor_t*/
+                    scheduler,
+                    /* const int32_t */ static_cast<int>(batch),
+                    /* const int32_t */ mpi_manager_.getRank(),
+                    /* custatevecSVSwapParameters_t* */
+                    &batches[batch]));
+        }
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecDistIndexBitSwapSchedulerDestroy(
+            handle_.get(), scheduler));
+        handshakeSwapPartners(batches);
+
+        // The chunks are fixed by the highest local bits outside the
+        // segment mask, which is the same for all batches.
+        const size_t transfer_size =
+            batches.empty() ? 0 : batches.front().transferSize;
+        const size_t chunk_length =
+            std::min(transfer_size, getPipelineChunkLength());
+        std::vector<int> chunk_bits;
+        if (!batches.empty()) {
+            std::vector<bool> masked(this->getNumLocalQubits(), false);
+            for (uint32_t k = 0; k < batches.front().segmentMaskLen; k++) {
+                masked[batches.front().segmentMaskOrdering[k]] = true;
+            }
+            std::vector<int> free_bits;
+            for (size_t bit = 0; bit < masked.size(); bit++) {
+                if (!masked[bit]) {
+                    free_bits.push_back(static_cast<int>(bit));
+                }
+            }
+            const auto num_chunk_bits =
+                std::bit_width(transfer_size / chunk_length) - 1;
+            chunk_bits.assign(free_bits.end() - num_chunk_bits,
+                              free_bits.end());
+        }
+        const bool overlap =
+            apply_gate && std::none_of(chunk_bits.begin(), chunk_bits.end(),
+                                       [&](int bit) {
+                                           return std::find(gate_bits.begin(),
+                                                            gate_bits.end(),
+                                                            bit) !=
+                                                  gate_bits.end();
+                                       });
+
+        cudaStream_t handle_stream = nullptr;
+        cudaEvent_t arrived = nullptr;
+        if (overlap) {
+            if (!computeStream_) {
+                computeStream_ = make_shared_local_stream();
+            }
+            PL_CUSTATEVEC_IS_SUCCESS(
+                custatevecGetStream(handle_.get(), &handle_stream));
+            PL_CUDA_IS_SUCCESS(
+                cudaEventCreateWithFlags(&arrived, cudaEventDisableTiming));
+        }
+        const size_t num_chunks =
+            batches.empty() ? 0 : transfer_size / chunk_length;
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            for (auto &parameters : batches) {
                 PL_CUSTATEVEC_IS_SUCCESS(custatevecSVSwapWorkerSetParameters(
                     /* custatevecHandle_t */ handle_.get(),
                     /* custatevecSVSwapWorkerDescriptor_t */
                     this->getSwapWorker(),
                     /* const custatevecSVSwapParameters_t* */
                     &parameters,
-                    /* int */ rank));
-                PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
-                PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize())
-                // execute swap
+                    /* int */ parameters.dstSubSVIndex));
                 PL_CUSTATEVEC_IS_SUCCESS(custatevecSVSwapWorkerExecute(
                     /* custatevecHandle_t */ handle_.get(),
                     /* custatevecSVSwapWorkerDescriptor_t */
                     this->getSwapWorker(),
-                    /* custatevecIndex_t */ 0,
-                    /* custatevecIndex_t */ parameters.transferSize));
-                // all internal CUDA calls are serialized on localStream
-                PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize())
-                mpi_manager_.Barrier();
+                    /* custatevecIndex_t */ chunk * chunk_length,
+                    /* custatevecIndex_t */ (chunk + 1) * chunk_length));
             }
-            if (loop == 0) {
-                std::invoke(std::forward<F>(functor), this,
-                            std::forward<Args>(args)...);
+            if (overlap) {
+                std::vector<int> chunk_values(chunk_bits.size());
+                for (size_t k = 0; k < chunk_bits.size(); k++) {
+                    chunk_values[k] = static_cast<int>((chunk >> k) & 1U);
+                }
+                PL_CUDA_IS_SUCCESS(
+                    cudaEventRecord(arrived, localStream_.get()));
+                PL_CUDA_IS_SUCCESS(
+                    cudaStreamWaitEvent(computeStream_.get(), arrived, 0));
+                PL_CUSTATEVEC_IS_SUCCESS(
+                    custatevecSetStream(handle_.get(), computeStream_.get()));
+                apply_gate(chunk_bits, chunk_values);
+                PL_CUSTATEVEC_IS_SUCCESS(
+                    custatevecSetStream(handle_.get(), handle_stream));
             }
-            // synchronize all operations on device
-            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
-            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
-            mpi_manager_.Barrier();
+        }
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
+        if (overlap) {
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(computeStream_.get()));
+            PL_CUDA_IS_SUCCESS(cudaEventDestroy(arrived));
         }
 
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecDistIndexBitSwapSchedulerDestroy(
-            handle_.get(), scheduler));
+        handshakeSwapPartners(batches);
+
+        for (const auto &pair : wirePairs) {
+            qubit_map_.swapPhysical(pair.x, pair.y);
+        }
+        numGlobalIndexBitSwaps_ += wirePairs.size();
+        if (apply_gate && !overlap) {
+            apply_gate({}, {});
+        }
+    }
+
+    /**
+     * @brief MPI dispatcher for the target and control gates at global qubits.
+     * The index bits are swapped back after the call, leaving the qubit map
+     * unchanged.
+     *
+     * @tparam F Return type of the callable.
+     * @tparam Args Types of arguments of t the callable.
+     *
+     * @param wirePairs Vector of wire pairs for bit index swap operations.
+     * @param functor The callable.
+     * @param args Arguments of the callable.
+     */
+    template <typename F, typename... Args>
+    void applyMPI_Dispatcher(std::vector<int2> &wirePairs, F &&functor,
+                             Args &&...args) {
+        swapIndexBits(wirePairs);
+        std::invoke(std::forward<F>(functor), this,
+                    std::forward<Args>(args)...);
+        // synchronize all operations on device
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(localStream_.get()));
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        // A pipelined swap waits for its partners on its own.
+        if (!pipelinedSwaps_) {
+            mpi_manager_.Barrier();
+        }
+        swapIndexBits(wirePairs);
     }
 };
 
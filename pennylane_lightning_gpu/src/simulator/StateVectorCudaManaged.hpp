@@ -16,6 +16,8 @@
  */
 #pragma once
 
+#include <iterator>
+#include <memory>
 #include <random>
 #include <unordered_map>
 #include <unordered_set>
@@ -25,9 +27,21 @@
 #include <cuda.h>
 #include <custatevec.h> // custatevecApplyMatrix
 
+#include "ConditionalProbability.hpp"
 #include "Constant.hpp"
+#include "DiagonalPhase.hpp"
 #include "Error.hpp"
+#include "GateFusion.hpp"
+#include "OpStream.hpp"
+#include "PauliGrouping.hpp"
+#include "PauliSentence.hpp"
+#include "QubitMap.hpp"
+#include "SampleUtils.hpp"
+#include "Variance.hpp"
+#include "CudaWorkspaceAllocator.hpp"
+#include "DeviceCSRMatrix.hpp"
 #include "StateVectorCudaBase.hpp"
+#include "WorkspaceArena.hpp"
 #include "cuGateCache.hpp"
 #include "cuGates_host.hpp"
 #include "cuda_helpers.hpp"
@@ -60,6 +74,34 @@ extern void setBasisState_CUDA(cuDoubleComplex *sv, cuDoubleComplex &value,
                                const size_t index, bool async,
                                cudaStream_t stream_id);
 
+// declarations of external functions (defined in pauliSentence.cu).
+extern void applyPauliSentence_CUDA(const cuComplex *sv_in, cuComplex *sv_out,
+                                    size_t length, const uint64_t *x_masks,
+                                    const size_t *group_offsets,
+                                    size_t num_groups, const uint64_t *z_masks,
+                                    const cuComplex *coeffs, bool accumulate,
+                                    size_t thread_per_block,
+                                    cudaStream_t stream_id);
+extern void applyPauliSentence_CUDA(
+    const cuDoubleComplex *sv_in, cuDoubleComplex *sv_out, size_t length,
+    const uint64_t *x_masks, const size_t *group_offsets, size_t num_groups,
+    const uint64_t *z_masks, const cuDoubleComplex *coeffs, bool accumulate,
+    size_t thread_per_block, cudaStream_t stream_id);
+
+// declarations of external functions (defined in diagonalPhase.cu).
+extern void applyDiagonalPhase_CUDA(cuComplex *sv, size_t length,
+                                    uint64_t index_offset,
+                                    const uint64_t *z_masks,
+                                    const float *angles, size_t num_terms,
+                                    size_t thread_per_block,
+                                    cudaStream_t stream_id);
+extern void applyDiagonalPhase_CUDA(cuDoubleComplex *sv, size_t length,
+                                    uint64_t index_offset,
+                                    const uint64_t *z_masks,
+                                    const double *angles, size_t num_terms,
+                                    size_t thread_per_block,
+                                    cudaStream_t stream_id);
+
 /**
  * @brief Managed memory CUDA state-vector class using custateVec backed
  * gate-calls.
@@ -133,6 +175,84 @@ class StateVectorCudaManaged
 
     ~StateVectorCudaManaged() = default;
 
+    /**
+     * @brief Return a pointer to the GPU data, in logical qubit order. The
+     * qubit map must have been applied with `applyQubitMap()`.
+     *
+     * @return const CFP_t* Complex device pointer.
+     */
+    [[nodiscard]] auto getData() const -> const CFP_t * {
+        PL_ABORT_IF_NOT(qubit_map_.isIdentity(),
+                        "Apply the qubit map before reading the data");
+        return BaseType::getData();
+    }
+    /**
+     * @brief Return a pointer to the GPU data, in logical qubit order. The
+     * qubit map must have been applied with `applyQubitMap()`.
+     *
+     * @return CFP_t* Complex device pointer.
+     */
+    [[nodiscard]] auto getData() -> CFP_t * {
+        PL_ABORT_IF_NOT(qubit_map_.isIdentity(),
+                        "Apply the qubit map before reading the data");
+        return BaseType::getData();
+    }
+
+    /**
+     * @brief Reorder the amplitudes in memory so that the qubit map is the
+     * identity. The logical state is unchanged.
+     */
+    void applyQubitMap() {
+        if (qubit_map_.isIdentity()) {
+            return;
+        }
+        cudaDataType_t data_type;
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+        auto *data = BaseType::getData();
+        for (const auto &[bit_a, bit_b] : qubit_map_.getRestoringSwaps()) {
+            const int2 bit_swap = make_int2(static_cast<int>(bit_a),
+                                            static_cast<int>(bit_b));
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSwapIndexBits(
+                /* custatevecHandle_t */ handle_.get(),
+                /* void* */ data,
+                /* cudaDataType_t */ data_type,
+                /* const uint32_t */ BaseType::getNumQubits(),
+                /* const int2* */ &bit_swap,
+                /* const uint32_t */ 1,
+                /* const int32_t* */ nullptr,
+                /* const int32_t* */ nullptr,
+                /* const uint32_t */ 0));
+        }
+        qubit_map_.reset();
+    }
+
+    /**
+     * @brief Reset the qubit map without moving amplitudes, after the data
+     * has been overwritten in logical order.
+     */
+    void resetQubitMap() { qubit_map_.reset(); }
+
+    /**
+     * @brief Set the qubit map without moving amplitudes, after the data has
+     * been overwritten in the layout described by `qubit_map`.
+     */
+    void resetQubitMap(const cuUtil::QubitMap &qubit_map) {
+        qubit_map_ = qubit_map;
+    }
+
+    /**
+     * @brief Logical-to-physical map of the index bits, where wire `w` is
+     * logical bit `num_qubits - 1 - w`.
+     */
+    [[nodiscard]] auto getQubitMap() const -> const cuUtil::QubitMap & {
+        return qubit_map_;
+    }
+
     /**
      * @brief Set value for a single element of the state-vector on device. This
      * method is implemented by cudaMemcpy.
@@ -149,6 +269,8 @@ class StateVectorCudaManaged
         auto stream_id = BaseType::getDataBuffer().getDevTag().getStreamID();
         setBasisState_CUDA(BaseType::getData(), value_cu, index, async,
                            stream_id);
+        resetQubitMap();
+        BaseType::markStateModified();
     }
 
     /**
@@ -182,6 +304,60 @@ class StateVectorCudaManaged
         setStateVector_CUDA(BaseType::getData(), num_elements,
                             d_values.getData(), d_indices.getData(),
                             thread_per_block, stream_id);
+        resetQubitMap();
+        BaseType::markStateModified();
+    }
+
+    /**
+     * @brief Multiply the state vector by a product of diagonal gates in a
+     * single pass.
+     *
+     * @param phase Diagonal phase, where wire `w` is index bit
+     * `num_qubits - 1 - w`.
+     */
+    void applyDiagonalPhase(const cuUtil::DiagonalPhase<Precision> &phase) {
+        applyQubitMap();
+        applyDiagonalPhasePhysical(phase);
+    }
+
+    /**
+     * @brief Apply a compiled Pauli sentence in a single pass over the
+     * state-vector. The result is written to a new buffer, which then
+     * replaces the current one.
+     *
+     * @tparam thread_per_block Number of threads set per block.
+     * @param sentence Pauli sentence compiled for this number of qubits.
+     */
+    template <size_t thread_per_block = 256>
+    void
+    applyPauliSentence(const cuUtil::PauliSentence<Precision> &sentence) {
+        auto result = std::make_unique<DataBuffer<CFP_t>>(
+            BaseType::getLength(), BaseType::getDataBuffer().getDevTag(),
+            true);
+        applyPauliSentenceOutOfPlace<thread_per_block>(sentence,
+                                                       result->getData());
+        BaseType::updateData(std::move(result));
+    }
+
+    /**
+     * @brief Expectation value of a compiled Pauli sentence, computed without
+     * forming its matrix.
+     *
+     * @tparam thread_per_block Number of threads set per block.
+     * @param sentence Pauli sentence compiled for this number of qubits.
+     * @return Precision Expectation value.
+     */
+    template <size_t thread_per_block = 256>
+    auto getExpectationValuePauliSentence(
+        const cuUtil::PauliSentence<Precision> &sentence) -> Precision {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        DataBuffer<CFP_t, int> d_tmp{BaseType::getLength(), dev_tag, true};
+        applyPauliSentenceOutOfPlace<thread_per_block>(sentence,
+                                                       d_tmp.getData());
+        return innerProdC_CUDA(BaseType::getData(), d_tmp.getData(),
+                               BaseType::getLength(), dev_tag.getDeviceID(),
+                               dev_tag.getStreamID(), getCublasCaller())
+            .x;
     }
 
     /**
@@ -209,6 +385,11 @@ class StateVectorCudaManaged
                                             wires.end()};
         if (opName == "Identity") {
             return;
+        } else if (opName == "Measure" || opName == "Reset" ||
+                   opName == "Collapse") {
+            applyMeasurementOperation(opName, wires, adjoint, params);
+        } else if (opName == "SWAP") {
+            applySWAP(wires, adjoint);
         } else if (native_gates_.find(opName) != native_gates_.end()) {
             applyParametricPauliGate({opName}, ctrls, tgts, params.front(),
                                      adjoint);
@@ -284,11 +465,11 @@ class StateVectorCudaManaged
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
-        const auto num_ops = opNames.size();
-        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
-            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
-                           params[op_idx]);
+        if (fusion_max_qubits_ > 0) {
+            applyOperationsFused(opNames, wires, adjoints, params);
+            return;
         }
+        applyOperationsDiagonalBatched(opNames, wires, adjoints, params);
     }
 
     /**
@@ -308,10 +489,72 @@ class StateVectorCudaManaged
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
-        const auto num_ops = opNames.size();
-        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
-            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx]);
+        const std::vector<std::vector<Precision>> params(opNames.size(),
+                                                         {0.0});
+        if (fusion_max_qubits_ > 0) {
+            applyOperationsFused(opNames, wires, adjoints, params);
+            return;
+        }
+        applyOperationsDiagonalBatched(opNames, wires, adjoints, params);
+    }
+
+    /**
+     * @brief Apply a list of operations read in place from a flat op
+     * stream. Runs of operations with dedicated kernels go through the
+     * multi-op `applyOperation`, so that they are fused or batched, while
+     * operations given as matrices are applied one by one.
+     *
+     * @param ops Operations to apply.
+     */
+    void applyOperation(const cuUtil::OpStream<Precision> &ops) {
+        std::vector<std::string> opNames;
+        std::vector<std::vector<size_t>> wires;
+        std::vector<bool> adjoints;
+        std::vector<std::vector<Precision>> params;
+        const auto flush = [&]() {
+            if (!opNames.empty()) {
+                applyOperation(opNames, wires, adjoints, params);
+            }
+            opNames.clear();
+            wires.clear();
+            adjoints.clear();
+            params.clear();
+        };
+        for (std::size_t op = 0; op < ops.getNumOps(); op++) {
+            if (ops.hasMatrix(op)) {
+                flush();
+                applyOperation_std(ops.getName(op), ops.getWires(op),
+                                   ops.getInverse(op), ops.getParams(op),
+                                   ops.getMatrix(op));
+                continue;
+            }
+            opNames.push_back(ops.getName(op));
+            wires.push_back(ops.getWires(op));
+            adjoints.push_back(ops.getInverse(op));
+            params.push_back(ops.getParams(op));
         }
+        flush();
+    }
+
+    /**
+     * @brief Enable fusion of consecutive gates in the multi-op
+     * `applyOperation` calls. Runs of supported gates acting on at most
+     * `max_fused_qubits` qubits are composed on the host into a single dense
+     * matrix and applied with one custatevec call.
+     *
+     * @param max_fused_qubits Largest number of qubits of a fused block. A
+     * value of 0 disables fusion.
+     */
+    void setGateFusion(std::size_t max_fused_qubits) {
+        fusion_max_qubits_ = max_fused_qubits;
+    }
+
+    /**
+     * @brief Get the largest number of qubits of a fused block, with 0
+     * indicating that gate fusion is disabled.
+     */
+    [[nodiscard]] auto getGateFusion() const -> std::size_t {
+        return fusion_max_qubits_;
     }
 
     //****************************************************************************//
@@ -432,11 +675,17 @@ class StateVectorCudaManaged
                               {wires.begin(), wires.end() - 1}, {wires.back()},
                               adjoint);
     }
-    inline void applySWAP(const std::vector<std::size_t> &wires, bool adjoint) {
-        static const std::string name{"SWAP"};
-        static const Precision param = 0.0;
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(name, param), {},
-                              wires, adjoint);
+    /**
+     * @brief Apply a SWAP gate by relabelling the qubit map, without moving
+     * amplitudes.
+     */
+    inline void applySWAP(const std::vector<std::size_t> &wires,
+                          [[maybe_unused]] bool adjoint) {
+        PL_ABORT_IF_NOT(wires.size() == 2, "SWAP requires two wires");
+        const std::size_t num_qubits = BaseType::getNumQubits();
+        qubit_map_.swapLogical(num_qubits - 1 - wires[0],
+                               num_qubits - 1 - wires[1]);
+        BaseType::markStateModified();
     }
     inline void applyIsingXX(const std::vector<std::size_t> &wires,
                              bool adjoint, Precision param) {
@@ -797,146 +1046,379 @@ class StateVectorCudaManaged
         const index_type *csrOffsets_ptr, const index_type csrOffsets_size,
         const index_type *columns_ptr,
         const std::complex<Precision> *values_ptr, const index_type numNNZ) {
+        const cuUtil::DeviceCSRMatrix<Precision, index_type> matrix{
+            csrOffsets_ptr,
+            static_cast<std::size_t>(csrOffsets_size),
+            columns_ptr,
+            values_ptr,
+            static_cast<std::size_t>(numNNZ),
+            BaseType::getDataBuffer().getDevTag()};
+        return getExpectationValueOnSparseSpMV(matrix);
+    }
 
-        const index_type nIndexBits = BaseType::getNumQubits();
-        const index_type length = 1 << nIndexBits;
-        const int64_t num_rows = static_cast<int64_t>(
-            csrOffsets_size -
-            1); // int64_t is required for num_rows by cusparseCreateCsr
-        const int64_t num_cols = static_cast<int64_t>(
-            num_rows); // int64_t is required for num_cols by cusparseCreateCsr
-        const int64_t nnz = static_cast<int64_t>(
-            numNNZ); // int64_t is required for nnz by cusparseCreateCsr
-
-        const CFP_t alpha = {1.0, 0.0};
-        const CFP_t beta = {0.0, 0.0};
+    /**
+     * @brief expval(H) calculation with cuSparseSpMV, for a matrix already
+     * resident on the device of the state vector.
+     *
+     * @tparam index_type Integer type used as indices of the sparse matrix.
+     * @param matrix Device CSR matrix.
+     * @return auto Expectation value.
+     */
+    template <class index_type>
+    auto getExpectationValueOnSparseSpMV(
+        const cuUtil::DeviceCSRMatrix<Precision, index_type> &matrix) {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        DataBuffer<CFP_t, int> d_tmp{BaseType::getLength(), dev_tag, true};
+        applySpMV(matrix, d_tmp.getData());
+
+        const Precision expect =
+            innerProdC_CUDA(BaseType::getData(), d_tmp.getData(),
+                            BaseType::getLength(), dev_tag.getDeviceID(),
+                            dev_tag.getStreamID(), getCublasCaller())
+                .x;
+        return expect;
+    }
 
-        Precision expect = 0;
+    /**
+     * @brief Apply a sparse matrix resident on the device of the state
+     * vector, SV:->H*SV.
+     *
+     * @tparam index_type Integer type used as indices of the sparse matrix.
+     * @param matrix Device CSR matrix.
+     */
+    template <class index_type>
+    void applySparseMatrix(
+        const cuUtil::DeviceCSRMatrix<Precision, index_type> &matrix) {
+        // Transfer ownership after state update
+        auto result = std::make_unique<DataBuffer<CFP_t>>(
+            BaseType::getLength(), BaseType::getDataBuffer().getDevTag(),
+            true);
+        applySpMV(matrix, result->getData());
+        BaseType::updateData(std::move(result));
+    }
 
-        auto device_id = BaseType::getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = BaseType::getDataBuffer().getDevTag().getStreamID();
+    /**
+     * @brief Utility method for probability calculation using given wires.
+     *
+     * @param wires List of wires to return probabilities for in lexicographical
+     * order.
+     * @return std::vector<double>
+     */
+    auto probability(const std::vector<size_t> &wires) -> std::vector<double> {
+        return maskedProbability(wires, {}, {});
+    }
 
-        DataBuffer<index_type, int> d_csrOffsets{
-            static_cast<std::size_t>(csrOffsets_size), device_id, stream_id,
-            true};
-        DataBuffer<index_type, int> d_columns{static_cast<std::size_t>(numNNZ),
-                                              device_id, stream_id, true};
-        DataBuffer<CFP_t, int> d_values{static_cast<std::size_t>(numNNZ),
-                                        device_id, stream_id, true};
-        DataBuffer<CFP_t, int> d_tmp{static_cast<std::size_t>(length),
-                                     device_id, stream_id, true};
+    /**
+     * @brief Probabilities of the given wires, conditioned on other wires
+     * having fixed values. The condition is applied on the device as a
+     * cuStateVec mask, so that only the 2^|wires| conditional table is
+     * returned.
+     *
+     * @param wires List of wires to return probabilities for, with the same
+     * ordering as `probability(wires)`.
+     * @param condition_wires Wires whose values are fixed.
+     * @param condition_bits Value, 0 or 1, of each condition wire.
+     * @return std::vector<double> Probabilities divided by the probability
+     * of the condition.
+     */
+    auto probability(const std::vector<size_t> &wires,
+                     const std::vector<size_t> &condition_wires,
+                     const std::vector<size_t> &condition_bits)
+        -> std::vector<double> {
+        cuUtil::checkCondition(BaseType::getNumQubits(), wires,
+                               condition_wires, condition_bits);
+        auto probabilities =
+            maskedProbability(wires, condition_wires, condition_bits);
+        cuUtil::normalizeConditional(probabilities);
+        return probabilities;
+    }
 
-        d_csrOffsets.CopyHostDataToGpu(csrOffsets_ptr, d_csrOffsets.getLength(),
-                                       false);
-        d_columns.CopyHostDataToGpu(columns_ptr, d_columns.getLength(), false);
-        d_values.CopyHostDataToGpu(values_ptr, d_values.getLength(), false);
+    /**
+     * @brief Project a wire onto a computational basis state and renormalize
+     * the state vector, on the device.
+     *
+     * @param wire Wire to collapse.
+     * @param outcome Value, 0 or 1, of the wire after the collapse.
+     */
+    void collapse(size_t wire, size_t outcome) {
+        PL_ABORT_IF(wire >= BaseType::getNumQubits(), "Invalid wire index");
+        PL_ABORT_IF(outcome > 1, "Measurement outcomes must be 0 or 1");
+        collapseWithProbability(wire, outcome, probability({wire})[outcome]);
+    }
 
-        cudaDataType_t data_type;
-        cusparseIndexType_t compute_type;
+    /**
+     * @brief Measure a wire in the computational basis. The outcome is drawn
+     * from the probabilities of the wire, the state is collapsed onto it, and
+     * it is appended to `getMeasurementOutcomes()`.
+     *
+     * @param wire Wire to measure.
+     * @return size_t Measurement outcome, 0 or 1.
+     */
+    auto measure(size_t wire) -> size_t {
+        const auto outcome = measureWire(wire);
+        measurement_outcomes_.push_back(outcome);
+        return outcome;
+    }
 
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-            compute_type = CUSPARSE_INDEX_64I;
-        } else {
-            data_type = CUDA_C_32F;
-            compute_type = CUSPARSE_INDEX_32I;
+    /**
+     * @brief Reset a wire to |0>, by measuring it and flipping it if the
+     * outcome is 1. The outcome is not recorded.
+     *
+     * @param wire Wire to reset.
+     */
+    void reset(size_t wire) {
+        if (measureWire(wire) == 1) {
+            applyPauliX({wire}, false);
         }
+    }
 
-        // CUSPARSE APIs
-        cusparseSpMatDescr_t mat;
-        cusparseDnVecDescr_t vecX, vecY;
+    /**
+     * @brief Outcomes of the `measure` calls and `Measure` operations, in
+     * the order in which they were applied.
+     */
+    [[nodiscard]] auto getMeasurementOutcomes() const
+        -> const std::vector<size_t> & {
+        return measurement_outcomes_;
+    }
 
-        size_t bufferSize = 0;
-        cusparseHandle_t handle = getCusparseHandle();
+    /**
+     * @brief Seed the random number generator of mid-circuit measurements.
+     *
+     * @param seed Seed value.
+     */
+    void seedMeasurements(size_t seed) { measurement_rng_.seed(seed); }
 
-        // Create sparse matrix A in CSR format
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
-            /* cusparseSpMatDescr_t* */ &mat,
-            /* int64_t */ num_rows,
-            /* int64_t */ num_cols,
-            /* int64_t */ nnz,
-            /* void* */ d_csrOffsets.getData(),
-            /* void* */ d_columns.getData(),
-            /* void* */ d_values.getData(),
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexBase_t */ CUSPARSE_INDEX_BASE_ZERO,
-            /* cudaDataType */ data_type));
+    /**
+     * @brief Utility method for samples.
+     *
+     * @param num_samples Number of Samples
+     *
+     * @return std::vector<size_t> A 1-d array storing the samples.
+     * Each sample has a length equal to the number of qubits. Each sample can
+     * be accessed using the stride sample_id*num_qubits, where sample_id is a
+     * number between 0 and num_samples-1.
+     */
+    auto generate_samples(size_t num_samples) -> std::vector<size_t> {
+        return cuUtil::unpackBitStrings(sampleBitStrings(num_samples),
+                                        BaseType::getNumQubits());
+    }
 
-        // Create dense vector X
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &vecX,
-            /* int64_t */ num_cols,
-            /* void* */ BaseType::getData(),
-            /* cudaDataType */ data_type));
+    /**
+     * @brief Draw samples as packed bit strings.
+     *
+     * @param num_samples Number of Samples
+     * @return std::vector<cuUtil::PackedSample> One integer per sample, in
+     * ascending order, where bit `num_qubits - 1 - w` holds wire `w`.
+     */
+    auto generate_samples_packed(size_t num_samples)
+        -> std::vector<cuUtil::PackedSample> {
+        const auto bit_strings = sampleBitStrings(num_samples);
+        return {bit_strings.begin(), bit_strings.end()};
+    }
 
-        // Create dense vector y
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &vecY,
-            /* int64_t */ num_rows,
-            /* void* */ d_tmp.getData(),
-            /* cudaDataType */ data_type));
+    /**
+     * @brief Draw samples and histogram them.
+     *
+     * @param num_samples Number of Samples
+     * @return cuUtil::SampleCounts Distinct packed bit strings, in ascending
+     * order, and their number of occurrences.
+     */
+    auto generate_counts(size_t num_samples) -> cuUtil::SampleCounts {
+        return cuUtil::countSortedBitStrings(sampleBitStrings(num_samples));
+    }
 
-        // allocate an external buffer if needed
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ mat,
-            /* cusparseDnVecDescr_t */ vecX,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ vecY,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
-            /* size_t* */ &bufferSize));
+    /**
+     * @brief Get expectation value for a sum of Pauli words.
+     *
+     * Words are partitioned into qubit-wise commuting groups. A group is
+     * evaluated from the probabilities of its wires, after rotating a copy of
+     * the state into its eigenbasis, if that takes fewer passes over the state
+     * than leaving its words to the Pauli sentence; the remaining words are
+     * evaluated together as one compiled Pauli sentence. See
+     * `cuUtil::planPauliExpectation`.
+     *
+     * @param pauli_words Vector of Pauli-words to evaluate expectation value.
+     * @param tgts Coupled qubit index to apply each Pauli term.
+     * @param coeffs Numpy array buffer of size |pauli_words|
+     * @return auto Expectation value.
+     */
+    auto getExpectationValuePauliWords(
+        const std::vector<std::string> &pauli_words,
+        const std::vector<std::vector<std::size_t>> &tgts,
+        const std::complex<Precision> *coeffs) -> Precision {
+        const auto plan = cuUtil::planPauliExpectation(pauli_words, tgts);
+        std::vector<double> expect(pauli_words.size());
+        std::unique_ptr<StateVectorCudaManaged> rotated;
+        for (const auto &group : plan.groups) {
+            if (group.isDiagonal()) {
+                cuUtil::groupExpectationValues(probability(group.wires), group,
+                                               expect);
+            } else {
+                if (!rotated) {
+                    rotated = std::make_unique<StateVectorCudaManaged>(*this);
+                } else {
+                    rotated->updateData(*this);
+                }
+                cuUtil::rotateToGroupBasis(*rotated, group);
+                cuUtil::groupExpectationValues(
+                    rotated->probability(group.wires), group, expect);
+            }
+        }
 
-        DataBuffer<cudaDataType_t, int> dBuffer{bufferSize, device_id,
-                                                stream_id, true};
+        Precision result = 0;
+        for (const auto &group : plan.groups) {
+            for (const std::size_t t : group.terms) {
+                result += static_cast<Precision>(expect[t]) *
+                          std::real(coeffs[t]);
+            }
+        }
+        if (!plan.sentence_terms.empty()) {
+            std::vector<Precision> sentence_coeffs;
+            std::vector<std::string> sentence_words;
+            std::vector<std::vector<std::size_t>> sentence_tgts;
+            for (const std::size_t t : plan.sentence_terms) {
+                sentence_coeffs.push_back(std::real(coeffs[t]));
+                sentence_words.push_back(pauli_words[t]);
+                sentence_tgts.push_back(tgts[t]);
+            }
+            result += getExpectationValuePauliSentence(
+                cuUtil::compilePauliSentence(sentence_coeffs, sentence_words,
+                                             sentence_tgts,
+                                             BaseType::getNumQubits()));
+        }
+        return result;
+    }
 
-        // execute SpMV
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ mat,
-            /* cusparseDnVecDescr_t */ vecX,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ vecY,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
-            /* void* */
-            reinterpret_cast<void *>(dBuffer.getData())));
+    /**
+     * @brief Variance of an observable.
+     *
+     * A Pauli word squares to the identity, so only its expectation value is
+     * computed. A diagonal observable takes both moments from one probability
+     * reduction over its wires. Any other observable, e.g. a Hamiltonian, is
+     * applied once to a copy of the state, and the moments are
+     * `<psi|H|psi>` and `||H|psi>||^2`.
+     *
+     * @tparam ObservableT Observable type, e.g. `ObservableGPU<Precision>`.
+     * @param ob Observable.
+     * @return Precision Variance.
+     */
+    template <class ObservableT>
+    auto variance(const ObservableT &ob) -> Precision {
+        std::string word;
+        std::vector<size_t> word_wires;
+        if (ob.appendPauliWord(word, word_wires)) {
+            const std::complex<Precision> one{1.0, 0.0};
+            const auto mean = static_cast<Precision>(
+                getExpectationValuePauliWords({word}, {word_wires}, &one));
+            return 1 - mean * mean;
+        }
+        std::vector<Precision> diag;
+        if (ob.getDiagonal(diag)) {
+            return varianceDiagonal(ob.getWires(), diag);
+        }
+        applyQubitMap();
+        StateVectorCudaManaged h_sv(*this);
+        ob.applyInPlace(h_sv);
+        h_sv.applyQubitMap();
+        return varianceOfApplied(h_sv.getData());
+    }
 
-        // destroy matrix/vector descriptors
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(mat));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecX));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecY));
+    /**
+     * @brief Variance of a diagonal observable, from the probabilities of its
+     * wires.
+     *
+     * @param wires Wires of the observable.
+     * @param diag Diagonal of the observable matrix.
+     * @return Precision Variance.
+     */
+    auto varianceDiagonal(const std::vector<size_t> &wires,
+                          const std::vector<Precision> &diag) -> Precision {
+        const auto [mean, mean_sq] =
+            cuUtil::diagonalMoments(probability(wires), diag);
+        return static_cast<Precision>(mean_sq - mean * mean);
+    }
 
-        expect = innerProdC_CUDA(BaseType::getData(), d_tmp.getData(),
-                                 BaseType::getLength(), device_id, stream_id,
-                                 getCublasCaller())
-                     .x;
+    /**
+     * @brief Access the CublasCaller the object is using.
+     *
+     * @return a reference to the object's CublasCaller object.
+     */
+    auto getCublasCaller() const -> const CublasCaller & {
+        return *cublascaller_;
+    }
 
-        return expect;
+    /**
+     * @brief Get the cuSPARSE handle that the object is using.
+     *
+     * @return cusparseHandle_t returns the cuSPARSE handle.
+     */
+    auto getCusparseHandle() const -> cusparseHandle_t {
+        if (!cusparsehandle_)
+            cusparsehandle_ = make_shared_cusparse_handle();
+        return cusparsehandle_.get();
     }
 
     /**
-     * @brief Utility method for probability calculation using given wires.
+     * @brief Select the allocator of the custatevec workspace arena. The
+     * current workspace is released.
      *
-     * @param wires List of wires to return probabilities for in lexicographical
-     * order.
-     * @return std::vector<double>
+     * @param stream_ordered Use stream-ordered allocations
+     * (`cudaMallocAsync`) from the device memory pool instead of
+     * `cudaMalloc`.
      */
-    auto probability(const std::vector<size_t> &wires) -> std::vector<double> {
+    void setWorkspacePooling(bool stream_ordered) {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        if (stream_ordered) {
+            workspace_.setAllocator(
+                std::make_unique<cuUtil::CudaAsyncWorkspaceAllocator>(dev_tag));
+        } else {
+            workspace_.setAllocator(
+                std::make_unique<cuUtil::CudaWorkspaceAllocator>(dev_tag));
+        }
+    }
+
+    /**
+     * @brief Access the workspace arena shared by the custatevec calls.
+     */
+    auto getWorkspace() const -> const cuUtil::WorkspaceArena & {
+        return workspace_;
+    }
+
+    /**
+     * @brief Release the custatevec workspace, e.g. to free device memory
+     * between circuits. The arena grows again on the next call.
+     */
+    void releaseWorkspace() {
+        sampler_.reset();
+        sampler_workspace_.release();
+        workspace_.release();
+    }
+
+    /**
+     * @brief Whether the cached sampler matches the current state, in which
+     * case sampling skips the custatevec preprocessing step.
+     */
+    [[nodiscard]] auto hasValidSampler() const -> bool {
+        return sampler_ != nullptr &&
+               sampler_version_ == BaseType::getStateVersion();
+    }
+
+  private:
+    /**
+     * @brief Joint probabilities of the given wires and of the mask wires
+     * having the mask bits, i.e. marginal probabilities restricted by a
+     * cuStateVec mask.
+     *
+     * @param wires List of wires to return probabilities for.
+     * @param mask_wires Wires whose values are fixed.
+     * @param mask_bits Value of each mask wire.
+     */
+    auto maskedProbability(const std::vector<size_t> &wires,
+                           const std::vector<size_t> &mask_wires,
+                           const std::vector<size_t> &mask_bits)
+        -> std::vector<double> {
         // Data return type fixed as double in custatevec function call
         std::vector<double> probabilities(Util::exp2(wires.size()));
-        // this should be built upon by the wires not participating
-        int maskLen =
-            0; // static_cast<int>(BaseType::getNumQubits() - wires.size());
-        int *maskBitString = nullptr; //
-        int *maskOrdering = nullptr;
-
         cudaDataType_t data_type;
 
         if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
@@ -947,12 +1429,15 @@ class StateVectorCudaManaged
         }
 
         std::vector<int> wires_int(wires.size());
+        std::vector<int> mask_ordering(mask_wires.size());
+        std::vector<int> mask_bit_string(mask_bits.begin(), mask_bits.end());
 
         // Transform indices between PL & cuQuantum ordering
-        std::transform(
-            wires.begin(), wires.end(), wires_int.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
+        std::transform(wires.begin(), wires.end(), wires_int.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
+        std::transform(mask_wires.begin(), mask_wires.end(),
+                       mask_ordering.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         PL_CUSTATEVEC_IS_SUCCESS(custatevecAbs2SumArray(
             /* custatevecHandle_t */ handle_.get(),
@@ -962,37 +1447,87 @@ class StateVectorCudaManaged
             /* double* */ probabilities.data(),
             /* const int32_t* */ wires_int.data(),
             /* const uint32_t */ wires_int.size(),
-            /* const int32_t* */ maskBitString,
-            /* const int32_t* */ maskOrdering,
-            /* const uint32_t */ maskLen));
+            /* const int32_t* */ mask_bit_string.data(),
+            /* const int32_t* */ mask_ordering.data(),
+            /* const uint32_t */ mask_ordering.size()));
 
         return probabilities;
     }
 
     /**
-     * @brief Utility method for samples.
-     *
-     * @param num_samples Number of Samples
+     * @brief Variance of an observable `H`, given `H|psi>` on the device.
      *
-     * @return std::vector<size_t> A 1-d array storing the samples.
-     * Each sample has a length equal to the number of qubits. Each sample can
-     * be accessed using the stride sample_id*num_qubits, where sample_id is a
-     * number between 0 and num_samples-1.
+     * @param h_psi Observable applied to the state vector.
      */
-    auto generate_samples(size_t num_samples) -> std::vector<size_t> {
-
-        std::vector<double> rand_nums(num_samples);
-        custatevecSamplerDescriptor_t sampler;
+    auto varianceOfApplied(const CFP_t *h_psi) -> Precision {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const Precision mean =
+            innerProdC_CUDA(getData(), h_psi, BaseType::getLength(),
+                            dev_tag.getDeviceID(), dev_tag.getStreamID(),
+                            getCublasCaller())
+                .x;
+        const Precision mean_sq =
+            innerProdC_CUDA(h_psi, h_psi, BaseType::getLength(),
+                            dev_tag.getDeviceID(), dev_tag.getStreamID(),
+                            getCublasCaller())
+                .x;
+        return mean_sq - mean * mean;
+    }
 
-        const size_t num_qubits = BaseType::getNumQubits();
-        const int bitStringLen = BaseType::getNumQubits();
+    /**
+     * @brief Write the product of a compiled Pauli sentence and the
+     * state-vector to `out`.
+     *
+     * @tparam thread_per_block Number of threads set per block.
+     * @param sentence Pauli sentence compiled for this number of qubits.
+     * @param out Device buffer of the length of the state vector.
+     */
+    template <size_t thread_per_block>
+    void applyPauliSentenceOutOfPlace(
+        const cuUtil::PauliSentence<Precision> &sentence, CFP_t *out) {
+        applyQubitMap();
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const size_t num_groups = sentence.getNumGroups();
+        const size_t num_terms = sentence.getNumTerms();
+
+        DataBuffer<uint64_t, int> d_x_masks{num_groups, dev_tag, true};
+        DataBuffer<size_t, int> d_group_offsets{num_groups + 1, dev_tag, true};
+        DataBuffer<uint64_t, int> d_z_masks{num_terms, dev_tag, true};
+        DataBuffer<CFP_t, int> d_coeffs{num_terms, dev_tag, true};
+        d_x_masks.CopyHostDataToGpu(sentence.x_masks.data(), num_groups);
+        d_group_offsets.CopyHostDataToGpu(sentence.group_offsets.data(),
+                                          num_groups + 1);
+        d_z_masks.CopyHostDataToGpu(sentence.z_masks.data(), num_terms);
+        d_coeffs.CopyHostDataToGpu(sentence.coeffs.data(), num_terms);
+
+        applyPauliSentence_CUDA(BaseType::getData(), out, BaseType::getLength(),
+                                d_x_masks.getData(), d_group_offsets.getData(),
+                                num_groups, d_z_masks.getData(),
+                                d_coeffs.getData(), false, thread_per_block,
+                                dev_tag.getStreamID());
+    }
 
-        std::vector<int> bitOrdering(num_qubits);
-        std::iota(std::begin(bitOrdering), std::end(bitOrdering),
-                  0); // Fill with 0, 1, ...,
+    /**
+     * @brief Compute out = matrix * SV with cuSparseSpMV.
+     *
+     * @param matrix Device CSR matrix.
+     * @param out Device buffer of the length of the state vector.
+     */
+    template <class index_type>
+    void
+    applySpMV(const cuUtil::DeviceCSRMatrix<Precision, index_type> &matrix,
+              CFP_t *out) {
+        applyQubitMap();
+        PL_ABORT_IF_NOT(matrix.getNumRows() == BaseType::getLength(),
+                        "The sparse matrix does not match the state vector");
+        PL_ABORT_IF_NOT(matrix.getDevTag().getDeviceID() ==
+                            BaseType::getDataBuffer().getDevTag().getDeviceID(),
+                        "The sparse matrix is on another device");
 
+        const CFP_t alpha = {1.0, 0.0};
+        const CFP_t beta = {0.0, 0.0};
+        const auto length = static_cast<int64_t>(BaseType::getLength());
         cudaDataType_t data_type;
-
         if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
                       std::is_same_v<CFP_t, double2>) {
             data_type = CUDA_C_64F;
@@ -1000,179 +1535,237 @@ class StateVectorCudaManaged
             data_type = CUDA_C_32F;
         }
 
-        std::mt19937 gen(std::random_device{}());
-        std::uniform_real_distribution<Precision> dis(0.0, 1.0);
-        for (size_t n = 0; n < num_samples; n++) {
-            rand_nums[n] = dis(gen);
-        }
-        std::vector<size_t> samples(num_samples * num_qubits, 0);
-        std::unordered_map<size_t, size_t> cache;
-        std::vector<custatevecIndex_t> bitStrings(num_samples);
+        cusparseHandle_t handle = getCusparseHandle();
+        cusparseDnVecDescr_t vecX, vecY;
+        size_t bufferSize = 0;
 
-        void *extraWorkspace = nullptr;
-        size_t extraWorkspaceSizeInBytes = 0;
-        // create sampler and check the size of external workspace
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerCreate(
-            handle_.get(), BaseType::getData(), data_type, num_qubits, &sampler,
-            num_samples, &extraWorkspaceSizeInBytes));
+        // Create dense vector X
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            /* cusparseDnVecDescr_t* */ &vecX,
+            /* int64_t */ length,
+            /* void* */ BaseType::getData(),
+            /* cudaDataType */ data_type));
 
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0)
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
+        // Create dense vector y
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            /* cusparseDnVecDescr_t* */ &vecY,
+            /* int64_t */ length,
+            /* void* */ out,
+            /* cudaDataType */ data_type));
 
-        // sample preprocess
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerPreprocess(
-            handle_.get(), sampler, extraWorkspace, extraWorkspaceSizeInBytes));
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
+            /* cusparseHandle_t */ handle,
+            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
+            /* const void* */ &alpha,
+            /* cusparseSpMatDescr_t */ matrix.getDescriptor(),
+            /* cusparseDnVecDescr_t */ vecX,
+            /* const void* */ &beta,
+            /* cusparseDnVecDescr_t */ vecY,
+            /* cudaDataType */ data_type,
+            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
+            /* size_t* */ &bufferSize));
 
-        // sample bit strings
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerSample(
-            handle_.get(), sampler, bitStrings.data(), bitOrdering.data(),
-            bitStringLen, rand_nums.data(), num_samples,
-            CUSTATEVEC_SAMPLER_OUTPUT_ASCENDING_ORDER));
+        // reuse the workspace arena, growing it if necessary
+        void *dBuffer = workspace_.acquire(bufferSize);
 
-        // destroy descriptor and handle
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerDestroy(sampler));
-
-        // Pick samples
-        for (size_t i = 0; i < num_samples; i++) {
-            auto idx = bitStrings[i];
-            // If cached, retrieve sample from cache
-            if (cache.count(idx) != 0) {
-                size_t cache_id = cache[idx];
-                auto it_temp = samples.begin() + cache_id * num_qubits;
-                std::copy(it_temp, it_temp + num_qubits,
-                          samples.begin() + i * num_qubits);
-            }
-            // If not cached, compute
-            else {
-                for (size_t j = 0; j < num_qubits; j++) {
-                    samples[i * num_qubits + (num_qubits - 1 - j)] =
-                        (idx >> j) & 1U;
-                }
-                cache[idx] = i;
-            }
-        }
+        // execute SpMV
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
+            /* cusparseHandle_t */ handle,
+            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
+            /* const void* */ &alpha,
+            /* cusparseSpMatDescr_t */ matrix.getDescriptor(),
+            /* cusparseDnVecDescr_t */ vecX,
+            /* const void* */ &beta,
+            /* cusparseDnVecDescr_t */ vecY,
+            /* cudaDataType */ data_type,
+            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
+            /* void* */ dBuffer));
+
+        // destroy vector descriptors; the matrix descriptor is owned by
+        // `matrix`
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecX));
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecY));
+    }
 
-        if (extraWorkspaceSizeInBytes > 0)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+    SharedCusvHandle handle_;
+    SharedCublasCaller cublascaller_;
+    mutable SharedCusparseHandle
+        cusparsehandle_; // This member is mutable to allow lazy initialization.
+    GateCache<Precision> gate_cache_;
+    std::size_t fusion_max_qubits_{0};
+    // Scratch memory shared by every custatevec call requiring a workspace.
+    cuUtil::WorkspaceArena workspace_{
+        std::make_unique<cuUtil::CudaWorkspaceAllocator>(
+            BaseType::getDataBuffer().getDevTag())};
+    // Workspace of the cached sampler, holding its preprocessed prefix sums.
+    cuUtil::WorkspaceArena sampler_workspace_{
+        std::make_unique<cuUtil::CudaWorkspaceAllocator>(
+            BaseType::getDataBuffer().getDevTag())};
+    // Sampler preprocessed for the state at version `sampler_version_`,
+    // destroyed before its workspace.
+    std::unique_ptr<std::remove_pointer_t<custatevecSamplerDescriptor_t>,
+                    cuUtil::HandleDeleter>
+        sampler_;
+    std::size_t sampler_version_{0};
+    std::size_t sampler_max_shots_{0};
+    // Logical-to-physical map of the index bits, applied lazily when the
+    // amplitudes are read.
+    cuUtil::QubitMap qubit_map_{BaseType::getNumQubits()};
+    // Generator and outcomes of the mid-circuit measurements.
+    std::mt19937 measurement_rng_{std::random_device{}()};
+    std::vector<size_t> measurement_outcomes_;
 
-        return samples;
+    /**
+     * @brief Apply a `Measure`, `Reset` or `Collapse` operation, the latter
+     * taking its outcome as parameter.
+     */
+    void applyMeasurementOperation(const std::string &opName,
+                                   const std::vector<size_t> &wires,
+                                   bool adjoint,
+                                   const std::vector<Precision> &params) {
+        PL_ABORT_IF(adjoint, "Measurement operations have no adjoint");
+        PL_ABORT_IF_NOT(wires.size() == 1, "Invalid number of wires");
+        if (opName == "Measure") {
+            measure(wires[0]);
+        } else if (opName == "Reset") {
+            reset(wires[0]);
+        } else {
+            PL_ABORT_IF(params.empty(), "Collapse requires an outcome");
+            collapse(wires[0], static_cast<size_t>(params[0]));
+        }
     }
 
     /**
-     * @brief Get expectation value for a sum of Pauli words.
-     *
-     * @param pauli_words Vector of Pauli-words to evaluate expectation value.
-     * @param tgts Coupled qubit index to apply each Pauli term.
-     * @param coeffs Numpy array buffer of size |pauli_words|
-     * @return auto Expectation value.
+     * @brief Draw the outcome of a measurement of a wire and collapse the
+     * state onto it.
      */
-    auto getExpectationValuePauliWords(
-        const std::vector<std::string> &pauli_words,
-        const std::vector<std::vector<std::size_t>> &tgts,
-        const std::complex<Precision> *coeffs) {
+    auto measureWire(size_t wire) -> size_t {
+        PL_ABORT_IF(wire >= BaseType::getNumQubits(), "Invalid wire index");
+        const auto probabilities = probability({wire});
+        std::uniform_real_distribution<double> dis(0.0, 1.0);
+        const size_t outcome = dis(measurement_rng_) < probabilities[0] ? 0 : 1;
+        collapseWithProbability(wire, outcome, probabilities[outcome]);
+        return outcome;
+    }
 
-        uint32_t nIndexBits = static_cast<uint32_t>(BaseType::getNumQubits());
+    /**
+     * @brief Collapse a wire onto an outcome of known probability, zeroing the
+     * other amplitudes and dividing the remaining ones by the square root of
+     * the probability in a single cuStateVec call.
+     */
+    void collapseWithProbability(size_t wire, size_t outcome,
+                                 double outcome_probability) {
+        PL_ABORT_IF_NOT(outcome_probability > 0.0,
+                        "The measurement outcome has zero probability");
         cudaDataType_t data_type;
-
         if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
                       std::is_same_v<CFP_t, double2>) {
             data_type = CUDA_C_64F;
         } else {
             data_type = CUDA_C_32F;
         }
-
-        // Note: due to API design, cuStateVec assumes this is always a double.
-        // Push NVIDIA to move this to behind API for future releases, and
-        // support 32/64 bits.
-        std::vector<double> expect(pauli_words.size());
-
-        std::vector<std::vector<custatevecPauli_t>> pauliOps;
-
-        std::vector<custatevecPauli_t *> pauliOps_ptr;
-
-        for (auto &p_word : pauli_words) {
-            pauliOps.push_back(cuUtil::pauliStringToEnum(p_word));
-            pauliOps_ptr.push_back((*pauliOps.rbegin()).data());
-        }
-
-        std::vector<std::vector<int32_t>> basisBits;
-        std::vector<int32_t *> basisBits_ptr;
-        std::vector<uint32_t> n_basisBits;
-
-        for (auto &wires : tgts) {
-            std::vector<int32_t> wiresInt(wires.size());
-            std::transform(wires.begin(), wires.end(), wiresInt.begin(),
-                           [&](std::size_t x) {
-                               return static_cast<int>(
-                                   BaseType::getNumQubits() - 1 - x);
-                           });
-            basisBits.push_back(wiresInt);
-            basisBits_ptr.push_back((*basisBits.rbegin()).data());
-            n_basisBits.push_back(wiresInt.size());
-        }
-
-        // compute expectation
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectationsOnPauliBasis(
+        const int32_t basis_bit = toIndexBit(wire);
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecCollapseOnZBasis(
             /* custatevecHandle_t */ handle_.get(),
             /* void* */ BaseType::getData(),
             /* cudaDataType_t */ data_type,
-            /* const uint32_t */ nIndexBits,
-            /* double* */ expect.data(),
-            /* const custatevecPauli_t ** */
-            const_cast<const custatevecPauli_t **>(pauliOps_ptr.data()),
-            /* const uint32_t */ static_cast<uint32_t>(pauliOps.size()),
-            /* const int32_t ** */
-            const_cast<const int32_t **>(basisBits_ptr.data()),
-            /* const uint32_t */ n_basisBits.data()));
-
-        std::complex<Precision> result{0, 0};
-
-        if constexpr (std::is_same_v<Precision, double>) {
-            for (std::size_t idx = 0; idx < expect.size(); idx++) {
-                result += expect[idx] * coeffs[idx];
-            }
-            return std::real(result);
-        } else {
-            std::vector<Precision> expect_cast(expect.size());
-            std::transform(expect.begin(), expect.end(), expect_cast.begin(),
-                           [](double x) { return static_cast<float>(x); });
-
-            for (std::size_t idx = 0; idx < expect_cast.size(); idx++) {
-                result += expect_cast[idx] * coeffs[idx];
-            }
-
-            return std::real(result);
-        }
+            /* const uint32_t */ BaseType::getNumQubits(),
+            /* const int32_t */ static_cast<int32_t>(outcome),
+            /* const int32_t* */ &basis_bit,
+            /* const uint32_t */ 1,
+            /* double */ outcome_probability));
+        BaseType::markStateModified();
     }
 
     /**
-     * @brief Access the CublasCaller the object is using.
-     *
-     * @return a reference to the object's CublasCaller object.
+     * @brief Host matrix generators of the gates supported by gate fusion.
      */
-    auto getCublasCaller() const -> const CublasCaller & {
-        return *cublascaller_;
-    }
+    const cuGates::DenseGateMap<CFP_t, Precision> &fusable_gates_{
+        cuGates::getDenseGateMap<CFP_t, Precision>()};
 
     /**
-     * @brief Get the cuSPARSE handle that the object is using.
+     * @brief Apply a list of operations, fusing runs of supported gates into
+     * dense matrices of at most `fusion_max_qubits_` qubits.
      *
-     * @return cusparseHandle_t returns the cuSPARSE handle.
+     * @param opNames Name of each gate.
+     * @param wires Wires of each gate.
+     * @param adjoints Indicates whether to use the adjoint of each gate.
+     * @param params Parameters of each gate.
      */
-    auto getCusparseHandle() const -> cusparseHandle_t {
-        if (!cusparsehandle_)
-            cusparsehandle_ = make_shared_cusparse_handle();
-        return cusparsehandle_.get();
-    }
+    void
+    applyOperationsFused(const std::vector<std::string> &opNames,
+                         const std::vector<std::vector<size_t>> &wires,
+                         const std::vector<bool> &adjoints,
+                         const std::vector<std::vector<Precision>> &params) {
+        const auto num_ops = opNames.size();
+        std::vector<bool> fusable(num_ops);
+        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+            // SWAP gates only relabel the qubit map.
+            fusable[op_idx] =
+                opNames[op_idx] != "SWAP" &&
+                fusable_gates_.find(opNames[op_idx]) != fusable_gates_.end();
+        }
 
-  private:
-    SharedCusvHandle handle_;
-    SharedCublasCaller cublascaller_;
-    mutable SharedCusparseHandle
-        cusparsehandle_; // This member is mutable to allow lazy initialization.
-    GateCache<Precision> gate_cache_;
+        const GateFusionPlanner planner{fusion_max_qubits_};
+        const auto blocks = planner.plan(wires, fusable);
+
+        // Compose every fused block on the host first, so that all of them
+        // are uploaded to the device in a single transfer.
+        std::vector<CFP_t> fused_host;
+        std::vector<std::size_t> fused_offsets;
+        for (const auto &block : blocks) {
+            if (!block.fused) {
+                continue;
+            }
+            const auto block_size = block.op_indices.size();
+            std::vector<std::vector<ComplexT>> matrices(block_size);
+            std::vector<std::vector<std::size_t>> gate_wires(block_size);
+            std::vector<bool> gate_adjoints(block_size);
+            for (std::size_t i = 0; i < block_size; i++) {
+                const auto op_idx = block.op_indices[i];
+                const auto matrix_cu =
+                    fusable_gates_.at(opNames[op_idx])(params[op_idx]);
+                matrices[i].resize(matrix_cu.size());
+                std::transform(matrix_cu.begin(), matrix_cu.end(),
+                               matrices[i].begin(), [](const CFP_t &x) {
+                                   return cuUtil::cuToComplex<CFP_t>(x);
+                               });
+                gate_wires[i] = wires[op_idx];
+                gate_adjoints[i] = adjoints[op_idx];
+            }
+
+            const auto fused = composeFusedMatrix<Precision>(
+                block.wires, matrices, gate_wires, gate_adjoints);
+            fused_offsets.push_back(fused_host.size());
+            std::transform(fused.begin(), fused.end(),
+                           std::back_inserter(fused_host),
+                           [](const ComplexT &x) {
+                               return cuUtil::complexToCu<ComplexT>(x);
+                           });
+        }
+        std::unique_ptr<DataBuffer<CFP_t, int>> d_fused;
+        if (!fused_host.empty()) {
+            d_fused = std::make_unique<DataBuffer<CFP_t, int>>(
+                fused_host.size(), BaseType::getDataBuffer().getDevTag(), true);
+            d_fused->CopyHostDataToGpu(fused_host.data(), fused_host.size());
+        }
+
+        std::size_t fused_idx = 0;
+        for (const auto &block : blocks) {
+            if (!block.fused) {
+                const auto op_idx = block.op_indices.front();
+                applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
+                               params[op_idx]);
+                continue;
+            }
+            // ensure wire indexing correctly preserved for the dense matrix
+            const std::vector<std::size_t> tgts_local{block.wires.rbegin(),
+                                                      block.wires.rend()};
+            applyDeviceMatrixGate(d_fused->getData() +
+                                      fused_offsets[fused_idx++],
+                                  {}, tgts_local, false);
+        }
+    }
     using ParFunc = std::function<void(const std::vector<size_t> &, bool,
                                        const std::vector<Precision> &)>;
     using FMap = std::unordered_map<std::string, ParFunc>;
@@ -1310,6 +1903,91 @@ class StateVectorCudaManaged
         {"CRY", CUSTATEVEC_PAULI_Y},      {"CRZ", CUSTATEVEC_PAULI_Z},
         {"Identity", CUSTATEVEC_PAULI_I}, {"I", CUSTATEVEC_PAULI_I}};
 
+    /**
+     * @brief Apply gates one by one, except for runs of at least two diagonal
+     * gates, which are collapsed into one DiagonalPhase and applied in a
+     * single pass. SWAP gates only relabel qubits and do not end a run.
+     */
+    void applyOperationsDiagonalBatched(
+        const std::vector<std::string> &opNames,
+        const std::vector<std::vector<size_t>> &wires,
+        const std::vector<bool> &adjoints,
+        const std::vector<std::vector<Precision>> &params) {
+        cuUtil::DiagonalPhase<Precision> phase;
+        std::size_t run_start = 0;
+        const auto flush = [&]() {
+            if (phase.getNumGates() == 1) {
+                applyOperation(opNames[run_start], wires[run_start],
+                               adjoints[run_start], params[run_start]);
+            } else if (phase.getNumGates() > 1) {
+                applyDiagonalPhasePhysical(phase);
+            }
+            phase.clear();
+        };
+        for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+            // The phase is on physical bits, so a relabelling SWAP does not
+            // affect it. A single pending gate is applied by wire, hence
+            // before the SWAP.
+            if (opNames[op_idx] == "SWAP" && phase.getNumGates() != 1) {
+                applySWAP(wires[op_idx], adjoints[op_idx]);
+                continue;
+            }
+            if (!cuUtil::isDiagonalGate(opNames[op_idx])) {
+                flush();
+                applyOperation(opNames[op_idx], wires[op_idx],
+                               adjoints[op_idx], params[op_idx]);
+                continue;
+            }
+            if (phase.getNumGates() == 0) {
+                run_start = op_idx;
+            }
+            std::vector<std::size_t> bits(wires[op_idx].size());
+            std::transform(wires[op_idx].begin(), wires[op_idx].end(),
+                           bits.begin(), [&](std::size_t w) {
+                               PL_ABORT_IF(w >= BaseType::getNumQubits(),
+                                           "Invalid wire index");
+                               return static_cast<std::size_t>(toIndexBit(w));
+                           });
+            phase.addGate(opNames[op_idx], bits,
+                          params[op_idx].empty() ? 0 : params[op_idx].front(),
+                          adjoints[op_idx]);
+        }
+        flush();
+    }
+
+    /**
+     * @brief Multiply the amplitudes by a diagonal phase on the physical
+     * index bits.
+     */
+    template <size_t thread_per_block = 256>
+    void
+    applyDiagonalPhasePhysical(const cuUtil::DiagonalPhase<Precision> &phase) {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const size_t num_terms = phase.getNumTerms();
+        if (num_terms == 0) {
+            return;
+        }
+        DataBuffer<uint64_t, int> d_z_masks{num_terms, dev_tag, true};
+        DataBuffer<Precision, int> d_angles{num_terms, dev_tag, true};
+        d_z_masks.CopyHostDataToGpu(phase.getZMasks().data(), num_terms);
+        d_angles.CopyHostDataToGpu(phase.getAngles().data(), num_terms);
+
+        applyDiagonalPhase_CUDA(BaseType::getData(), BaseType::getLength(), 0,
+                                d_z_masks.getData(), d_angles.getData(),
+                                num_terms, thread_per_block,
+                                dev_tag.getStreamID());
+        BaseType::markStateModified();
+    }
+
+    /**
+     * @brief Physical index bit of a wire, combining the PennyLane to
+     * cuQuantum ordering with the qubit map.
+     */
+    [[nodiscard]] auto toIndexBit(std::size_t wire) const -> int {
+        return static_cast<int>(qubit_map_.getPhysicalBit(
+            BaseType::getNumQubits() - 1 - wire));
+    }
+
     /**
      * @brief Normalize the index ordering to match PennyLane.
      *
@@ -1346,14 +2024,10 @@ class StateVectorCudaManaged
         std::vector<int> tgtsInt(tgts.size());
 
         // Transform indices between PL & cuQuantum ordering
-        std::transform(
-            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
+        std::transform(ctrls.begin(), ctrls.end(), ctrlsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         cudaDataType_t data_type;
 
@@ -1383,6 +2057,7 @@ class StateVectorCudaManaged
             /* const int32_t* */ ctrlsInt.data(),
             /* const int32_t* */ nullptr,
             /* const uint32_t */ ctrls.size()));
+        BaseType::markStateModified();
     }
 
     /**
@@ -1408,14 +2083,10 @@ class StateVectorCudaManaged
         std::vector<int> ctrlsInt(ctrls.size());
         std::vector<int> tgtsInt(tgts.size());
 
-        std::transform(
-            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
+        std::transform(ctrls.begin(), ctrls.end(), ctrlsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         cudaDataType_t data_type;
         custatevecComputeType_t compute_type;
@@ -1443,11 +2114,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse the workspace arena, growing it if necessary
+        extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
 
         // apply gate
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrix(
@@ -1467,8 +2135,7 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        BaseType::markStateModified();
     }
 
     /**
@@ -1492,14 +2159,10 @@ class StateVectorCudaManaged
         std::vector<int> ctrlsInt(ctrls.size());
         std::vector<int> tgtsInt(tgts.size());
 
-        std::transform(
-            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
+        std::transform(ctrls.begin(), ctrls.end(), ctrlsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         cudaDataType_t data_type;
         custatevecComputeType_t compute_type;
@@ -1527,11 +2190,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse the workspace arena, growing it if necessary
+        extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
 
         // apply gate
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrix(
@@ -1551,8 +2211,7 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        BaseType::markStateModified();
     }
     void applyHostMatrixGate(const std::vector<std::complex<Precision>> &matrix,
                              const std::vector<std::size_t> &ctrls,
@@ -1567,6 +2226,86 @@ class StateVectorCudaManaged
         applyHostMatrixGate(matrix_cu, ctrls, tgts, use_adjoint);
     }
 
+    /**
+     * @brief Create and preprocess a sampler for the current state.
+     *
+     * @param max_shots Maximum number of shots of a single sampling call.
+     */
+    void preprocessSampler(size_t max_shots) {
+        cudaDataType_t data_type;
+
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+
+        sampler_.reset();
+        custatevecSamplerDescriptor_t sampler;
+        size_t extraWorkspaceSizeInBytes = 0;
+        // create sampler and check the size of external workspace
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerCreate(
+            handle_.get(), BaseType::getData(), data_type,
+            BaseType::getNumQubits(), &sampler, max_shots,
+            &extraWorkspaceSizeInBytes));
+        sampler_.reset(sampler);
+
+        // the workspace keeps the prefix sums until the sampler is destroyed
+        void *extraWorkspace =
+            sampler_workspace_.acquire(extraWorkspaceSizeInBytes);
+
+        // sample preprocess
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerPreprocess(
+            handle_.get(), sampler, extraWorkspace, extraWorkspaceSizeInBytes));
+
+        sampler_version_ = BaseType::getStateVersion();
+        sampler_max_shots_ = max_shots;
+    }
+
+    /**
+     * @brief Draw samples from the current state with the custatevec sampler.
+     *
+     * The preprocessed sampler is cached until the state is modified, so
+     * repeated sampling of the same state skips the O(2^n) prefix sum.
+     *
+     * @param num_samples Number of Samples
+     * @return std::vector<custatevecIndex_t> Sampled basis-state indices, in
+     * ascending order, with bit `num_qubits - 1 - w` holding wire `w`.
+     */
+    auto sampleBitStrings(size_t num_samples)
+        -> std::vector<custatevecIndex_t> {
+        // The sampler holds the cumulative distribution of the logical
+        // layout.
+        applyQubitMap();
+        if (!hasValidSampler() || sampler_max_shots_ < num_samples) {
+            preprocessSampler(num_samples);
+        }
+
+        const size_t num_qubits = BaseType::getNumQubits();
+        const int bitStringLen = BaseType::getNumQubits();
+
+        std::vector<int> bitOrdering(num_qubits);
+        std::iota(std::begin(bitOrdering), std::end(bitOrdering),
+                  0); // Fill with 0, 1, ...,
+
+        std::vector<double> rand_nums(num_samples);
+        std::mt19937 gen(std::random_device{}());
+        std::uniform_real_distribution<Precision> dis(0.0, 1.0);
+        for (size_t n = 0; n < num_samples; n++) {
+            rand_nums[n] = dis(gen);
+        }
+        std::vector<custatevecIndex_t> bitStrings(num_samples);
+
+        // sample bit strings
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerSample(
+            handle_.get(), sampler_.get(), bitStrings.data(),
+            bitOrdering.data(), bitStringLen, rand_nums.data(), num_samples,
+            CUSTATEVEC_SAMPLER_OUTPUT_ASCENDING_ORDER));
+
+        return bitStrings;
+    }
+
     /**
      * @brief Get expectation of a given host-defined matrix.
      *
@@ -1580,10 +2319,8 @@ class StateVectorCudaManaged
         size_t extraWorkspaceSizeInBytes = 0;
 
         std::vector<int> tgtsInt(tgts.size());
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         size_t nIndexBits = BaseType::getNumQubits();
         cudaDataType_t data_type;
@@ -1610,10 +2347,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse the workspace arena, growing it if necessary
+        extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
 
         CFP_t expect;
 
@@ -1634,8 +2369,6 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
         return expect;
     }
 
@@ -1652,10 +2385,8 @@ class StateVectorCudaManaged
         size_t extraWorkspaceSizeInBytes = 0;
 
         std::vector<int> tgtsInt(tgts.size());
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
+        std::transform(tgts.begin(), tgts.end(), tgtsInt.begin(),
+                       [&](std::size_t x) { return toIndexBit(x); });
 
         size_t nIndexBits = BaseType::getNumQubits();
         cudaDataType_t data_type;
@@ -1682,10 +2413,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse the workspace arena, growing it if necessary
+        extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
 
         CFP_t expect;
 
@@ -1707,8 +2436,6 @@ class StateVectorCudaManaged
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
         return expect;
     }
 };
@@ -1,15 +1,21 @@
 #pragma once
 
+#include <bit>
 #include <cmath>
 #include <complex>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "DataBuffer.hpp"
 #include "DevTag.hpp"
 #include "Gates.hpp"
+#include "LRUCache.hpp"
 #include "cuda.h"
 #include "cuda_helpers.hpp"
 
@@ -26,6 +32,11 @@ namespace Pennylane::CUDA {
 /**
  * @brief Represents a cache for gate data to be accessible on the device.
  *
+ * Gates are indexed by the gate name and the (optionally quantized) parameter
+ * value. The cache is bounded by a byte budget: once it
+ * is exceeded, the least-recently-used parametric gates are evicted. Gates of
+ * the default gate-set are pinned and never evicted.
+ *
  * @tparam fp_t Floating point precision.
  */
 template <class fp_t> class GateCache {
@@ -33,17 +44,24 @@ template <class fp_t> class GateCache {
     using CFP_t = decltype(cuUtil::getCudaType(fp_t{}));
     using gate_id = std::pair<std::string, fp_t>;
 
+    /**
+     * @brief Default byte budget of the cache.
+     */
+    static constexpr std::size_t default_max_alloc_bytes = 32UL * 1024 * 1024;
+
     GateCache() = delete;
     GateCache(const GateCache &other) = delete;
     GateCache(GateCache &&other) = delete;
-    GateCache(bool populate, int device_id = 0, cudaStream_t stream_id = 0)
-        : device_tag_(device_id, stream_id), total_alloc_bytes_{0} {
+    GateCache(bool populate, int device_id = 0, cudaStream_t stream_id = 0,
+              std::size_t max_alloc_bytes = default_max_alloc_bytes)
+        : device_tag_(device_id, stream_id), cache_{max_alloc_bytes} {
         if (populate) {
             defaultPopulateCache();
         }
     }
-    GateCache(bool populate, const DevTag<int> &device_tag)
-        : device_tag_{device_tag}, total_alloc_bytes_{0} {
+    GateCache(bool populate, const DevTag<int> &device_tag,
+              std::size_t max_alloc_bytes = default_max_alloc_bytes)
+        : device_tag_{device_tag}, cache_{max_alloc_bytes} {
         if (populate) {
             defaultPopulateCache();
         }
@@ -54,125 +72,77 @@ template <class fp_t> class GateCache {
      * @brief Add a default gate-set to the given cache. Assumes
      * initializer-list evaluated gates for "PauliX", "PauliY", "PauliZ",
      * "Hadamard", "S", "T", "SWAP", with "CNOT" and "CZ" represented as their
-     * single-qubit values.
+     * single-qubit values. These gates are pinned in the cache.
      *
      */
     void defaultPopulateCache() {
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"Identity"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>()}));
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"PauliX"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>()}));
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"PauliY"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ZERO<CFP_t>(), -cuUtil::IMAG<CFP_t>(),
-                cuUtil::IMAG<CFP_t>(), cuUtil::ZERO<CFP_t>()}));
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"PauliZ"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), -cuUtil::ONE<CFP_t>()}));
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"Hadamard"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::INVSQRT2<CFP_t>(), cuUtil::INVSQRT2<CFP_t>(),
-                cuUtil::INVSQRT2<CFP_t>(), -cuUtil::INVSQRT2<CFP_t>()}));
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"S"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::IMAG<CFP_t>()}));
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"T"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(),
-                cuUtil::ConstMultSC(cuUtil::SQRT2<fp_t>() / 2.0,
-                                    cuUtil::ConstSum(cuUtil::ONE<CFP_t>(),
-                                                     cuUtil::IMAG<CFP_t>()))}));
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"SWAP"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>()}));
+        add_default_gate("Identity",
+                         {cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                          cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>()});
+        add_default_gate("PauliX",
+                         {cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
+                          cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>()});
+        add_default_gate("PauliY",
+                         {cuUtil::ZERO<CFP_t>(), -cuUtil::IMAG<CFP_t>(),
+                          cuUtil::IMAG<CFP_t>(), cuUtil::ZERO<CFP_t>()});
+        add_default_gate("PauliZ",
+                         {cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                          cuUtil::ZERO<CFP_t>(), -cuUtil::ONE<CFP_t>()});
+        add_default_gate("Hadamard",
+                         {cuUtil::INVSQRT2<CFP_t>(), cuUtil::INVSQRT2<CFP_t>(),
+                          cuUtil::INVSQRT2<CFP_t>(),
+                          -cuUtil::INVSQRT2<CFP_t>()});
+        add_default_gate("S", {cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                               cuUtil::ZERO<CFP_t>(), cuUtil::IMAG<CFP_t>()});
+        add_default_gate(
+            "T",
+            {cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+             cuUtil::ConstMultSC(cuUtil::SQRT2<fp_t>() / 2.0,
+                                 cuUtil::ConstSum(cuUtil::ONE<CFP_t>(),
+                                                  cuUtil::IMAG<CFP_t>()))});
+        add_default_gate(
+            "SWAP", {cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                     cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                     cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                     cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                     cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
+                     cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                     cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                     cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>()});
 
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"CNOT"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>()}));
+        add_default_gate("CNOT",
+                         {cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
+                          cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>()});
 
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"Toffoli"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>()}));
+        add_default_gate("Toffoli",
+                         {cuUtil::ZERO<CFP_t>(), cuUtil::ONE<CFP_t>(),
+                          cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>()});
 
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"CY"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ZERO<CFP_t>(), -cuUtil::IMAG<CFP_t>(),
-                cuUtil::IMAG<CFP_t>(), cuUtil::ZERO<CFP_t>()}));
+        add_default_gate("CY",
+                         {cuUtil::ZERO<CFP_t>(), -cuUtil::IMAG<CFP_t>(),
+                          cuUtil::IMAG<CFP_t>(), cuUtil::ZERO<CFP_t>()});
 
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"CZ"}, 0.0)),
-            std::forward_as_tuple(std::vector<CFP_t>{
-                cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-                cuUtil::ZERO<CFP_t>(), -cuUtil::ONE<CFP_t>()}));
+        add_default_gate("CZ",
+                         {cuUtil::ONE<CFP_t>(), cuUtil::ZERO<CFP_t>(),
+                          cuUtil::ZERO<CFP_t>(), -cuUtil::ONE<CFP_t>()});
 
-        host_gates_.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(std::make_pair(std::string{"CSWAP"}, 0.0)),
-            std::forward_as_tuple(
-                host_gates_.at(std::make_pair(std::string{"SWAP"}, 0.0))));
-
-        for (const auto &[h_gate_k, h_gate_v] : host_gates_) {
-            device_gates_.emplace(
-                std::piecewise_construct, std::forward_as_tuple(h_gate_k),
-                std::forward_as_tuple(h_gate_v.size(), device_tag_));
-            device_gates_.at(h_gate_k).CopyHostDataToGpu(h_gate_v.data(),
-                                                         h_gate_v.size());
-            total_alloc_bytes_ += (sizeof(CFP_t) * h_gate_v.size());
-        }
+        add_default_gate("CSWAP", get_gate_host("SWAP", 0.0));
     }
 
     /**
-     * @brief Check for the existence of a given gate.
+     * @brief Check for the existence of a given gate. The lookup is recorded
+     * as a cache hit or miss.
      *
      * @param gate_id std::pair of gate_name and given parameter value.
      * @return true Gate exists in cache.
      * @return false Gate does not exist in cache.
      */
     bool gateExists(const gate_id &gate) {
-        return ((host_gates_.find(gate) != host_gates_.end()) &&
-                (device_gates_.find(gate)) != device_gates_.end());
+        return gateExists(gate.first, gate.second);
     }
     /**
-     * @brief Check for the existence of a given gate.
+     * @brief Check for the existence of a given gate. The lookup is recorded
+     * as a cache hit or miss.
      *
      * @param gate_name String of gate name.
      * @param gate_param Gate parameter value. `0.0` if non-parametric gate.
@@ -180,15 +150,13 @@ template <class fp_t> class GateCache {
      * @return false Gate does not exist in cache.
      */
     bool gateExists(const std::string &gate_name, fp_t gate_param) {
-        return (host_gates_.find(std::make_pair(gate_name, gate_param)) !=
-                host_gates_.end()) &&
-               (device_gates_.find(std::make_pair(gate_name, gate_param)) !=
-                device_gates_.end());
+        return cache_.find(makeKey(gate_name, gate_param)) != nullptr;
     }
 
     /**
      * @brief Add gate numerical value to the cache, indexed by the gate name
-     * and parameter value.
+     * and parameter value. Least-recently-used gates are evicted if the byte
+     * budget of the cache is exceeded.
      *
      * @param gate_name String representing the name of the given gate.
      * @param gate_param Gate parameter value. `0.0` if non-parametric gate.
@@ -196,16 +164,9 @@ template <class fp_t> class GateCache {
      */
     void add_gate(const std::string &gate_name, fp_t gate_param,
                   std::vector<CFP_t> host_data) {
-        const auto gate_key = std::make_pair(gate_name, gate_param);
-        host_gates_[gate_key] = std::move(host_data);
-        auto &gate = host_gates_[gate_key];
-
-        device_gates_.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(gate_key),
-                              std::forward_as_tuple(gate.size(), device_tag_));
-        device_gates_.at(gate_key).CopyHostDataToGpu(gate.data(), gate.size());
-
-        this->total_alloc_bytes_ += (sizeof(CFP_t) * gate.size());
+        const std::size_t bytes = sizeof(CFP_t) * host_data.size();
+        cache_.emplace(makeStoredKey(gate_name, gate_param), bytes, false,
+                       std::move(host_data), device_tag_);
     }
 
     /**
@@ -216,15 +177,7 @@ template <class fp_t> class GateCache {
      * @param host_data
      */
     void add_gate(const gate_id &gate_key, std::vector<CFP_t> host_data) {
-        host_gates_[gate_key] = std::move(host_data);
-        auto &gate = host_gates_[gate_key];
-
-        device_gates_.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(gate_key),
-                              std::forward_as_tuple(gate.size(), device_tag_));
-        device_gates_.at(gate_key).CopyHostDataToGpu(gate.data(), gate.size());
-
-        total_alloc_bytes_ += (sizeof(CFP_t) * gate.size());
+        add_gate(gate_key.first, gate_key.second, std::move(host_data));
     }
 
     /**
@@ -237,32 +190,138 @@ template <class fp_t> class GateCache {
      */
     const CFP_t *get_gate_device_ptr(const std::string &gate_name,
                                      fp_t gate_param) {
-        return device_gates_.at(std::make_pair(gate_name, gate_param))
-            .getData();
+        return cache_.at(makeKey(gate_name, gate_param)).device.getData();
     }
     const CFP_t *get_gate_device_ptr(const gate_id &gate_key) {
-        return device_gates_.at(gate_key).getData();
+        return get_gate_device_ptr(gate_key.first, gate_key.second);
     }
     auto get_gate_host(const std::string &gate_name, fp_t gate_param) {
-        return host_gates_.at(std::make_pair(gate_name, gate_param));
+        return cache_.at(makeKey(gate_name, gate_param)).host;
     }
     auto get_gate_host(const gate_id &gate_key) {
-        return host_gates_.at(gate_key);
+        return get_gate_host(gate_key.first, gate_key.second);
+    }
+
+    /**
+     * @brief Set the quantization step of gate parameters. Parameters within
+     * the same step share a cache entry, computed for the first value seen.
+     * Changing the step drops every non-default gate from the cache.
+     *
+     * @param step Quantization step. `0` keys gates on the exact parameter.
+     */
+    void setParamQuantization(fp_t step) {
+        PL_ABORT_IF(step < 0, "The quantization step must be non-negative.");
+        param_step_ = step;
+        cache_.clear(true);
+    }
+    [[nodiscard]] auto getParamQuantization() const -> fp_t {
+        return param_step_;
+    }
+
+    /**
+     * @brief Set the byte budget of the cache, evicting gates if it shrinks.
+     *
+     * @param max_alloc_bytes Byte budget. `0` disables eviction.
+     */
+    void setMaxAllocBytes(std::size_t max_alloc_bytes) {
+        cache_.setMaxBytes(max_alloc_bytes);
+    }
+    [[nodiscard]] auto getMaxAllocBytes() const -> std::size_t {
+        return cache_.getMaxBytes();
+    }
+    [[nodiscard]] auto getTotalAllocBytes() const -> std::size_t {
+        return cache_.getTotalBytes();
+    }
+    [[nodiscard]] auto getNumGates() const -> std::size_t {
+        return cache_.size();
+    }
+    [[nodiscard]] auto getHits() const -> std::size_t {
+        return cache_.getHits();
+    }
+    [[nodiscard]] auto getMisses() const -> std::size_t {
+        return cache_.getMisses();
+    }
+    [[nodiscard]] auto getEvictions() const -> std::size_t {
+        return cache_.getEvictions();
     }
 
   private:
-    const DevTag<int> device_tag_;
-    std::size_t total_alloc_bytes_;
+    /**
+     * @brief Cache key: gate name and the bit pattern (or quantized value) of
+     * the parameter. The name hash is only used for bucketing.
+     */
+    struct GateKey {
+        std::string_view name;
+        std::size_t name_hash;
+        std::int64_t param_key;
+
+        bool operator==(const GateKey &other) const {
+            return param_key == other.param_key && name == other.name;
+        }
+    };
+
+    struct GateKeyHash {
+        std::size_t operator()(const GateKey &key) const {
+            const std::size_t seed = key.name_hash;
+            return seed ^ (std::hash<std::int64_t>()(key.param_key) +
+                           0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U));
+        }
+    };
+
+    /**
+     * @brief Host and device copies of a cached gate.
+     */
+    struct GateEntry {
+        std::vector<CFP_t> host;
+        CUDA::DataBuffer<CFP_t> device;
 
-    struct gate_id_hash {
-        template <class T1, class T2>
-        std::size_t operator()(const std::pair<T1, T2> &pair) const {
-            return std::hash<T1>()(pair.first) ^ std::hash<T2>()(pair.second);
+        GateEntry(std::vector<CFP_t> host_data, const DevTag<int> &device_tag)
+            : host{std::move(host_data)}, device{host.size(), device_tag} {
+            device.CopyHostDataToGpu(host.data(), host.size());
         }
     };
 
-    std::unordered_map<gate_id, CUDA::DataBuffer<CFP_t>, gate_id_hash>
-        device_gates_;
-    std::unordered_map<gate_id, std::vector<CFP_t>, gate_id_hash> host_gates_;
+    /**
+     * @brief Key viewing `gate_name`, valid for the duration of a lookup.
+     */
+    auto makeKey(std::string_view gate_name, fp_t gate_param) const
+        -> GateKey {
+        std::int64_t param_key;
+        if (param_step_ > 0) {
+            param_key = std::llround(gate_param / param_step_);
+        } else {
+            // Adding zero maps -0.0 onto +0.0.
+            const fp_t param = gate_param + fp_t{0.0};
+            if constexpr (std::is_same_v<fp_t, float>) {
+                param_key = std::bit_cast<std::uint32_t>(param);
+            } else {
+                param_key = std::bit_cast<std::int64_t>(param);
+            }
+        }
+        return {gate_name, std::hash<std::string_view>()(gate_name),
+                param_key};
+    }
+
+    /**
+     * @brief Key viewing the interned copy of `gate_name`, stored in the
+     * cache.
+     */
+    auto makeStoredKey(const std::string &gate_name, fp_t gate_param)
+        -> GateKey {
+        return makeKey(*gate_names_.insert(gate_name).first, gate_param);
+    }
+
+    void add_default_gate(const std::string &gate_name,
+                          std::vector<CFP_t> host_data) {
+        const std::size_t bytes = sizeof(CFP_t) * host_data.size();
+        cache_.emplace(makeStoredKey(gate_name, 0.0), bytes, true,
+                       std::move(host_data), device_tag_);
+    }
+
+    const DevTag<int> device_tag_;
+    fp_t param_step_{0.0};
+    // Node-based, so that the names viewed by the cached keys never move.
+    std::unordered_set<std::string> gate_names_;
+    cuUtil::LRUCache<GateKey, GateEntry, GateKeyHash> cache_;
 };
 } // namespace Pennylane::CUDA
@@ -2,6 +2,11 @@
 
 #include <cmath>
 #include <complex>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "cuda_helpers.hpp"
@@ -1323,4 +1328,103 @@ static constexpr auto getGeneratorIsingZZ() -> std::vector<CFP_t> {
     };
 }
 
+/**
+ * @brief Host matrix generator of a named gate, taking the gate parameters.
+ */
+template <class CFP_t, class U = double>
+using DenseGateFunc =
+    std::function<std::vector<CFP_t>(const std::vector<U> &)>;
+
+template <class CFP_t, class U = double>
+using DenseGateMap = std::unordered_map<std::string, DenseGateFunc<CFP_t, U>>;
+
+/**
+ * @brief Wrap a host matrix generator so that it checks the number of gate
+ * parameters before reading them.
+ *
+ * @tparam num_params Number of parameters of the gate.
+ * @param gen Matrix generator reading `num_params` parameters.
+ */
+template <std::size_t num_params, class CFP_t, class U, class Func>
+auto makeDenseGate(Func &&gen) -> DenseGateFunc<CFP_t, U> {
+    return [gen = std::forward<Func>(gen)](const std::vector<U> &params) {
+        PL_ABORT_IF_NOT(params.size() == num_params,
+                        "Unexpected number of gate parameters.");
+        return gen(params);
+    };
+}
+
+/**
+ * @brief Map from gate names to their dense row-major matrices. Every matrix
+ * acts on all wires of the gate, controls included. The generators abort if
+ * they are not given the number of parameters of the gate.
+ *
+ * @tparam CFP_t Required precision of gate (`float` or `double`).
+ * @tparam U Required precision of parameter (`float` or `double`).
+ * @return const DenseGateMap<CFP_t, U>&
+ */
+template <class CFP_t, class U = double>
+auto getDenseGateMap() -> const DenseGateMap<CFP_t, U> & {
+    const auto gate0 = [](auto &&gen) {
+        return makeDenseGate<0, CFP_t, U>(gen);
+    };
+    const auto gate1 = [](auto &&gen) {
+        return makeDenseGate<1, CFP_t, U>(gen);
+    };
+    const auto gate3 = [](auto &&gen) {
+        return makeDenseGate<3, CFP_t, U>(gen);
+    };
+    static const DenseGateMap<CFP_t, U> gates{
+        {"Identity", gate0([](auto &&) { return getIdentity<CFP_t>(); })},
+        {"PauliX", gate0([](auto &&) { return getPauliX<CFP_t>(); })},
+        {"PauliY", gate0([](auto &&) { return getPauliY<CFP_t>(); })},
+        {"PauliZ", gate0([](auto &&) { return getPauliZ<CFP_t>(); })},
+        {"Hadamard", gate0([](auto &&) { return getHadamard<CFP_t>(); })},
+        {"S", gate0([](auto &&) { return getS<CFP_t>(); })},
+        {"T", gate0([](auto &&) { return getT<CFP_t>(); })},
+        {"CNOT", gate0([](auto &&) { return getCNOT<CFP_t>(); })},
+        {"SWAP", gate0([](auto &&) { return getSWAP<CFP_t>(); })},
+        {"CY", gate0([](auto &&) { return getCY<CFP_t>(); })},
+        {"CZ", gate0([](auto &&) { return getCZ<CFP_t>(); })},
+        {"Toffoli", gate0([](auto &&) { return getToffoli<CFP_t>(); })},
+        {"CSWAP", gate0([](auto &&) { return getCSWAP<CFP_t>(); })},
+        {"RX", gate1([](auto &&p) { return getRX<CFP_t>(p[0]); })},
+        {"RY", gate1([](auto &&p) { return getRY<CFP_t>(p[0]); })},
+        {"RZ", gate1([](auto &&p) { return getRZ<CFP_t>(p[0]); })},
+        {"Rot",
+         gate3([](auto &&p) { return getRot<CFP_t>(p[0], p[1], p[2]); })},
+        {"PhaseShift",
+         gate1([](auto &&p) { return getPhaseShift<CFP_t>(p[0]); })},
+        {"CRX", gate1([](auto &&p) { return getCRX<CFP_t>(p[0]); })},
+        {"CRY", gate1([](auto &&p) { return getCRY<CFP_t>(p[0]); })},
+        {"CRZ", gate1([](auto &&p) { return getCRZ<CFP_t>(p[0]); })},
+        {"CRot",
+         gate3([](auto &&p) { return getCRot<CFP_t>(p[0], p[1], p[2]); })},
+        {"ControlledPhaseShift", gate1([](auto &&p) {
+             return getControlledPhaseShift<CFP_t>(p[0]);
+         })},
+        {"IsingXX", gate1([](auto &&p) { return getIsingXX<CFP_t>(p[0]); })},
+        {"IsingYY", gate1([](auto &&p) { return getIsingYY<CFP_t>(p[0]); })},
+        {"IsingZZ", gate1([](auto &&p) { return getIsingZZ<CFP_t>(p[0]); })},
+        {"SingleExcitation", gate1([](auto &&p) {
+             return getSingleExcitation<CFP_t>(p[0]);
+         })},
+        {"SingleExcitationMinus", gate1([](auto &&p) {
+             return getSingleExcitationMinus<CFP_t>(p[0]);
+         })},
+        {"SingleExcitationPlus", gate1([](auto &&p) {
+             return getSingleExcitationPlus<CFP_t>(p[0]);
+         })},
+        {"DoubleExcitation", gate1([](auto &&p) {
+             return getDoubleExcitation<CFP_t>(p[0]);
+         })},
+        {"DoubleExcitationMinus", gate1([](auto &&p) {
+             return getDoubleExcitationMinus<CFP_t>(p[0]);
+         })},
+        {"DoubleExcitationPlus", gate1([](auto &&p) {
+             return getDoubleExcitationPlus<CFP_t>(p[0]);
+         })}};
+    return gates;
+}
+
 } // namespace Pennylane::CUDA::cuGates
@@ -0,0 +1,123 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc.
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//     http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file diagonalPhase.cu
+ */
+#include "cuda_helpers.hpp"
+#include <cuComplex.h>
+#include <cstdint>
+
+namespace Pennylane {
+
+/**
+ * @brief Multiply each amplitude by the phase of a product of diagonal gates.
+ *
+ * @param sv Complex data pointer of the state vector on device.
+ * @param length Number of elements of the state vector.
+ * @param index_offset Bits ORed into each local index, e.g. the global index
+ * bits of a distributed state vector.
+ * @param z_masks Z mask of each term of the phase polynomial (on device).
+ * @param angles Angle of each term (on device).
+ * @param num_terms Number of terms.
+ * @param thread_per_block Number of threads set per block.
+ * @param stream_id Stream id of CUDA calls
+ */
+void applyDiagonalPhase_CUDA(cuComplex *sv, size_t length,
+                             uint64_t index_offset, const uint64_t *z_masks,
+                             const float *angles, size_t num_terms,
+                             size_t thread_per_block, cudaStream_t stream_id);
+void applyDiagonalPhase_CUDA(cuDoubleComplex *sv, size_t length,
+                             uint64_t index_offset, const uint64_t *z_masks,
+                             const double *angles, size_t num_terms,
+                             size_t thread_per_block, cudaStream_t stream_id);
+
+/**
+ * @brief The CUDA kernel applying a diagonal phase. Each thread evaluates the
+ * phase polynomial of one basis state and rotates its amplitude.
+ *
+ * @param sv Complex data pointer of the state vector on device.
+ * @param length Number of elements of the state vector.
+ * @param index_offset Bits ORed into each local index.
+ * @param z_masks Z mask of each term.
+ * @param angles Angle of each term.
+ * @param num_terms Number of terms.
+ */
+template <class GPUDataT, class PrecisionT>
+__global__ void applyDiagonalPhaseKernel(GPUDataT *sv, size_t length,
+                                         uint64_t index_offset,
+                                         const uint64_t *z_masks,
+                                         const PrecisionT *angles,
+                                         size_t num_terms) {
+    const size_t i =
+        static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= length) {
+        return;
+    }
+    const uint64_t index = index_offset | i;
+    PrecisionT phase = 0;
+    for (size_t t = 0; t < num_terms; t++) {
+        const bool odd = __popcll(index & z_masks[t]) & 1;
+        phase += odd ? -angles[t] : angles[t];
+    }
+    const PrecisionT c = cos(phase);
+    const PrecisionT s = sin(phase);
+    const GPUDataT v = sv[i];
+    sv[i] = {c * v.x - s * v.y, c * v.y + s * v.x};
+}
+
+/**
+ * @brief The CUDA kernel call wrapper.
+ *
+ * @param sv Complex data pointer of the state vector on device.
+ * @param length Number of elements of the state vector.
+ * @param index_offset Bits ORed into each local index.
+ * @param z_masks Z mask of each term (on device).
+ * @param angles Angle of each term (on device).
+ * @param num_terms Number of terms.
+ * @param thread_per_block Number of threads set per block.
+ * @param stream_id Stream id of CUDA calls
+ */
+template <class GPUDataT, class PrecisionT>
+void applyDiagonalPhase_CUDA_call(GPUDataT *sv, size_t length,
+                                  uint64_t index_offset,
+                                  const uint64_t *z_masks,
+                                  const PrecisionT *angles, size_t num_terms,
+                                  size_t thread_per_block,
+                                  cudaStream_t stream_id) {
+    const size_t num_blocks =
+        (length + thread_per_block - 1) / thread_per_block;
+    const size_t block_per_grid = (num_blocks == 0 ? 1 : num_blocks);
+    dim3 blockSize(thread_per_block, 1, 1);
+    dim3 gridSize(block_per_grid, 1);
+
+    applyDiagonalPhaseKernel<GPUDataT, PrecisionT>
+        <<<gridSize, blockSize, 0, stream_id>>>(sv, length, index_offset,
+                                                 z_masks, angles, num_terms);
+    PL_CUDA_IS_SUCCESS(cudaGetLastError());
+}
+
+// Definitions
+void applyDiagonalPhase_CUDA(cuComplex *sv, size_t length,
+                             uint64_t index_offset, const uint64_t *z_masks,
+                             const float *angles, size_t num_terms,
+                             size_t thread_per_block, cudaStream_t stream_id) {
+    applyDiagonalPhase_CUDA_call(sv, length, index_offset, z_masks, angles,
+                                 num_terms, thread_per_block, stream_id);
+}
+void applyDiagonalPhase_CUDA(cuDoubleComplex *sv, size_t length,
+                             uint64_t index_offset, const uint64_t *z_masks,
+                             const double *angles, size_t num_terms,
+                             size_t thread_per_block, cudaStream_t stream_id) {
+    applyDiagonalPhase_CUDA_call(sv, length, index_offset, z_masks, angles,
+                                 num_terms, thread_per_block, stream_id);
+}
+
+} // namespace Pennylane
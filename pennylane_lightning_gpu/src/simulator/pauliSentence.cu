@@ -0,0 +1,155 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc.
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//     http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file pauliSentence.cu
+ */
+#include "cuda_helpers.hpp"
+#include <cuComplex.h>
+#include <cstdint>
+
+namespace Pennylane {
+
+/**
+ * @brief Apply a Pauli sentence, compiled into bit masks, out of place.
+ *
+ * @param sv_in Complex data pointer of the input state vector on device.
+ * @param sv_out Complex data pointer of the output state vector on device.
+ * @param length Number of elements of the state vectors.
+ * @param x_masks X mask of each group of terms (on device).
+ * @param group_offsets Offsets of the terms of each group, of length
+ * `num_groups + 1` (on device).
+ * @param num_groups Number of groups.
+ * @param z_masks Z mask of each term (on device).
+ * @param coeffs Coefficient of each term (on device).
+ * @param accumulate Add the result to `sv_out` instead of overwriting it.
+ * @param thread_per_block Number of threads set per block.
+ * @param stream_id Stream id of CUDA calls
+ */
+void applyPauliSentence_CUDA(const cuComplex *sv_in, cuComplex *sv_out,
+                             size_t length, const uint64_t *x_masks,
+                             const size_t *group_offsets, size_t num_groups,
+                             const uint64_t *z_masks, const cuComplex *coeffs,
+                             bool accumulate, size_t thread_per_block,
+                             cudaStream_t stream_id);
+void applyPauliSentence_CUDA(const cuDoubleComplex *sv_in,
+                             cuDoubleComplex *sv_out, size_t length,
+                             const uint64_t *x_masks,
+                             const size_t *group_offsets, size_t num_groups,
+                             const uint64_t *z_masks,
+                             const cuDoubleComplex *coeffs,
+                             bool accumulate, size_t thread_per_block,
+                             cudaStream_t stream_id);
+
+/**
+ * @brief The CUDA kernel applying a Pauli sentence. Each thread computes one
+ * output amplitude, reading one input amplitude per group of terms.
+ *
+ * @param sv_in Complex data pointer of the input state vector on device.
+ * @param sv_out Complex data pointer of the output state vector on device.
+ * @param length Number of elements of the state vectors.
+ * @param x_masks X mask of each group of terms.
+ * @param group_offsets Offsets of the terms of each group.
+ * @param num_groups Number of groups.
+ * @param z_masks Z mask of each term.
+ * @param coeffs Coefficient of each term.
+ * @param accumulate Add the result to `sv_out` instead of overwriting it.
+ */
+template <class GPUDataT>
+__global__ void
+applyPauliSentenceKernel(const GPUDataT *sv_in, GPUDataT *sv_out,
+                         size_t length, const uint64_t *x_masks,
+                         const size_t *group_offsets, size_t num_groups,
+                         const uint64_t *z_masks, const GPUDataT *coeffs,
+                         bool accumulate) {
+    const size_t i =
+        static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= length) {
+        return;
+    }
+    GPUDataT result{0, 0};
+    for (size_t g = 0; g < num_groups; g++) {
+        GPUDataT scale{0, 0};
+        for (size_t t = group_offsets[g]; t < group_offsets[g + 1]; t++) {
+            const bool odd = __popcll(i & z_masks[t]) & 1;
+            scale.x += odd ? -coeffs[t].x : coeffs[t].x;
+            scale.y += odd ? -coeffs[t].y : coeffs[t].y;
+        }
+        const GPUDataT v = sv_in[i ^ x_masks[g]];
+        result.x += scale.x * v.x - scale.y * v.y;
+        result.y += scale.x * v.y + scale.y * v.x;
+    }
+    if (accumulate) {
+        result.x += sv_out[i].x;
+        result.y += sv_out[i].y;
+    }
+    sv_out[i] = result;
+}
+
+/**
+ * @brief The CUDA kernel call wrapper.
+ *
+ * @param sv_in Complex data pointer of the input state vector on device.
+ * @param sv_out Complex data pointer of the output state vector on device.
+ * @param length Number of elements of the state vectors.
+ * @param x_masks X mask of each group of terms (on device).
+ * @param group_offsets Offsets of the terms of each group (on device).
+ * @param num_groups Number of groups.
+ * @param z_masks Z mask of each term (on device).
+ * @param coeffs Coefficient of each term (on device).
+ * @param accumulate Add the result to `sv_out` instead of overwriting it.
+ * @param thread_per_block Number of threads set per block.
+ * @param stream_id Stream id of CUDA calls
+ */
+template <class GPUDataT>
+void applyPauliSentence_CUDA_call(const GPUDataT *sv_in, GPUDataT *sv_out,
+                                  size_t length, const uint64_t *x_masks,
+                                  const size_t *group_offsets,
+                                  size_t num_groups, const uint64_t *z_masks,
+                                  const GPUDataT *coeffs, bool accumulate,
+                                  size_t thread_per_block,
+                                  cudaStream_t stream_id) {
+    const size_t num_blocks =
+        (length + thread_per_block - 1) / thread_per_block;
+    const size_t block_per_grid = (num_blocks == 0 ? 1 : num_blocks);
+    dim3 blockSize(thread_per_block, 1, 1);
+    dim3 gridSize(block_per_grid, 1);
+
+    applyPauliSentenceKernel<GPUDataT><<<gridSize, blockSize, 0, stream_id>>>(
+        sv_in, sv_out, length, x_masks, group_offsets, num_groups, z_masks,
+        coeffs, accumulate);
+    PL_CUDA_IS_SUCCESS(cudaGetLastError());
+}
+
+// Definitions
+void applyPauliSentence_CUDA(const cuComplex *sv_in, cuComplex *sv_out,
+                             size_t length, const uint64_t *x_masks,
+                             const size_t *group_offsets, size_t num_groups,
+                             const uint64_t *z_masks, const cuComplex *coeffs,
+                             bool accumulate, size_t thread_per_block,
+                             cudaStream_t stream_id) {
+    applyPauliSentence_CUDA_call(sv_in, sv_out, length, x_masks, group_offsets,
+                                 num_groups, z_masks, coeffs, accumulate,
+                                 thread_per_block, stream_id);
+}
+void applyPauliSentence_CUDA(const cuDoubleComplex *sv_in,
+                             cuDoubleComplex *sv_out, size_t length,
+                             const uint64_t *x_masks,
+                             const size_t *group_offsets, size_t num_groups,
+                             const uint64_t *z_masks,
+                             const cuDoubleComplex *coeffs,
+                             bool accumulate, size_t thread_per_block,
+                             cudaStream_t stream_id) {
+    applyPauliSentence_CUDA_call(sv_in, sv_out, length, x_masks, group_offsets,
+                                 num_groups, z_masks, coeffs, accumulate,
+                                 thread_per_block, stream_id);
+}
+
+} // namespace Pennylane
@@ -195,6 +195,223 @@ TEST_CASE("AdjointJacobianGPU::AdjointJacobianGPU Op=[RX,RX,RX], Obs=[Z,Z,Z],"
     }
 }
 
+TEST_CASE("AdjointJacobianGPU::adjointJacobian non-trainable ops after the "
+          "last trainable one",
+          "[AdjointJacobianGPU]") {
+    // The backward steps over the trailing ops update lambda before any
+    // overlap is computed, while the observable copies may still read it.
+    AdjointJacobianGPU<double> adj;
+    const double theta = 0.7;
+    std::vector<size_t> tp{0};
+    {
+        const size_t num_qubits = 14;
+        const size_t num_obs = 2;
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(tp.size(), 0));
+
+        SVDataGPU<double> psi(num_qubits);
+
+        const auto obs1 = std::make_shared<NamedObsGPU<double>>(
+            "PauliZ", std::vector<size_t>{0});
+        const auto obs2 = std::make_shared<NamedObsGPU<double>>(
+            "PauliZ", std::vector<size_t>{1});
+        auto ops = adj.createOpsData(
+            {"RX", "PauliX", "CNOT", "RZ", "Hadamard", "RY"},
+            {{theta}, {}, {}, {0.3}, {}, {0.4}},
+            {{0}, {1}, {1, 2}, {0}, {3}, {4}},
+            {false, false, false, false, false, false});
+
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, {obs1, obs2}, ops, tp, true);
+
+        CAPTURE(jacobian);
+
+        CHECK(-sin(theta) == Approx(jacobian[0][0]).margin(1e-7));
+        CHECK(0 == Approx(jacobian[1][0]).margin(1e-7));
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=[RX,RY,RX,RY], "
+          "Obs=[Z,Z,Z,Z,Z,Z,Z,Z]",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3, 0.3};
+    std::vector<size_t> tp{0, 1, 2, 3};
+    const size_t num_qubits = 4;
+    const size_t num_obs = 8;
+
+    SVDataGPU<double> psi(num_qubits);
+
+    // Every observable runs on its own stream; the result of each one must
+    // land in its own row of the Jacobian.
+    std::vector<std::shared_ptr<ObservableGPU<double>>> obs;
+    for (size_t n = 0; n < num_obs; n++) {
+        obs.push_back(std::make_shared<NamedObsGPU<double>>(
+            "PauliZ", std::vector<size_t>{n % num_qubits}));
+    }
+    auto ops = adj.createOpsData(
+        {"RX", "RY", "RX", "RY"},
+        {{param[0]}, {param[1]}, {param[2]}, {param[3]}}, {{0}, {1}, {2}, {3}},
+        {false, false, false, false});
+
+    for (size_t repeat = 0; repeat < 2; repeat++) {
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(tp.size(), 0));
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, obs, ops, tp, true);
+
+        CAPTURE(jacobian);
+        for (size_t n = 0; n < num_obs; n++) {
+            for (size_t p = 0; p < tp.size(); p++) {
+                const double expected =
+                    (p == n % num_qubits) ? -sin(param[p]) : 0.0;
+                CHECK(expected == Approx(jacobian[n][p]).margin(1e-7));
+            }
+        }
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::adjointJacobianLowMemory",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3, 0.3};
+    std::vector<size_t> tp{0, 1, 2, 3};
+    const size_t num_qubits = 4;
+    const size_t num_obs = 6;
+
+    SVDataGPU<double> psi(num_qubits);
+
+    std::vector<std::shared_ptr<ObservableGPU<double>>> obs;
+    for (size_t n = 0; n < num_obs; n++) {
+        obs.push_back(std::make_shared<NamedObsGPU<double>>(
+            (n % 2) ? "PauliX" : "PauliZ",
+            std::vector<size_t>{n % num_qubits}));
+    }
+    auto ops = adj.createOpsData(
+        {"RX", "RY", "CNOT", "RX", "RY"},
+        {{param[0]}, {param[1]}, {}, {param[2]}, {param[3]}},
+        {{0}, {1}, {0, 1}, {2}, {3}}, {false, false, false, false, false});
+
+    std::vector<std::vector<double>> expected(
+        num_obs, std::vector<double>(tp.size(), 0));
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        expected, obs, ops, tp, true);
+
+    SECTION("Everything fits") {
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(tp.size(), 0));
+        const auto stats = adj.adjointJacobianLowMemory(
+            psi.cuda_sv.getData(), psi.cuda_sv.getLength(), jacobian, obs,
+            ops, tp, true, {}, num_obs + 2);
+        CHECK(stats.num_sweeps == 1);
+        CHECK(stats.num_checkpoints == 0);
+        CHECK(stats.max_resident_states == num_obs + 2);
+        CHECK(stats.num_recomputed_ops == 0);
+        for (size_t n = 0; n < num_obs; n++) {
+            for (size_t p = 0; p < tp.size(); p++) {
+                CHECK(expected[n][p] == Approx(jacobian[n][p]).margin(1e-7));
+            }
+        }
+    }
+    SECTION("Observables are chunked around a checkpoint") {
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(tp.size(), 0));
+        const auto stats = adj.adjointJacobianLowMemory(
+            psi.cuda_sv.getData(), psi.cuda_sv.getLength(), jacobian, obs,
+            ops, tp, true, {}, 5);
+        CHECK(stats.num_sweeps == 3);
+        CHECK(stats.num_checkpoints == 1);
+        CHECK(stats.max_resident_states == 5);
+        CHECK(stats.num_recomputed_ops == 2 * ops.getOpsName().size());
+        for (size_t n = 0; n < num_obs; n++) {
+            for (size_t p = 0; p < tp.size(); p++) {
+                CHECK(expected[n][p] == Approx(jacobian[n][p]).margin(1e-7));
+            }
+        }
+    }
+    SECTION("Folded observables give the vector-Jacobian product") {
+        const std::vector<double> weights{0.5, -1.0, 2.0, 0.25, -0.75, 1.5};
+        std::vector<std::vector<double>> vjp(1,
+                                             std::vector<double>(tp.size(), 0));
+        const auto stats = adj.adjointJacobianLowMemory(
+            psi.cuda_sv.getData(), psi.cuda_sv.getLength(), vjp, obs, ops, tp,
+            true, weights, 3);
+        CHECK(stats.num_sweeps == 1);
+        CHECK(stats.max_resident_states == 3);
+        for (size_t p = 0; p < tp.size(); p++) {
+            double ref = 0.0;
+            for (size_t n = 0; n < num_obs; n++) {
+                ref += weights[n] * expected[n][p];
+            }
+            CHECK(ref == Approx(vjp[0][p]).margin(1e-7));
+        }
+    }
+    SECTION("Not enough memory") {
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(tp.size(), 0));
+        REQUIRE_THROWS_WITH(
+            adj.adjointJacobianLowMemory(psi.cuda_sv.getData(),
+                                         psi.cuda_sv.getLength(), jacobian,
+                                         obs, ops, tp, true, {}, 3),
+            Catch::Contains("Not enough device memory"));
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::vectorJacobianProduct",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    std::vector<size_t> tp{0, 1, 2};
+    const size_t num_qubits = 3;
+
+    SVDataGPU<double> psi(num_qubits);
+
+    const std::vector<std::shared_ptr<ObservableGPU<double>>> obs{
+        std::make_shared<NamedObsGPU<double>>("PauliZ",
+                                              std::vector<size_t>{0}),
+        std::make_shared<NamedObsGPU<double>>("PauliX",
+                                              std::vector<size_t>{1}),
+        std::make_shared<NamedObsGPU<double>>("PauliZ",
+                                              std::vector<size_t>{2})};
+    auto ops = adj.createOpsData({"RX", "RY", "CNOT", "RX"},
+                                 {{param[0]}, {param[1]}, {}, {param[2]}},
+                                 {{0}, {1}, {1, 2}, {2}},
+                                 {false, false, false, false});
+
+    std::vector<std::vector<double>> jacobian(
+        obs.size(), std::vector<double>(tp.size(), 0));
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        jacobian, obs, ops, tp, true);
+
+    SECTION("Contraction with dy") {
+        const std::vector<double> dy{0.3, -1.2, 0.0};
+        const auto vjp = adj.vectorJacobianProduct(
+            dy, psi.cuda_sv.getData(), psi.cuda_sv.getLength(), obs, ops, tp,
+            true);
+        REQUIRE(vjp.size() == tp.size());
+        for (size_t p = 0; p < tp.size(); p++) {
+            double expected = 0.0;
+            for (size_t n = 0; n < obs.size(); n++) {
+                expected += dy[n] * jacobian[n][p];
+            }
+            CHECK(expected == Approx(vjp[p]).margin(1e-7));
+        }
+    }
+    SECTION("Zero dy") {
+        const auto vjp = adj.vectorJacobianProduct(
+            {0.0, 0.0, 0.0}, psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+            obs, ops, tp, true);
+        CHECK(vjp == std::vector<double>(tp.size(), 0.0));
+    }
+    SECTION("Mismatched dy") {
+        REQUIRE_THROWS_WITH(
+            adj.vectorJacobianProduct({1.0}, psi.cuda_sv.getData(),
+                                      psi.cuda_sv.getLength(), obs, ops, tp,
+                                      true),
+            Catch::Contains("The length of dy"));
+    }
+}
+
 TEST_CASE("Algorithms::adjointJacobian Op=[RX,RX,RX], Obs=[ZZZ]",
           "[Algorithms]") {
     AdjointJacobianGPU<double> adj;
@@ -278,6 +495,117 @@ TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=Mixed, Obs=[XXX]",
     }
 }
 
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=Mixed with SWAP, "
+          "Obs=[Z,Z,X]",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    const size_t num_qubits = 3;
+    const std::vector<size_t> tp{0, 1, 2};
+    std::vector<std::shared_ptr<ObservableGPU<double>>> obs;
+    obs.emplace_back(std::make_shared<NamedObsGPU<double>>(
+        "PauliZ", std::vector<size_t>{0}));
+    obs.emplace_back(std::make_shared<NamedObsGPU<double>>(
+        "PauliZ", std::vector<size_t>{1}));
+    obs.emplace_back(std::make_shared<NamedObsGPU<double>>(
+        "PauliX", std::vector<size_t>{2}));
+
+    // The SWAP gates only relabel the qubits of the sweep states, the
+    // reference applies them as three CNOT gates each.
+    const auto jacobian_of = [&](bool decompose) {
+        std::vector<std::string> names{"RX", "SWAP", "RY", "CNOT", "SWAP",
+                                       "RZ"};
+        std::vector<std::vector<double>> params{{0.3}, {}, {-0.5},
+                                                {},    {}, {0.7}};
+        std::vector<std::vector<size_t>> wires{{0},    {0, 1}, {1},
+                                               {1, 2}, {2, 0}, {0}};
+        if (decompose) {
+            for (size_t i = names.size(); i-- > 0;) {
+                if (names[i] != "SWAP") {
+                    continue;
+                }
+                const auto w = wires[i];
+                names[i] = "CNOT";
+                wires[i] = w;
+                names.insert(names.begin() + i + 1, {"CNOT", "CNOT"});
+                params.insert(params.begin() + i + 1, 2, {});
+                wires.insert(wires.begin() + i + 1, {{w[1], w[0]}, w});
+            }
+        }
+        auto ops = adj.createOpsData(names, params, wires,
+                                     std::vector<bool>(names.size(), false));
+        std::vector<std::vector<double>> jacobian(
+            obs.size(), std::vector<double>(tp.size(), 0));
+        SVDataGPU<double> psi(num_qubits);
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, obs, ops, tp, true);
+        return jacobian;
+    };
+
+    const auto jacobian = jacobian_of(false);
+    const auto expected = jacobian_of(true);
+    for (size_t i = 0; i < obs.size(); i++) {
+        CAPTURE(i);
+        CHECK(jacobian[i] == Pennylane::approx(expected[i]).margin(1e-7));
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=Mixed from an op stream",
+          "[AdjointJacobianGPU]") {
+    namespace cuUtil = Pennylane::CUDA::Util;
+    AdjointJacobianGPU<double> adj;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    std::vector<size_t> tp{0, 1, 2, 3, 4, 5};
+    const size_t num_qubits = 3;
+    std::vector<std::vector<double>> jacobian(
+        1, std::vector<double>(tp.size(), 0));
+
+    SVDataGPU<double> psi(num_qubits);
+    const auto obs = std::make_shared<TensorProdObsGPU<double>>(
+        std::make_shared<NamedObsGPU<double>>("PauliX",
+                                              std::vector<size_t>{0}),
+        std::make_shared<NamedObsGPU<double>>("PauliX",
+                                              std::vector<size_t>{1}),
+        std::make_shared<NamedObsGPU<double>>("PauliX",
+                                              std::vector<size_t>{2}));
+
+    // Same circuit as "Op=Mixed, Obs=[XXX]", as flat arrays.
+    const auto &names = cuUtil::getOpStreamGateNames();
+    const auto code = [&](const std::string &name) {
+        return static_cast<std::int64_t>(
+            std::find(names.begin(), names.end(), name) - names.begin());
+    };
+    const std::vector<std::int64_t> op_codes{
+        code("RZ"),   code("RY"), code("RZ"), code("CNOT"),
+        code("CNOT"), code("RZ"), code("RY"), code("RZ")};
+    const std::vector<std::int64_t> wire_offsets{0, 1, 2, 3, 5,
+                                                 7, 8, 9, 10};
+    const std::vector<std::int64_t> wires{0, 0, 0, 0, 1, 1, 2, 1, 1, 1};
+    const std::vector<std::int64_t> param_offsets{0, 1, 2, 3, 3,
+                                                  3, 4, 5, 6};
+    const std::vector<double> params{param[0], param[1], param[2],
+                                     param[0], param[1], param[2]};
+    const bool inverses[8] = {};
+    const std::vector<std::int64_t> matrix_offsets(op_codes.size() + 1, 0);
+    const cuUtil::OpStream<double> stream{
+        names,  op_codes, wire_offsets,   wires, param_offsets,
+        params, inverses, matrix_offsets, {}};
+    auto ops = adj.createOpsData(stream);
+    CHECK(ops.getOpsName()[3] == "CNOT");
+    CHECK(ops.getOpsWires()[4] == std::vector<size_t>{1, 2});
+
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        jacobian, {obs}, ops, tp, true);
+    CAPTURE(jacobian);
+
+    // Computed with PennyLane using default.qubit.adjoint_jacobian
+    CHECK(0.0 == Approx(jacobian[0][0]).margin(1e-7));
+    CHECK(-0.674214427 == Approx(jacobian[0][1]).margin(1e-7));
+    CHECK(0.275139672 == Approx(jacobian[0][2]).margin(1e-7));
+    CHECK(0.275139672 == Approx(jacobian[0][3]).margin(1e-7));
+    CHECK(-0.0129093062 == Approx(jacobian[0][4]).margin(1e-7));
+    CHECK(0.323846156 == Approx(jacobian[0][5]).margin(1e-7));
+}
+
 TEST_CASE("AdjointJacobianGPU::adjointJacobian Decomposed Rot gate, non "
           "computational basis state",
           "[AdjointJacobianGPU]") {
@@ -0,0 +1,183 @@
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "BatchedStateVectorCudaManaged.hpp"
+#include "StateVectorCudaManaged.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane;
+using namespace Pennylane::CUDA;
+
+/**
+ * @brief Independent state vector for every state vector of a batch.
+ */
+template <class PrecisionT>
+auto makeReferences(std::size_t batch_size, std::size_t num_qubits)
+    -> std::vector<StateVectorCudaManaged<PrecisionT>> {
+    std::vector<StateVectorCudaManaged<PrecisionT>> refs;
+    refs.reserve(batch_size);
+    for (std::size_t b = 0; b < batch_size; b++) {
+        refs.emplace_back(num_qubits);
+        refs.back().initSV();
+    }
+    return refs;
+}
+
+template <class PrecisionT>
+void checkBatch(const BatchedStateVectorCudaManaged<PrecisionT> &batch,
+                const std::vector<StateVectorCudaManaged<PrecisionT>> &refs) {
+    const std::size_t length = batch.getLength();
+    std::vector<std::complex<PrecisionT>> data(batch.getBatchSize() * length);
+    batch.CopyGpuDataToHost(data.data(), data.size());
+    for (std::size_t b = 0; b < refs.size(); b++) {
+        std::vector<std::complex<PrecisionT>> expected(length);
+        refs[b].CopyGpuDataToHost(expected.data(), expected.size());
+        for (std::size_t i = 0; i < length; i++) {
+            CHECK(data[b * length + i].real() ==
+                  Approx(expected[i].real()).margin(1e-5));
+            CHECK(data[b * length + i].imag() ==
+                  Approx(expected[i].imag()).margin(1e-5));
+        }
+    }
+}
+} // namespace
+/// @endcond
+
+TEMPLATE_TEST_CASE("BatchedStateVectorCudaManaged::applyOperation",
+                   "[BatchedStateVectorCudaManaged]", float, double) {
+    const std::size_t batch_size = 5;
+    const std::size_t num_qubits = 3;
+    BatchedStateVectorCudaManaged<TestType> batch{batch_size, num_qubits};
+    auto refs = makeReferences<TestType>(batch_size, num_qubits);
+
+    SECTION("Initial state") { checkBatch(batch, refs); }
+    SECTION("Shared and per-batch gates") {
+        std::vector<std::vector<TestType>> angles;
+        for (std::size_t b = 0; b < batch_size; b++) {
+            angles.push_back({static_cast<TestType>(0.3 * b + 0.1)});
+        }
+        batch.applyOperation("Hadamard", {0});
+        batch.applyOperation("RX", {1}, false, angles);
+        batch.applyOperation("CNOT", {0, 2});
+        batch.applyOperation("CRY", {1, 2}, true, angles);
+        const std::vector<TestType> shared{0.7F};
+        batch.applyOperation("IsingXX", {0, 1}, false, {shared});
+        for (std::size_t b = 0; b < batch_size; b++) {
+            refs[b].applyOperation("Hadamard", {0});
+            refs[b].applyOperation("RX", {1}, false, angles[b]);
+            refs[b].applyOperation("CNOT", {0, 2});
+            refs[b].applyOperation("CRY", {1, 2}, true, angles[b]);
+            refs[b].applyOperation("IsingXX", {0, 1}, false, shared);
+        }
+        checkBatch(batch, refs);
+    }
+    SECTION("Per-batch matrices") {
+        using ComplexT = std::complex<TestType>;
+        std::vector<ComplexT> matrices;
+        for (std::size_t b = 0; b < batch_size; b++) {
+            const TestType phase = 0.2 * static_cast<TestType>(b);
+            const std::vector<ComplexT> matrix{
+                {0, 0}, std::polar<TestType>(1, phase), {1, 0}, {0, 0}};
+            matrices.insert(matrices.end(), matrix.begin(), matrix.end());
+            refs[b].applyOperation_std("Matrix", {2}, false, {0.0}, matrix);
+        }
+        batch.applyMatrix(matrices, {2});
+        checkBatch(batch, refs);
+    }
+    SECTION("Invalid arguments") {
+        REQUIRE_THROWS_WITH(batch.applyOperation("QubitUnitary", {0}),
+                            Catch::Contains("not supported"));
+        REQUIRE_THROWS_WITH(
+            batch.applyOperation("RX", {0}, false, {{0.1F}, {0.2F}}),
+            Catch::Contains("each state vector"));
+        REQUIRE_THROWS_WITH(
+            batch.applyMatrix(std::vector<std::complex<TestType>>(12), {0}),
+            Catch::Contains("each state vector"));
+    }
+    SECTION("Invalid gate parameters") {
+        REQUIRE_THROWS_WITH(batch.applyOperation("RX", {0}),
+                            Catch::Contains("number of gate parameters"));
+        REQUIRE_THROWS_WITH(batch.applyOperation("Rot", {0}, false, {{0.1F}}),
+                            Catch::Contains("number of gate parameters"));
+        REQUIRE_THROWS_WITH(
+            batch.applyOperation("Hadamard", {0}, false, {{0.1F}}),
+            Catch::Contains("number of gate parameters"));
+        std::vector<std::vector<TestType>> angles(batch_size, {0.1F});
+        angles.back().clear();
+        REQUIRE_THROWS_WITH(batch.applyOperation("RY", {0}, false, angles),
+                            Catch::Contains("number of gate parameters"));
+        REQUIRE_THROWS_WITH(batch.expval("RZ", {0}),
+                            Catch::Contains("number of gate parameters"));
+    }
+    SECTION("Invalid gate wires") {
+        REQUIRE_THROWS_WITH(batch.applyOperation("CNOT", {0}),
+                            Catch::Contains("number of wires"));
+        REQUIRE_THROWS_WITH(batch.applyOperation("RX", {0, 1}, false, {{0.1F}}),
+                            Catch::Contains("number of wires"));
+        std::vector<std::vector<TestType>> angles(batch_size, {0.1F});
+        REQUIRE_THROWS_WITH(batch.applyOperation("CRX", {0}, false, angles),
+                            Catch::Contains("number of wires"));
+        REQUIRE_THROWS_WITH(batch.expval("PauliX", {0, 1}),
+                            Catch::Contains("number of wires"));
+    }
+}
+
+TEMPLATE_TEST_CASE("BatchedStateVectorCudaManaged::reductions",
+                   "[BatchedStateVectorCudaManaged]", float, double) {
+    const std::size_t batch_size = 4;
+    const std::size_t num_qubits = 3;
+    BatchedStateVectorCudaManaged<TestType> batch{batch_size, num_qubits};
+    auto refs = makeReferences<TestType>(batch_size, num_qubits);
+
+    std::vector<std::vector<TestType>> angles;
+    for (std::size_t b = 0; b < batch_size; b++) {
+        angles.push_back({static_cast<TestType>(0.5 * b - 0.4)});
+    }
+    batch.applyOperation("RY", {0}, false, angles);
+    batch.applyOperation("Hadamard", {1});
+    batch.applyOperation("CRX", {0, 2}, false, angles);
+    for (std::size_t b = 0; b < batch_size; b++) {
+        refs[b].applyOperation("RY", {0}, false, angles[b]);
+        refs[b].applyOperation("Hadamard", {1});
+        refs[b].applyOperation("CRX", {0, 2}, false, angles[b]);
+    }
+
+    SECTION("probability") {
+        const std::vector<std::size_t> wires{2, 0};
+        const auto probs = batch.probability(wires);
+        REQUIRE(probs.size() == batch_size);
+        for (std::size_t b = 0; b < batch_size; b++) {
+            const auto expected = refs[b].probability(wires);
+            REQUIRE(probs[b].size() == expected.size());
+            for (std::size_t i = 0; i < expected.size(); i++) {
+                CHECK(probs[b][i] == Approx(expected[i]).margin(1e-5));
+            }
+        }
+    }
+    SECTION("expval") {
+        using ComplexT = std::complex<TestType>;
+        const std::vector<ComplexT> zz{1, 0, 0, 0, 0, -1, 0, 0,
+                                       0, 0, -1, 0, 0, 0, 0, 1};
+        const auto by_matrix = batch.expval(zz, {0, 2});
+        const auto by_name = batch.expval("PauliX", {1});
+        const std::vector<ComplexT> x{0, 1, 1, 0};
+        for (std::size_t b = 0; b < batch_size; b++) {
+            CHECK(by_matrix[b] ==
+                  Approx(refs[b].expval({0, 2}, zz).x).margin(1e-5));
+            CHECK(by_name[b] ==
+                  Approx(refs[b].expval({1}, x).x).margin(1e-5));
+        }
+    }
+    SECTION("Reset") {
+        batch.initSV();
+        const auto probs = batch.probability({0, 1, 2});
+        for (const auto &row : probs) {
+            CHECK(row[0] == Approx(1.0));
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "CSRPartition.hpp"
+
+using namespace Pennylane::MPI;
+
+/// @cond DEV
+namespace {
+/**
+ * @brief Random CSR matrix with sorted columns in each row.
+ */
+struct RandomCSR {
+    std::vector<std::int64_t> offsets{0};
+    std::vector<std::int64_t> columns;
+    std::vector<std::complex<double>> values;
+
+    RandomCSR(std::size_t num_rows, std::size_t num_cols, double density) {
+        std::mt19937 gen(1337);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        for (std::size_t row = 0; row < num_rows; row++) {
+            for (std::size_t col = 0; col < num_cols; col++) {
+                if (dist(gen) < density) {
+                    columns.push_back(static_cast<std::int64_t>(col));
+                    values.emplace_back(dist(gen), dist(gen));
+                }
+            }
+            offsets.push_back(static_cast<std::int64_t>(columns.size()));
+        }
+    }
+};
+
+/**
+ * @brief Value of the element (row, col) of a CSR matrix, zero if absent.
+ */
+auto getElement(const std::int64_t *offsets, const std::int64_t *columns,
+                const std::complex<double> *values, std::size_t row,
+                std::size_t col) -> std::complex<double> {
+    for (auto idx = offsets[row]; idx < offsets[row + 1]; idx++) {
+        if (static_cast<std::size_t>(columns[idx]) == col) {
+            return values[idx];
+        }
+    }
+    return {0.0, 0.0};
+}
+} // namespace
+/// @endcond
+
+TEST_CASE("partitionCSRMatrix", "[CSRPartition]") {
+    const std::size_t num_rows = 64;
+    const std::size_t block_size = 16;
+    const std::size_t num_blocks = num_rows / block_size;
+    const RandomCSR matrix(num_rows, num_rows, 0.2);
+
+    SECTION("Blocks hold every element once") {
+        auto blocks = partitionCSRMatrix<double, std::int64_t>(
+            num_rows, block_size, num_blocks, matrix.offsets.data(),
+            matrix.columns.data(), matrix.values.data());
+        REQUIRE(blocks.size() == num_blocks);
+
+        std::size_t nnz = 0;
+        for (std::size_t i = 0; i < num_blocks; i++) {
+            REQUIRE(blocks[i].size() == num_blocks);
+            for (std::size_t j = 0; j < num_blocks; j++) {
+                auto &block = blocks[i][j];
+                REQUIRE(block.getCsrOffsets().size() == block_size + 1);
+                CHECK(block.getCsrOffsets().back() ==
+                      static_cast<std::int64_t>(block.getValues().size()));
+                CHECK(block.getColumns().capacity() ==
+                      block.getColumns().size());
+                CHECK(block.getValues().capacity() == block.getValues().size());
+                nnz += block.getValues().size();
+                for (std::size_t row = 0; row < block_size; row++) {
+                    for (std::size_t col = 0; col < block_size; col++) {
+                        CHECK(getElement(block.getCsrOffsets().data(),
+                                         block.getColumns().data(),
+                                         block.getValues().data(), row, col) ==
+                              getElement(matrix.offsets.data(),
+                                         matrix.columns.data(),
+                                         matrix.values.data(),
+                                         i * block_size + row,
+                                         j * block_size + col));
+                    }
+                }
+            }
+        }
+        CHECK(nnz == matrix.values.size());
+    }
+
+    SECTION("Columns stay sorted") {
+        auto blocks = partitionCSRMatrix<double, std::int64_t>(
+            num_rows, block_size, num_blocks, matrix.offsets.data(),
+            matrix.columns.data(), matrix.values.data());
+        for (auto &block_row : blocks) {
+            for (auto &block : block_row) {
+                const auto &offsets = block.getCsrOffsets();
+                const auto &columns = block.getColumns();
+                for (std::size_t row = 0; row < block_size; row++) {
+                    for (auto idx = offsets[row] + 1; idx < offsets[row + 1];
+                         idx++) {
+                        CHECK(columns[idx - 1] < columns[idx]);
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Row range of a larger matrix") {
+        // The rows of the third block row, read in place.
+        const std::size_t first = 2 * block_size;
+        auto blocks = partitionCSRMatrix<double, std::int64_t>(
+            block_size, block_size, num_blocks, matrix.offsets.data() + first,
+            matrix.columns.data(), matrix.values.data());
+        auto full = partitionCSRMatrix<double, std::int64_t>(
+            num_rows, block_size, num_blocks, matrix.offsets.data(),
+            matrix.columns.data(), matrix.values.data());
+        REQUIRE(blocks.size() == 1);
+        for (std::size_t j = 0; j < num_blocks; j++) {
+            CHECK(blocks[0][j].getCsrOffsets() == full[2][j].getCsrOffsets());
+            CHECK(blocks[0][j].getColumns() == full[2][j].getColumns());
+            CHECK(blocks[0][j].getValues() == full[2][j].getValues());
+        }
+    }
+
+    SECTION("Empty blocks") {
+        // Block diagonal matrix: identity.
+        std::vector<std::int64_t> offsets(num_rows + 1);
+        std::vector<std::int64_t> columns(num_rows);
+        std::vector<std::complex<double>> values(num_rows, {1.0, 0.0});
+        for (std::size_t row = 0; row < num_rows; row++) {
+            offsets[row + 1] = static_cast<std::int64_t>(row + 1);
+            columns[row] = static_cast<std::int64_t>(row);
+        }
+        auto blocks = partitionCSRMatrix<double, std::int64_t>(
+            num_rows, block_size, num_blocks, offsets.data(), columns.data(),
+            values.data());
+        for (std::size_t i = 0; i < num_blocks; i++) {
+            for (std::size_t j = 0; j < num_blocks; j++) {
+                if (i == j) {
+                    CHECK(blocks[i][j].getValues().size() == block_size);
+                } else {
+                    CHECK(blocks[i][j].getValues().empty());
+                    CHECK(blocks[i][j].getCsrOffsets().empty());
+                }
+            }
+        }
+    }
+
+    SECTION("Invalid block size") {
+        CHECK_THROWS_WITH((partitionCSRMatrix<double, std::int64_t>(
+                              num_rows, 24, num_blocks, matrix.offsets.data(),
+                              matrix.columns.data(), matrix.values.data())),
+                          Catch::Contains("multiple of the block size"));
+    }
+}
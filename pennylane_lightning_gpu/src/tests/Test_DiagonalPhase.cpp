@@ -0,0 +1,69 @@
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "DiagonalPhase.hpp"
+
+using namespace Pennylane::CUDA;
+
+TEMPLATE_TEST_CASE("DiagonalPhase", "[DiagonalPhase]", float, double) {
+    SECTION("Diagonal gates") {
+        CHECK(Util::isDiagonalGate("ControlledPhaseShift"));
+        CHECK(Util::isDiagonalGate("MultiRZ"));
+        CHECK_FALSE(Util::isDiagonalGate("Hadamard"));
+        CHECK_FALSE(Util::isDiagonalGate("SWAP"));
+    }
+
+    SECTION("Terms sharing a Z mask are merged") {
+        Util::DiagonalPhase<TestType> phase;
+        // A QAOA cost layer on a triangle, twice.
+        for (std::size_t rep = 0; rep < 2; rep++) {
+            phase.addGate("IsingZZ", {0, 1}, 0.5, false);
+            phase.addGate("IsingZZ", {1, 2}, 0.5, false);
+            phase.addGate("IsingZZ", {2, 0}, 0.5, false);
+        }
+        CHECK(phase.getNumGates() == 6);
+        REQUIRE(phase.getNumTerms() == 3);
+        CHECK(phase.getZMasks() == std::vector<std::uint64_t>{3, 6, 5});
+        for (const auto angle : phase.getAngles()) {
+            CHECK(angle == Approx(-0.5));
+        }
+
+        phase.addGate("IsingZZ", {1, 0}, 1.0, true);
+        CHECK(phase.getAngles()[0] == Approx(0).margin(1e-6));
+        phase.clear();
+        CHECK(phase.getNumTerms() == 0);
+        CHECK(phase.getNumGates() == 0);
+    }
+
+    SECTION("Phase of each basis state") {
+        Util::DiagonalPhase<TestType> phase;
+        phase.addGate("ControlledPhaseShift", {2, 0}, 0.3, false);
+        phase.addGate("T", {1}, 0, true);
+        const TestType pi = static_cast<TestType>(M_PI);
+        for (std::uint64_t i = 0; i < 8; i++) {
+            TestType expected = 0;
+            if ((i & 5U) == 5U) {
+                expected += 0.3;
+            }
+            if (i & 2U) {
+                expected -= pi / 4;
+            }
+            CHECK(std::polar(TestType{1}, phase.getPhase(i)).real() ==
+                  Approx(std::cos(expected)).margin(1e-6));
+            CHECK(std::polar(TestType{1}, phase.getPhase(i)).imag() ==
+                  Approx(std::sin(expected)).margin(1e-6));
+        }
+    }
+
+    SECTION("Invalid gates") {
+        Util::DiagonalPhase<TestType> phase;
+        CHECK_THROWS(phase.addGate("Hadamard", {0}, 0, false));
+        CHECK_THROWS(phase.addGate("CZ", {0}, 0, false));
+        CHECK_THROWS(phase.addGate("CZ", {1, 1}, 0, false));
+        CHECK_THROWS(phase.addGate("MultiRZ", {}, 0, false));
+    }
+}
@@ -42,4 +42,45 @@ TEMPLATE_TEST_CASE("CuGateCache", "[CuGateCache]", float, double) {
             CHECK(H_host[i].y == Approx(H_transfer[i].imag()).epsilon(1e-7));
         }
     }
-}
\ No newline at end of file
+    SECTION("Eviction of parametric gates") {
+        gc.setMaxAllocBytes(gc.getTotalAllocBytes() +
+                            8 * sizeof(cp_dev_t) * length);
+        const std::size_t num_defaults = gc.getNumGates();
+        for (std::size_t i = 0; i < 32; i++) {
+            const auto param = static_cast<TestType>(0.1 * (i + 1));
+            CHECK_FALSE(gc.gateExists("PhaseShift", param));
+            gc.add_gate("PhaseShift", param,
+                        cuGates::getPhaseShift<cp_dev_t>(param));
+        }
+        CHECK(gc.getEvictions() == 24);
+        CHECK(gc.getNumGates() == num_defaults + 8);
+        CHECK(gc.getTotalAllocBytes() <= gc.getMaxAllocBytes());
+        CHECK(gc.gateExists("Hadamard", 0.0));
+        CHECK(gc.gateExists("PhaseShift", static_cast<TestType>(3.2)));
+        CHECK_FALSE(gc.gateExists("PhaseShift", static_cast<TestType>(0.1)));
+        CHECK(gc.getHits() == 2);
+        CHECK(gc.getMisses() == 33);
+    }
+    SECTION("Gates are keyed on their name") {
+        const auto param = static_cast<TestType>(0.5);
+        {
+            // The cache keeps its own copy of the name.
+            const std::string name{"RX"};
+            gc.add_gate(name, param, cuGates::getRX<cp_dev_t>(param));
+        }
+        CHECK(gc.gateExists(std::string{"RX"}, param));
+        CHECK_FALSE(gc.gateExists("RY", param));
+        gc.add_gate("RY", param, cuGates::getRY<cp_dev_t>(param));
+        CHECK(gc.get_gate_host("RY", param)[2].x ==
+              Approx(std::sin(param / 2)));
+        CHECK(gc.get_gate_host("RX", param)[2].x == Approx(0.0));
+    }
+    SECTION("Parameter quantization") {
+        gc.setParamQuantization(static_cast<TestType>(1e-3));
+        gc.add_gate("RZ", static_cast<TestType>(0.5),
+                    cuGates::getRZ<cp_dev_t>(static_cast<TestType>(0.5)));
+        CHECK(gc.gateExists("RZ", static_cast<TestType>(0.5 + 1e-5)));
+        CHECK_FALSE(gc.gateExists("RZ", static_cast<TestType>(0.51)));
+        CHECK(gc.gateExists("Hadamard", 0.0));
+    }
+}
@@ -0,0 +1,163 @@
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "GateFusion.hpp"
+
+using namespace Pennylane::CUDA;
+
+/// @cond DEV
+namespace {
+template <class PrecisionT>
+auto getRandomUnitary2(std::mt19937 &re)
+    -> std::vector<std::complex<PrecisionT>> {
+    // General single-qubit unitary from three Euler angles and a phase.
+    std::uniform_real_distribution<PrecisionT> dist(0, 2 * M_PI);
+    const PrecisionT a = dist(re);
+    const PrecisionT b = dist(re);
+    const PrecisionT c = dist(re);
+    const PrecisionT d = dist(re);
+    const std::complex<PrecisionT> i{0, 1};
+    return {std::exp(i * (a - b / 2 - d / 2)) * std::cos(c / 2),
+            -std::exp(i * (a - b / 2 + d / 2)) * std::sin(c / 2),
+            std::exp(i * (a + b / 2 - d / 2)) * std::sin(c / 2),
+            std::exp(i * (a + b / 2 + d / 2)) * std::cos(c / 2)};
+}
+
+template <class PrecisionT>
+auto getCNOT() -> std::vector<std::complex<PrecisionT>> {
+    return {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0};
+}
+
+template <class PrecisionT>
+auto getRandomState(std::mt19937 &re, std::size_t num_qubits)
+    -> std::vector<std::complex<PrecisionT>> {
+    std::normal_distribution<PrecisionT> dist;
+    std::vector<std::complex<PrecisionT>> state(std::size_t{1} << num_qubits);
+    PrecisionT norm = 0;
+    for (auto &e : state) {
+        e = {dist(re), dist(re)};
+        norm += std::norm(e);
+    }
+    for (auto &e : state) {
+        e /= std::sqrt(norm);
+    }
+    return state;
+}
+} // namespace
+/// @endcond
+
+TEST_CASE("GateFusionPlanner::plan", "[GateFusion]") {
+    SECTION("Merge up to the qubit limit") {
+        GateFusionPlanner planner{2};
+        const std::vector<std::vector<std::size_t>> wires{
+            {0}, {1}, {0, 1}, {2}, {2, 3}, {3}};
+        const std::vector<bool> fusable(wires.size(), true);
+        const auto blocks = planner.plan(wires, fusable);
+
+        REQUIRE(blocks.size() == 2);
+        CHECK(blocks[0].fused);
+        CHECK(blocks[0].wires == std::vector<std::size_t>{0, 1});
+        CHECK(blocks[0].op_indices == std::vector<std::size_t>{0, 1, 2});
+        CHECK(blocks[1].fused);
+        CHECK(blocks[1].wires == std::vector<std::size_t>{2, 3});
+        CHECK(blocks[1].op_indices == std::vector<std::size_t>{3, 4, 5});
+    }
+    SECTION("Non-fusable operations split blocks") {
+        GateFusionPlanner planner{5};
+        const std::vector<std::vector<std::size_t>> wires{{0}, {1}, {0}, {1}};
+        const std::vector<bool> fusable{true, true, false, true};
+        const auto blocks = planner.plan(wires, fusable);
+
+        REQUIRE(blocks.size() == 3);
+        CHECK(blocks[0].fused);
+        CHECK(blocks[0].op_indices == std::vector<std::size_t>{0, 1});
+        CHECK_FALSE(blocks[1].fused);
+        CHECK(blocks[1].op_indices == std::vector<std::size_t>{2});
+        CHECK_FALSE(blocks[2].fused);
+        CHECK(blocks[2].op_indices == std::vector<std::size_t>{3});
+    }
+    SECTION("Gates larger than the limit are not fused") {
+        GateFusionPlanner planner{2};
+        const std::vector<std::vector<std::size_t>> wires{{0}, {0, 1, 2}, {1}};
+        const std::vector<bool> fusable(wires.size(), true);
+        const auto blocks = planner.plan(wires, fusable);
+
+        REQUIRE(blocks.size() == 3);
+        for (const auto &block : blocks) {
+            CHECK_FALSE(block.fused);
+        }
+    }
+    SECTION("Invalid limit") {
+        REQUIRE_THROWS(GateFusionPlanner{0});
+    }
+}
+
+TEMPLATE_TEST_CASE("GateFusion::composeFusedMatrix", "[GateFusion]", float,
+                   double) {
+    using ComplexT = std::complex<TestType>;
+    const std::size_t num_qubits = 4;
+    std::mt19937 re{1337};
+
+    std::vector<std::vector<ComplexT>> matrices;
+    std::vector<std::vector<std::size_t>> wires;
+    std::vector<bool> adjoints;
+    for (std::size_t layer = 0; layer < 3; layer++) {
+        for (std::size_t w = 0; w < num_qubits; w++) {
+            matrices.push_back(getRandomUnitary2<TestType>(re));
+            wires.push_back({w});
+            adjoints.push_back(layer == 1);
+        }
+        for (std::size_t w = 0; w + 1 < num_qubits; w++) {
+            matrices.push_back(getCNOT<TestType>());
+            wires.push_back({w + 1 - layer % 2, w + layer % 2});
+            adjoints.push_back(false);
+        }
+    }
+
+    const auto init_state = getRandomState<TestType>(re, num_qubits);
+
+    auto expected = init_state;
+    for (std::size_t g = 0; g < matrices.size(); g++) {
+        applyMatrixHost(expected.data(), num_qubits, matrices[g].data(),
+                        wires[g], adjoints[g]);
+    }
+
+    for (std::size_t max_qubits = 1; max_qubits <= num_qubits; max_qubits++) {
+        DYNAMIC_SECTION("Fused blocks of at most " << max_qubits
+                                                   << " qubits") {
+            GateFusionPlanner planner{max_qubits};
+            const auto blocks = planner.plan(
+                wires, std::vector<bool>(matrices.size(), true));
+
+            auto result = init_state;
+            for (const auto &block : blocks) {
+                CHECK(block.wires.size() <= std::max<std::size_t>(
+                                                max_qubits, 2));
+                std::vector<std::vector<ComplexT>> block_matrices;
+                std::vector<std::vector<std::size_t>> block_gate_wires;
+                std::vector<bool> block_adjoints;
+                for (const auto op_idx : block.op_indices) {
+                    block_matrices.push_back(matrices[op_idx]);
+                    block_gate_wires.push_back(wires[op_idx]);
+                    block_adjoints.push_back(adjoints[op_idx]);
+                }
+                const auto fused = composeFusedMatrix<TestType>(
+                    block.wires, block_matrices, block_gate_wires,
+                    block_adjoints);
+                applyMatrixHost(result.data(), num_qubits, fused.data(),
+                                block.wires);
+            }
+
+            for (std::size_t i = 0; i < result.size(); i++) {
+                CHECK(result[i].real() ==
+                      Approx(expected[i].real()).margin(1e-5));
+                CHECK(result[i].imag() ==
+                      Approx(expected[i].imag()).margin(1e-5));
+            }
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "LRUCache.hpp"
+
+using namespace Pennylane::CUDA::Util;
+
+/// @cond DEV
+namespace {
+/**
+ * @brief Non-movable value type, mimicking device buffers.
+ */
+struct Resource {
+    std::vector<int> data;
+    explicit Resource(std::size_t n) : data(n, 0) {}
+    Resource(const Resource &) = delete;
+    Resource(Resource &&) = delete;
+};
+} // namespace
+/// @endcond
+
+TEST_CASE("LRUCache::emplace and find", "[LRUCache]") {
+    LRUCache<std::string, Resource> cache{0};
+
+    cache.emplace("a", 4, false, 1);
+    cache.emplace("b", 8, false, 2);
+    CHECK(cache.size() == 2);
+    CHECK(cache.getTotalBytes() == 12);
+
+    REQUIRE(cache.find("a") != nullptr);
+    CHECK(cache.find("a")->data.size() == 1);
+    CHECK(cache.find("c") == nullptr);
+    CHECK(cache.getHits() == 2);
+    CHECK(cache.getMisses() == 1);
+
+    CHECK(cache.contains("b"));
+    CHECK_FALSE(cache.contains("c"));
+    CHECK(cache.getHits() == 2);
+    CHECK(cache.getMisses() == 1);
+
+    SECTION("Replace an existing key") {
+        cache.emplace("a", 16, false, 3);
+        CHECK(cache.size() == 2);
+        CHECK(cache.getTotalBytes() == 24);
+        CHECK(cache.at("a").data.size() == 3);
+    }
+    SECTION("Erase and clear") {
+        CHECK(cache.erase("a"));
+        CHECK_FALSE(cache.erase("a"));
+        CHECK(cache.getTotalBytes() == 8);
+        cache.clear();
+        CHECK(cache.size() == 0);
+        CHECK(cache.getTotalBytes() == 0);
+    }
+    SECTION("Unbounded cache never evicts") {
+        for (int i = 0; i < 100; i++) {
+            cache.emplace(std::to_string(i), 1024, false, 1);
+        }
+        CHECK(cache.getEvictions() == 0);
+        CHECK(cache.size() == 102);
+    }
+}
+
+TEST_CASE("LRUCache::eviction", "[LRUCache]") {
+    LRUCache<int, Resource> cache{32};
+
+    SECTION("Least-recently-used entry is evicted first") {
+        cache.emplace(0, 8, false, 1);
+        cache.emplace(1, 8, false, 1);
+        cache.emplace(2, 8, false, 1);
+        cache.emplace(3, 8, false, 1);
+        CHECK(cache.getTotalBytes() == 32);
+
+        // Mark 0 as recently used, so 1 becomes the eviction candidate.
+        CHECK(cache.find(0) != nullptr);
+        cache.emplace(4, 8, false, 1);
+
+        CHECK(cache.getEvictions() == 1);
+        CHECK(cache.contains(0));
+        CHECK_FALSE(cache.contains(1));
+        CHECK(cache.contains(4));
+        CHECK(cache.getTotalBytes() == 32);
+    }
+    SECTION("Pinned entries are never evicted") {
+        cache.emplace(0, 16, true, 1);
+        cache.emplace(1, 8, false, 1);
+        cache.emplace(2, 8, false, 1);
+        cache.emplace(3, 16, false, 1);
+
+        CHECK(cache.contains(0));
+        CHECK_FALSE(cache.contains(1));
+        CHECK_FALSE(cache.contains(2));
+        CHECK(cache.contains(3));
+        CHECK(cache.getEvictions() == 2);
+
+        cache.clear(true);
+        CHECK(cache.size() == 1);
+        CHECK(cache.contains(0));
+        CHECK(cache.getTotalBytes() == 16);
+    }
+    SECTION("Oversized entries are still inserted") {
+        cache.emplace(0, 8, true, 1);
+        cache.emplace(1, 8, false, 1);
+        cache.emplace(2, 64, false, 1);
+
+        CHECK(cache.contains(0));
+        CHECK_FALSE(cache.contains(1));
+        CHECK(cache.contains(2));
+        CHECK(cache.getTotalBytes() == 72);
+    }
+    SECTION("Shrinking the budget evicts entries") {
+        for (int i = 0; i < 4; i++) {
+            cache.emplace(i, 8, false, 1);
+        }
+        cache.setMaxBytes(16);
+        CHECK(cache.getMaxBytes() == 16);
+        CHECK(cache.size() == 2);
+        CHECK(cache.contains(2));
+        CHECK(cache.contains(3));
+        CHECK(cache.getEvictions() == 2);
+
+        cache.resetStats();
+        CHECK(cache.getEvictions() == 0);
+    }
+}
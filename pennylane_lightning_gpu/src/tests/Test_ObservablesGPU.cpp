@@ -350,3 +350,223 @@ TEMPLATE_TEST_CASE("ObservablesGPU::HamiltonianGPU", "[ObservablesGPU]", float,
         }
     }
 }
+
+TEMPLATE_TEST_CASE("ObservablesGPU::HamiltonianGPU Pauli sentence",
+                   "[ObservablesGPU]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    const size_t num_qubits = 4;
+
+    auto x0 = std::make_shared<NamedObsGPU<TestType>>("PauliX",
+                                                      std::vector<size_t>{0});
+    auto y1 = std::make_shared<NamedObsGPU<TestType>>("PauliY",
+                                                      std::vector<size_t>{1});
+    auto z3 = std::make_shared<NamedObsGPU<TestType>>("PauliZ",
+                                                      std::vector<size_t>{3});
+    auto id2 = std::make_shared<NamedObsGPU<TestType>>("Identity",
+                                                       std::vector<size_t>{2});
+    auto rx = std::make_shared<NamedObsGPU<TestType>>(
+        "RX", std::vector<size_t>{2}, std::vector<TestType>{0.3});
+
+    const std::vector<TestType> coeffs{0.4, -1.1, 0.25, 0.8};
+    const std::vector<std::shared_ptr<ObservableGPU<TestType>>> terms{
+        TensorProdObsGPU<TestType>::create({x0, y1}),
+        TensorProdObsGPU<TestType>::create({y1, z3}), id2, x0};
+    HamiltonianGPU<TestType> ham{coeffs, terms};
+    HamiltonianGPU<TestType> ham_rx{
+        std::vector<TestType>{0.4, 1.0},
+        std::vector<std::shared_ptr<ObservableGPU<TestType>>>{x0, rx}};
+    REQUIRE(ham.isPauliSentence());
+    CHECK_FALSE(ham_rx.isPauliSentence());
+    CHECK_THROWS_WITH(ham_rx.getPauliSentence(num_qubits),
+                      Catch::Contains("not a sum of Pauli words"));
+
+    std::vector<ComplexT> init_state(size_t{1} << num_qubits);
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = {static_cast<TestType>(std::cos(0.3 * i)),
+                         static_cast<TestType>(std::sin(0.7 * i))};
+    }
+    StateVectorCudaManaged<TestType> sv{init_state.data(), init_state.size()};
+    ham.applyInPlace(sv);
+    std::vector<ComplexT> result(init_state.size());
+    sv.CopyGpuDataToHost(result.data(), result.size());
+
+    // Reference: each term applied to its own copy of the state.
+    std::vector<ComplexT> expected(init_state.size());
+    for (size_t t = 0; t < terms.size(); t++) {
+        StateVectorCudaManaged<TestType> sv_term{init_state.data(),
+                                                 init_state.size()};
+        terms[t]->applyInPlace(sv_term);
+        std::vector<ComplexT> term(init_state.size());
+        sv_term.CopyGpuDataToHost(term.data(), term.size());
+        for (size_t i = 0; i < term.size(); i++) {
+            expected[i] += coeffs[t] * term[i];
+        }
+    }
+    for (size_t i = 0; i < result.size(); i++) {
+        CHECK(result[i].real() == Approx(expected[i].real()).margin(1e-5));
+        CHECK(result[i].imag() == Approx(expected[i].imag()).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("ObservablesGPU::SparseHamiltonianGPU device matrix",
+                   "[ObservablesGPU]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    using IdxT = typename SparseHamiltonianGPU<TestType>::IdxT;
+    const size_t num_qubits = 2;
+
+    const std::vector<ComplexT> data{
+        {1.0, 0.0}, {0.0, -0.5}, {0.0, 0.5}, {-1.0, 0.0},
+        {2.0, 0.0}, {0.3, 0.0},  {0.3, 0.0}, {-2.0, 0.0}};
+    const std::vector<IdxT> indices{0, 1, 0, 1, 2, 3, 2, 3};
+    const std::vector<IdxT> offsets{0, 2, 4, 6, 8};
+    SparseHamiltonianGPU<TestType> ham{data, indices, offsets,
+                                       std::vector<size_t>{0, 1}};
+
+    std::vector<ComplexT> init_state(size_t{1} << num_qubits);
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = {static_cast<TestType>(std::cos(0.3 * i)),
+                         static_cast<TestType>(std::sin(0.7 * i))};
+    }
+    std::vector<ComplexT> expected = init_state;
+    const size_t num_applications = 3;
+    for (size_t n = 0; n < num_applications; n++) {
+        std::vector<ComplexT> next(expected.size());
+        for (size_t row = 0; row + 1 < offsets.size(); row++) {
+            for (auto k = offsets[row]; k < offsets[row + 1]; k++) {
+                next[row] += data[k] * expected[indices[k]];
+            }
+        }
+        expected = next;
+    }
+
+    StateVectorCudaManaged<TestType> sv{init_state.data(), init_state.size()};
+    for (size_t n = 0; n < num_applications; n++) {
+        ham.applyInPlace(sv);
+    }
+
+    std::vector<ComplexT> result(init_state.size());
+    sv.CopyGpuDataToHost(result.data(), result.size());
+    for (size_t i = 0; i < result.size(); i++) {
+        CHECK(result[i].real() == Approx(expected[i].real()).margin(1e-4));
+        CHECK(result[i].imag() == Approx(expected[i].imag()).margin(1e-4));
+    }
+
+    // Copies of the observable share the device matrix.
+    const SparseHamiltonianGPU<TestType> ham_copy{ham};
+    StateVectorCudaManaged<TestType> sv2{init_state.data(), init_state.size()};
+    ham_copy.applyInPlace(sv2);
+
+    const auto stats = ham.getDeviceMatrixStats();
+    const size_t bytes = offsets.size() * sizeof(IdxT) +
+                         indices.size() * sizeof(IdxT) +
+                         data.size() * sizeof(ComplexT);
+    CHECK(stats.num_uploads == 1);
+    CHECK(stats.num_reuses == num_applications);
+    CHECK(stats.bytes_uploaded == bytes);
+    CHECK(stats.bytes_saved == num_applications * bytes);
+    CHECK(&ham.getDeviceMatrix(sv) == &ham_copy.getDeviceMatrix(sv2));
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::variance", "[ObservablesGPU]",
+                   float, double) {
+    using ComplexT = std::complex<TestType>;
+    using IdxT = typename SparseHamiltonianGPU<TestType>::IdxT;
+    const size_t num_qubits = 3;
+
+    std::vector<ComplexT> init_state(size_t{1} << num_qubits);
+    TestType norm = 0;
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = {static_cast<TestType>(std::cos(0.3 * i)),
+                         static_cast<TestType>(std::sin(0.7 * i))};
+        norm += std::norm(init_state[i]);
+    }
+    for (auto &e : init_state) {
+        e /= std::sqrt(norm);
+    }
+    StateVectorCudaManaged<TestType> sv{init_state.data(), init_state.size()};
+
+    // Reference: <psi|H^power|psi>, applying the observable `power` times.
+    const auto moment = [&](const ObservableGPU<TestType> &ob, size_t power) {
+        StateVectorCudaManaged<TestType> sv_h{init_state.data(),
+                                              init_state.size()};
+        for (size_t p = 0; p < power; p++) {
+            ob.applyInPlace(sv_h);
+        }
+        std::vector<ComplexT> h_psi(init_state.size());
+        sv_h.CopyGpuDataToHost(h_psi.data(), h_psi.size());
+        ComplexT result{0, 0};
+        for (size_t i = 0; i < h_psi.size(); i++) {
+            result += std::conj(init_state[i]) * h_psi[i];
+        }
+        return std::real(result);
+    };
+    const auto check_variance = [&](const ObservableGPU<TestType> &ob) {
+        const auto mean = moment(ob, 1);
+        CHECK(sv.variance(ob) ==
+              Approx(moment(ob, 2) - mean * mean).margin(1e-5));
+    };
+
+    auto x0 = std::make_shared<NamedObsGPU<TestType>>("PauliX",
+                                                      std::vector<size_t>{0});
+    auto y1 = std::make_shared<NamedObsGPU<TestType>>("PauliY",
+                                                      std::vector<size_t>{1});
+    auto z2 = std::make_shared<NamedObsGPU<TestType>>("PauliZ",
+                                                      std::vector<size_t>{2});
+    auto h1 = std::make_shared<NamedObsGPU<TestType>>("Hadamard",
+                                                      std::vector<size_t>{1});
+
+    SECTION("Pauli words") {
+        check_variance(*x0);
+        check_variance(*TensorProdObsGPU<TestType>::create({x0, y1, z2}));
+    }
+
+    SECTION("Hermitian") {
+        // Diagonal, with wires[0] as the most significant bit of the row.
+        HermitianObsGPU<TestType> diag{
+            {{1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0},
+             {0.0, 0.0}, {-0.5, 0.0}, {0.0, 0.0}, {0.0, 0.0},
+             {0.0, 0.0}, {0.0, 0.0}, {2.0, 0.0}, {0.0, 0.0},
+             {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.3, 0.0}},
+            {2, 0}};
+        std::vector<TestType> diag_elems;
+        REQUIRE(diag.getDiagonal(diag_elems));
+        check_variance(diag);
+
+        HermitianObsGPU<TestType> dense{
+            {{1.0, 0.0}, {0.5, -0.2}, {0.5, 0.2}, {-0.7, 0.0}}, {1}};
+        REQUIRE_FALSE(dense.getDiagonal(diag_elems));
+        check_variance(dense);
+    }
+
+    SECTION("Hamiltonians") {
+        HamiltonianGPU<TestType> ham{
+            std::vector<TestType>{0.4, -1.1, 0.25},
+            std::vector<std::shared_ptr<ObservableGPU<TestType>>>{
+                TensorProdObsGPU<TestType>::create({x0, y1}), z2,
+                TensorProdObsGPU<TestType>::create({x0, z2})}};
+        REQUIRE(ham.isPauliSentence());
+        check_variance(ham);
+
+        HamiltonianGPU<TestType> ham_h{
+            std::vector<TestType>{0.4, 0.9},
+            std::vector<std::shared_ptr<ObservableGPU<TestType>>>{x0, h1}};
+        check_variance(ham_h);
+    }
+
+    SECTION("SparseHamiltonian") {
+        std::vector<ComplexT> data;
+        std::vector<IdxT> indices;
+        std::vector<IdxT> offsets{0};
+        for (size_t row = 0; row < init_state.size(); row++) {
+            const size_t col = row ^ 5U;
+            indices.push_back(static_cast<IdxT>(std::min(row, col)));
+            indices.push_back(static_cast<IdxT>(std::max(row, col)));
+            data.emplace_back(row < col ? 0.5 * row - 1 : 0.3, 0.0);
+            data.emplace_back(row < col ? 0.3 : 0.5 * row - 1, 0.0);
+            offsets.push_back(static_cast<IdxT>(indices.size()));
+        }
+        SparseHamiltonianGPU<TestType> ham{data, indices, offsets,
+                                           std::vector<size_t>{0, 1, 2}};
+        check_variance(ham);
+    }
+}
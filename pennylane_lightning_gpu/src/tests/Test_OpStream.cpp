@@ -0,0 +1,80 @@
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "OpStream.hpp"
+
+using namespace Pennylane::CUDA;
+
+namespace {
+/// Op code of a gate with a fixed op code.
+auto opCode(const std::string &name) -> std::int64_t {
+    const auto &names = Util::getOpStreamGateNames();
+    for (std::size_t code = 0; code < names.size(); code++) {
+        if (names[code] == name) {
+            return static_cast<std::int64_t>(code);
+        }
+    }
+    return -1;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("OpStream", "[OpStream]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    const auto num_fixed =
+        static_cast<std::int64_t>(Util::getOpStreamGateNames().size());
+
+    // RX(0.3) on 1, adjoint CNOT on (0, 2), QubitUnitary on 2, Hadamard on 0.
+    std::vector<std::string> names = Util::getOpStreamGateNames();
+    names.emplace_back("QubitUnitary");
+    const std::vector<std::int64_t> op_codes{opCode("RX"), opCode("CNOT"),
+                                             num_fixed, opCode("Hadamard")};
+    const std::vector<std::int64_t> wire_offsets{0, 1, 3, 4, 5};
+    const std::vector<std::int64_t> wires{1, 0, 2, 2, 0};
+    const std::vector<std::int64_t> param_offsets{0, 1, 1, 1, 1};
+    const std::vector<TestType> params{0.3};
+    const bool inverses[] = {false, true, false, false};
+    const std::vector<std::int64_t> matrix_offsets{0, 0, 0, 4, 4};
+    const std::vector<ComplexT> matrices{0, ComplexT{0, 1}, ComplexT{0, 1},
+                                         0};
+
+    SECTION("Read the operations in place") {
+        const Util::OpStream<TestType> ops{
+            names,  op_codes, wire_offsets,   wires,   param_offsets,
+            params, inverses, matrix_offsets, matrices};
+        REQUIRE(ops.getNumOps() == 4);
+        CHECK(ops.getName(0) == "RX");
+        CHECK(ops.getParams(0) == std::vector<TestType>{0.3});
+        CHECK(ops.getWires(1) == std::vector<std::size_t>{0, 2});
+        CHECK(ops.getInverse(1));
+        CHECK(ops.getName(2) == "QubitUnitary");
+        CHECK(ops.hasMatrix(2));
+        CHECK(ops.getMatrix(2) == matrices);
+        CHECK(ops.getParams(2).empty());
+        CHECK_FALSE(ops.hasMatrix(3));
+        CHECK(ops.getWires(3) == std::vector<std::size_t>{0});
+    }
+
+    SECTION("Invalid layouts") {
+        const std::vector<std::int64_t> bad_codes{0, 1, num_fixed + 1, 2};
+        CHECK_THROWS(Util::OpStream<TestType>{
+            names, bad_codes, wire_offsets, wires, param_offsets, params,
+            inverses, matrix_offsets, matrices});
+        const std::vector<std::int64_t> short_offsets{0, 1, 3, 4};
+        CHECK_THROWS(Util::OpStream<TestType>{
+            names, op_codes, short_offsets, wires, param_offsets, params,
+            inverses, matrix_offsets, matrices});
+        const std::vector<std::int64_t> decreasing{0, 1, 0, 4, 5};
+        CHECK_THROWS(Util::OpStream<TestType>{
+            names, op_codes, decreasing, wires, param_offsets, params,
+            inverses, matrix_offsets, matrices});
+        const std::vector<std::int64_t> too_long{0, 1, 1, 1, 2};
+        CHECK_THROWS(Util::OpStream<TestType>{
+            names, op_codes, wire_offsets, wires, too_long, params, inverses,
+            matrix_offsets, matrices});
+    }
+}
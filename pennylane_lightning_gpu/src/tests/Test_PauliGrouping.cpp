@@ -0,0 +1,230 @@
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "PauliGrouping.hpp"
+
+using namespace Pennylane::CUDA;
+
+/// @cond DEV
+namespace {
+template <class PrecisionT>
+auto getRandomState(std::mt19937 &re, std::size_t num_qubits)
+    -> std::vector<std::complex<PrecisionT>> {
+    std::normal_distribution<PrecisionT> dist;
+    std::vector<std::complex<PrecisionT>> state(std::size_t{1} << num_qubits);
+    PrecisionT norm = 0;
+    for (auto &e : state) {
+        e = {dist(re), dist(re)};
+        norm += std::norm(e);
+    }
+    for (auto &e : state) {
+        e /= std::sqrt(norm);
+    }
+    return state;
+}
+
+/**
+ * @brief Dense state vector, where wire `w` is bit `num_qubits - 1 - w` of
+ * the basis-state index, with the gates of `Util::rotateToGroupBasis`.
+ */
+template <class PrecisionT> struct DenseState {
+    using ComplexT = std::complex<PrecisionT>;
+    std::vector<ComplexT> data;
+    std::size_t num_qubits;
+
+    void applyMatrix(const std::vector<ComplexT> &matrix, std::size_t wire) {
+        const std::size_t bit = std::size_t{1} << (num_qubits - 1 - wire);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            if ((i & bit) == 0) {
+                const auto v0 = data[i];
+                const auto v1 = data[i | bit];
+                data[i] = matrix[0] * v0 + matrix[1] * v1;
+                data[i | bit] = matrix[2] * v0 + matrix[3] * v1;
+            }
+        }
+    }
+
+    void applyOperation(const std::string &opName,
+                        const std::vector<std::size_t> &wires, bool adjoint) {
+        const PrecisionT h = 1 / std::sqrt(PrecisionT{2});
+        if (opName == "Hadamard") {
+            applyMatrix({h, h, h, -h}, wires[0]);
+        } else if (opName == "S") {
+            applyMatrix({1, 0, 0, ComplexT{0, adjoint ? -1 : PrecisionT{1}}},
+                        wires[0]);
+        } else {
+            FAIL("Unexpected gate " << opName);
+        }
+    }
+
+    /// Probabilities of the wires, where bit `k` of the outcome is
+    /// `wires[k]`.
+    [[nodiscard]] auto probability(const std::vector<std::size_t> &wires) const
+        -> std::vector<double> {
+        std::vector<double> probs(std::size_t{1} << wires.size(), 0.0);
+        for (std::size_t i = 0; i < data.size(); i++) {
+            std::size_t outcome = 0;
+            for (std::size_t k = 0; k < wires.size(); k++) {
+                outcome |= ((i >> (num_qubits - 1 - wires[k])) & 1U) << k;
+            }
+            probs[outcome] += std::norm(data[i]);
+        }
+        return probs;
+    }
+
+    /// Expectation value of a Pauli word.
+    [[nodiscard]] auto expectationValuePauli(
+        const std::string &word, const std::vector<std::size_t> &wires) const
+        -> double {
+        using C = ComplexT;
+        DenseState applied{data, num_qubits};
+        for (std::size_t k = 0; k < word.size(); k++) {
+            switch (word[k]) {
+            case 'X':
+                applied.applyMatrix({0, 1, 1, 0}, wires[k]);
+                break;
+            case 'Y':
+                applied.applyMatrix({0, C{0, -1}, C{0, 1}, 0}, wires[k]);
+                break;
+            case 'Z':
+                applied.applyMatrix({1, 0, 0, -1}, wires[k]);
+                break;
+            default:
+                break;
+            }
+        }
+        double expect = 0;
+        for (std::size_t i = 0; i < data.size(); i++) {
+            expect += std::real(std::conj(data[i]) * applied.data[i]);
+        }
+        return expect;
+    }
+};
+} // namespace
+/// @endcond
+
+TEST_CASE("groupQubitWiseCommuting", "[PauliGrouping]") {
+    SECTION("First-fit grouping") {
+        const std::vector<std::string> words{"ZZ", "Z", "XX",
+                                             "X",  "Y", "ZZ"};
+        const std::vector<std::vector<std::size_t>> wires{
+            {0, 1}, {0}, {0, 1}, {1}, {2}, {1, 2}};
+        const auto groups = Util::groupQubitWiseCommuting(words, wires);
+        REQUIRE(groups.size() == 3);
+
+        CHECK(groups[0].wires == std::vector<std::size_t>{0, 1, 2});
+        CHECK(groups[0].basis == "ZZY");
+        CHECK(groups[0].terms == std::vector<std::size_t>{0, 1, 4});
+        CHECK(groups[0].term_masks == std::vector<std::uint64_t>{3, 1, 4});
+        CHECK_FALSE(groups[0].isDiagonal());
+
+        CHECK(groups[1].wires == std::vector<std::size_t>{0, 1});
+        CHECK(groups[1].basis == "XX");
+        CHECK(groups[1].terms == std::vector<std::size_t>{2, 3});
+        CHECK(groups[1].term_masks == std::vector<std::uint64_t>{3, 2});
+
+        CHECK(groups[2].wires == std::vector<std::size_t>{1, 2});
+        CHECK(groups[2].basis == "ZZ");
+        CHECK(groups[2].terms == std::vector<std::size_t>{5});
+        CHECK(groups[2].term_masks == std::vector<std::uint64_t>{3});
+        CHECK(groups[2].isDiagonal());
+    }
+
+    SECTION("Identity words") {
+        const auto groups =
+            Util::groupQubitWiseCommuting({"II", "I"}, {{1, 3}, {2}});
+        REQUIRE(groups.size() == 1);
+        CHECK(groups[0].wires == std::vector<std::size_t>{0});
+        CHECK(groups[0].basis == "Z");
+        CHECK(groups[0].term_masks == std::vector<std::uint64_t>{0, 0});
+    }
+
+    SECTION("Number of state passes") {
+        const auto groups = Util::groupQubitWiseCommuting(
+            {"ZZ", "Z", "XY", "X", "Y", "XY"},
+            {{0, 1}, {1}, {2, 3}, {2}, {3}, {2, 3}});
+        REQUIRE(groups.size() == 1);
+        // One copy, one gate on wire 2, two on wire 3 and one reduction.
+        CHECK(groups[0].getNumStatePasses() == 5);
+        CHECK(groups[0].isWorthGrouping());
+
+        const auto diagonal =
+            Util::groupQubitWiseCommuting({"ZZ", "Z"}, {{0, 1}, {1}});
+        CHECK(diagonal[0].getNumStatePasses() == 1);
+        CHECK(diagonal[0].isWorthGrouping());
+
+        const auto single = Util::groupQubitWiseCommuting({"X"}, {{0}});
+        CHECK_FALSE(single[0].isWorthGrouping());
+    }
+
+    SECTION("Invalid words") {
+        CHECK_THROWS(Util::groupQubitWiseCommuting({"A"}, {{0}}));
+        CHECK_THROWS(Util::groupQubitWiseCommuting({"XX"}, {{0}}));
+        CHECK_THROWS(Util::groupQubitWiseCommuting({"X"}, {}));
+    }
+}
+
+TEST_CASE("planPauliExpectation", "[PauliGrouping]") {
+    SECTION("Diagonal words") {
+        const auto plan = Util::planPauliExpectation({"ZZ", "Z", "Z"},
+                                                     {{0, 1}, {0}, {1}});
+        REQUIRE(plan.groups.size() == 1);
+        CHECK(plan.groups[0].terms == std::vector<std::size_t>{0, 1, 2});
+        CHECK(plan.sentence_terms.empty());
+    }
+
+    SECTION("Group saving sentence gathers") {
+        // Seven flip sets: eight sentence passes against five for the group.
+        const auto plan = Util::planPauliExpectation(
+            {"X", "X", "X", "XX", "XX", "XX", "XXX"},
+            {{0}, {1}, {2}, {0, 1}, {1, 2}, {0, 2}, {0, 1, 2}});
+        REQUIRE(plan.groups.size() == 1);
+        CHECK(plan.groups[0].basis == "XXX");
+        CHECK(plan.sentence_terms.empty());
+    }
+
+    SECTION("Words left to the sentence") {
+        const auto single = Util::planPauliExpectation({"X"}, {{0}});
+        CHECK(single.groups.empty());
+        CHECK(single.sentence_terms == std::vector<std::size_t>{0});
+
+        // Both words flip wire 0: removing either one saves no gather.
+        const auto shared =
+            Util::planPauliExpectation({"X", "Y"}, {{0}, {0}});
+        CHECK(shared.groups.empty());
+        CHECK(shared.sentence_terms == std::vector<std::size_t>{0, 1});
+    }
+}
+
+TEMPLATE_TEST_CASE("groupExpectationValues", "[PauliGrouping]", float,
+                   double) {
+    const std::size_t num_qubits = 4;
+    std::mt19937 re{1337};
+    const auto state = getRandomState<TestType>(re, num_qubits);
+
+    const std::vector<std::string> words{"XYZ", "X", "YZ", "Z", "XIZ"};
+    const std::vector<std::vector<std::size_t>> wires{
+        {3, 0, 1}, {3}, {0, 1}, {1}, {3, 2, 1}};
+    const auto groups = Util::groupQubitWiseCommuting(words, wires);
+    REQUIRE(groups.size() == 1);
+
+    DenseState<TestType> rotated{state, num_qubits};
+    Util::rotateToGroupBasis(rotated, groups[0]);
+    std::vector<double> expect(words.size());
+    Util::groupExpectationValues(rotated.probability(groups[0].wires),
+                                 groups[0], expect);
+
+    for (std::size_t t = 0; t < words.size(); t++) {
+        CHECK(expect[t] ==
+              Approx(DenseState<TestType>{state, num_qubits}
+                         .expectationValuePauli(words[t], wires[t]))
+                  .margin(1e-5));
+    }
+}
@@ -0,0 +1,202 @@
+#include <bit>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "PauliSentence.hpp"
+
+using namespace Pennylane::CUDA;
+
+/// @cond DEV
+namespace {
+/**
+ * @brief Apply a single-qubit matrix to a state vector, where wire `w` is bit
+ * `num_qubits - 1 - w` of the basis-state index.
+ */
+template <class PrecisionT>
+void applySingleQubitMatrix(std::vector<std::complex<PrecisionT>> &state,
+                            std::size_t num_qubits,
+                            const std::vector<std::complex<PrecisionT>> &matrix,
+                            std::size_t wire) {
+    const std::size_t bit = std::size_t{1} << (num_qubits - 1 - wire);
+    for (std::size_t i = 0; i < state.size(); i++) {
+        if ((i & bit) == 0) {
+            const auto v0 = state[i];
+            const auto v1 = state[i | bit];
+            state[i] = matrix[0] * v0 + matrix[1] * v1;
+            state[i | bit] = matrix[2] * v0 + matrix[3] * v1;
+        }
+    }
+}
+
+/**
+ * @brief Apply each Pauli word as dense single-qubit matrices and sum the
+ * scaled results.
+ */
+template <class PrecisionT>
+auto applyTermByTerm(const std::vector<std::complex<PrecisionT>> &state,
+                     const std::vector<PrecisionT> &coeffs,
+                     const std::vector<std::string> &words,
+                     const std::vector<std::vector<std::size_t>> &wires)
+    -> std::vector<std::complex<PrecisionT>> {
+    using ComplexT = std::complex<PrecisionT>;
+    const std::vector<ComplexT> x{0, 1, 1, 0};
+    const std::vector<ComplexT> y{0, {0, -1}, {0, 1}, 0};
+    const std::vector<ComplexT> z{1, 0, 0, -1};
+    const std::size_t num_qubits = std::bit_width(state.size()) - 1;
+
+    std::vector<ComplexT> result(state.size());
+    for (std::size_t t = 0; t < words.size(); t++) {
+        auto term = state;
+        for (std::size_t k = 0; k < words[t].size(); k++) {
+            switch (words[t][k]) {
+            case 'X':
+                applySingleQubitMatrix(term, num_qubits, x, wires[t][k]);
+                break;
+            case 'Y':
+                applySingleQubitMatrix(term, num_qubits, y, wires[t][k]);
+                break;
+            case 'Z':
+                applySingleQubitMatrix(term, num_qubits, z, wires[t][k]);
+                break;
+            default:
+                break;
+            }
+        }
+        for (std::size_t i = 0; i < result.size(); i++) {
+            result[i] += coeffs[t] * term[i];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Apply a compiled Pauli sentence by the formula of its bit masks.
+ */
+template <class PrecisionT>
+auto applySentence(const std::complex<PrecisionT> *state,
+                   std::size_t num_qubits,
+                   const Util::PauliSentence<PrecisionT> &sentence)
+    -> std::vector<std::complex<PrecisionT>> {
+    std::vector<std::complex<PrecisionT>> result(std::size_t{1}
+                                                 << num_qubits);
+    for (std::size_t i = 0; i < result.size(); i++) {
+        for (std::size_t g = 0; g < sentence.getNumGroups(); g++) {
+            std::complex<PrecisionT> phase{0, 0};
+            for (std::size_t t = sentence.group_offsets[g];
+                 t < sentence.group_offsets[g + 1]; t++) {
+                const bool odd = std::popcount(i & sentence.z_masks[t]) & 1U;
+                phase += odd ? -sentence.coeffs[t] : sentence.coeffs[t];
+            }
+            result[i] += phase * state[i ^ sentence.x_masks[g]];
+        }
+    }
+    return result;
+}
+} // namespace
+/// @endcond
+
+TEMPLATE_TEST_CASE("compilePauliSentence", "[PauliSentence]", float,
+                   double) {
+    const std::size_t num_qubits = 3;
+    SECTION("Terms are grouped by X mask") {
+        const auto sentence = Util::compilePauliSentence<TestType>(
+            {0.5, 0.25, -1.0, 2.0}, {"XZ", "ZZ", "YI", "Z"},
+            {{0, 1}, {1, 2}, {0, 2}, {0}}, num_qubits);
+        REQUIRE(sentence.getNumGroups() == 2);
+        REQUIRE(sentence.getNumTerms() == 4);
+        CHECK(sentence.x_masks == std::vector<std::uint64_t>{0b000, 0b100});
+        CHECK(sentence.group_offsets == std::vector<std::size_t>{0, 2, 4});
+        // Diagonal terms, in input order.
+        CHECK(sentence.z_masks[0] == 0b011);
+        CHECK(sentence.z_masks[1] == 0b100);
+        // X on wire 0 and Y on wire 0.
+        CHECK(sentence.z_masks[2] == 0b010);
+        CHECK(sentence.z_masks[3] == 0b100);
+        CHECK(sentence.coeffs[3] == std::complex<TestType>{0, 1});
+    }
+    SECTION("Invalid words") {
+        REQUIRE_THROWS_WITH(Util::compilePauliSentence<TestType>(
+                                {1.0}, {"A"}, {{0}}, num_qubits),
+                            Catch::Contains("Invalid Pauli operator"));
+        REQUIRE_THROWS_WITH(Util::compilePauliSentence<TestType>(
+                                {1.0}, {"XX"}, {{0}}, num_qubits),
+                            Catch::Contains("one wire per operator"));
+        REQUIRE_THROWS_WITH(Util::compilePauliSentence<TestType>(
+                                {1.0}, {"X"}, {{3}}, num_qubits),
+                            Catch::Contains("Invalid wire index"));
+    }
+}
+
+TEMPLATE_TEST_CASE("compilePauliSentence matches the words",
+                   "[PauliSentence]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    const std::size_t num_qubits = 4;
+    std::mt19937 re{1337};
+    std::normal_distribution<TestType> dist;
+    std::vector<ComplexT> state(std::size_t{1} << num_qubits);
+    for (auto &amp : state) {
+        amp = {dist(re), dist(re)};
+    }
+
+    const std::vector<TestType> coeffs{0.3, -1.2, 0.7, 0.45, 2.0, -0.1};
+    const std::vector<std::string> words{"XX", "YY", "ZZ", "XYZ", "I", "YZ"};
+    const std::vector<std::vector<std::size_t>> wires{
+        {0, 1}, {0, 1}, {2, 3}, {3, 1, 0}, {2}, {3, 0}};
+    const auto expected = applyTermByTerm(state, coeffs, words, wires);
+
+    const auto result = applySentence(
+        state.data(), num_qubits,
+        Util::compilePauliSentence(coeffs, words, wires, num_qubits));
+    for (std::size_t i = 0; i < result.size(); i++) {
+        CHECK(result[i].real() == Approx(expected[i].real()).margin(1e-5));
+        CHECK(result[i].imag() == Approx(expected[i].imag()).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("splitPauliSentence", "[PauliSentence]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    const std::size_t num_qubits = 5;
+    const std::size_t num_local_qubits = 3;
+    const std::size_t block_length = std::size_t{1} << num_local_qubits;
+    std::mt19937 re{1337};
+    std::normal_distribution<TestType> dist;
+    std::vector<ComplexT> state(std::size_t{1} << num_qubits);
+    for (auto &amp : state) {
+        amp = {dist(re), dist(re)};
+    }
+
+    const auto sentence = Util::compilePauliSentence<TestType>(
+        {0.3, -1.2, 0.7, 0.45, 2.0, -0.1, 0.6},
+        {"XX", "YY", "ZZ", "XYZ", "I", "YZ", "ZXY"},
+        {{0, 1}, {0, 4}, {1, 3}, {3, 1, 0}, {2}, {3, 0}, {1, 2, 4}},
+        num_qubits);
+    const auto expected = applySentence(state.data(), num_qubits, sentence);
+
+    const std::size_t num_blocks = state.size() / block_length;
+    for (std::size_t b = 0; b < num_blocks; b++) {
+        const auto parts =
+            Util::splitPauliSentence(sentence, num_local_qubits, b);
+        REQUIRE(parts.size() == 4);
+        std::vector<ComplexT> rows(block_length);
+        for (const auto &part : parts) {
+            const std::size_t source = b ^ part.global_x_mask;
+            const auto contribution =
+                applySentence(state.data() + source * block_length,
+                              num_local_qubits, part.local);
+            for (std::size_t i = 0; i < block_length; i++) {
+                rows[i] += contribution[i];
+            }
+        }
+        for (std::size_t i = 0; i < block_length; i++) {
+            const auto &ref = expected[b * block_length + i];
+            CHECK(rows[i].real() == Approx(ref.real()).margin(1e-5));
+            CHECK(rows[i].imag() == Approx(ref.imag()).margin(1e-5));
+        }
+    }
+}
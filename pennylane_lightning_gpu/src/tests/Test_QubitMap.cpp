@@ -0,0 +1,94 @@
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "QubitMap.hpp"
+
+using namespace Pennylane::CUDA;
+
+/// @cond DEV
+namespace {
+/**
+ * @brief Physical index of each logical basis state under a map.
+ */
+auto permuteIndices(const Util::QubitMap &map) -> std::vector<std::size_t> {
+    const std::size_t num_qubits = map.getNumQubits();
+    std::vector<std::size_t> physical(std::size_t{1} << num_qubits);
+    for (std::size_t i = 0; i < physical.size(); i++) {
+        for (std::size_t b = 0; b < num_qubits; b++) {
+            physical[i] |= ((i >> b) & 1U) << map.getPhysicalBit(b);
+        }
+    }
+    return physical;
+}
+} // namespace
+/// @endcond
+
+TEST_CASE("QubitMap", "[QubitMap]") {
+    SECTION("Identity") {
+        const Util::QubitMap map{3};
+        CHECK(map.isIdentity());
+        CHECK(map.getRestoringSwaps().empty());
+        CHECK(map.getPhysicalBit(2) == 2);
+        CHECK(map.getLogicalBit(1) == 1);
+    }
+
+    SECTION("Logical swaps") {
+        Util::QubitMap map{4};
+        map.swapLogical(0, 2);
+        map.swapLogical(2, 3);
+        CHECK_FALSE(map.isIdentity());
+        CHECK(map.getPhysicalBit(0) == 2);
+        CHECK(map.getPhysicalBit(2) == 3);
+        CHECK(map.getPhysicalBit(3) == 0);
+        for (std::size_t b = 0; b < 4; b++) {
+            CHECK(map.getLogicalBit(map.getPhysicalBit(b)) == b);
+        }
+        map.swapLogical(2, 3);
+        map.swapLogical(2, 0);
+        CHECK(map.isIdentity());
+        CHECK_THROWS(map.swapLogical(0, 4));
+    }
+
+    SECTION("Physical swaps") {
+        Util::QubitMap map{3};
+        map.swapPhysical(0, 2);
+        CHECK(map.getLogicalBit(0) == 2);
+        CHECK(map.getPhysicalBit(2) == 0);
+        map.swapLogical(2, 0);
+        CHECK(map.isIdentity());
+        CHECK_THROWS(map.swapPhysical(3, 0));
+    }
+
+    SECTION("Restoring swaps") {
+        Util::QubitMap map{5};
+        const std::vector<std::pair<std::size_t, std::size_t>> swaps{
+            {0, 3}, {1, 4}, {3, 1}, {2, 4}, {0, 2}};
+        for (const auto &[a, b] : swaps) {
+            map.swapLogical(a, b);
+        }
+        const auto permuted = permuteIndices(map);
+
+        const auto restoring = map.getRestoringSwaps();
+        CHECK(restoring.size() < map.getNumQubits());
+        Util::QubitMap restored{map};
+        for (const auto &[a, b] : restoring) {
+            restored.swapPhysical(a, b);
+        }
+        CHECK(restored.isIdentity());
+        // Moving the amplitudes with the same swaps restores the order.
+        for (std::size_t i = 0; i < permuted.size(); i++) {
+            std::size_t index = permuted[i];
+            for (const auto &[a, b] : restoring) {
+                const std::size_t diff = ((index >> a) ^ (index >> b)) & 1U;
+                index ^= (diff << a) | (diff << b);
+            }
+            CHECK(index == i);
+        }
+
+        map.reset();
+        CHECK(map.isIdentity());
+    }
+}
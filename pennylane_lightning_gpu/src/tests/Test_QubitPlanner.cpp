@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "QubitMap.hpp"
+#include "QubitPlanner.hpp"
+
+using namespace Pennylane::CUDA;
+
+/// @cond DEV
+namespace {
+/**
+ * @brief Apply a plan to a map and check that the bits of every gate are
+ * local when the gate is applied.
+ */
+auto allGatesLocal(std::size_t num_local, Util::QubitMap map,
+                   const std::vector<std::vector<std::size_t>> &gate_bits,
+                   const std::vector<Util::IndexBitSwaps> &plan) -> bool {
+    for (std::size_t gate = 0; gate < gate_bits.size(); gate++) {
+        for (const auto &[local, global] : plan[gate]) {
+            if (local >= num_local || global < num_local) {
+                return false;
+            }
+            map.swapPhysical(local, global);
+        }
+        for (const auto bit : gate_bits[gate]) {
+            if (map.getPhysicalBit(bit) >= num_local) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Swaps of a greedy planner that keeps the swapped-in bits local and
+ * evicts the highest local bit outside the gate.
+ */
+auto countGreedySwaps(std::size_t num_local, Util::QubitMap map,
+                      const std::vector<std::vector<std::size_t>> &gate_bits)
+    -> std::size_t {
+    std::size_t count = 0;
+    for (const auto &bits : gate_bits) {
+        for (const auto bit : bits) {
+            if (map.getPhysicalBit(bit) < num_local) {
+                continue;
+            }
+            std::size_t victim = num_local;
+            while (victim-- > 0) {
+                const auto logical = map.getLogicalBit(victim);
+                if (std::find(bits.begin(), bits.end(), logical) ==
+                    bits.end()) {
+                    break;
+                }
+            }
+            map.swapPhysical(victim, map.getPhysicalBit(bit));
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Swaps of swapping global bits in and back out around every gate.
+ */
+auto countDispatcherSwaps(
+    std::size_t num_local,
+    const std::vector<std::vector<std::size_t>> &gate_bits) -> std::size_t {
+    std::size_t count = 0;
+    for (const auto &bits : gate_bits) {
+        count += 2 * std::count_if(bits.begin(), bits.end(),
+                                   [&](auto bit) { return bit >= num_local; });
+    }
+    return count;
+}
+} // namespace
+/// @endcond
+
+TEST_CASE("planLocalQubits", "[QubitPlanner]") {
+    SECTION("Local gates need no swap") {
+        const std::vector<std::vector<std::size_t>> gates{{0}, {1, 2}, {3}};
+        const auto plan = Util::planLocalQubits(4, Util::QubitMap{6}, gates);
+        REQUIRE(plan.size() == 3);
+        CHECK(Util::countIndexBitSwaps(plan) == 0);
+    }
+
+    SECTION("Swapped-in bits stay local") {
+        const std::vector<std::vector<std::size_t>> gates{
+            {5}, {5, 0}, {5}, {4, 5}};
+        const Util::QubitMap map{6};
+        const auto plan = Util::planLocalQubits(4, map, gates);
+        CHECK(allGatesLocal(4, map, gates, plan));
+        CHECK(Util::countIndexBitSwaps(plan) == 2);
+        CHECK(countDispatcherSwaps(4, gates) == 10);
+    }
+
+    SECTION("Evicts the bit used last") {
+        // Bit 3 is the highest local bit, but is used again before bit 2.
+        const std::vector<std::vector<std::size_t>> gates{
+            {5}, {3, 4}, {0, 1}, {2}};
+        const Util::QubitMap map{6};
+        const auto plan = Util::planLocalQubits(4, map, gates);
+        CHECK(allGatesLocal(4, map, gates, plan));
+        REQUIRE(plan[0].size() == 1);
+        CHECK(plan[0][0].first == 2);
+        CHECK(plan[0][0].second == 5);
+        CHECK(Util::countIndexBitSwaps(plan) == 3);
+        CHECK(countGreedySwaps(4, map, gates) == 4);
+    }
+
+    SECTION("Starts from a permuted map") {
+        Util::QubitMap map{5};
+        map.swapPhysical(0, 4);
+        const std::vector<std::vector<std::size_t>> gates{{0, 1}, {4}};
+        const auto plan = Util::planLocalQubits(3, map, gates);
+        CHECK(allGatesLocal(3, map, gates, plan));
+        CHECK(plan[0].size() == 1);
+        CHECK(plan[1].empty());
+    }
+
+    SECTION("Never costs more than greedy") {
+        // A ring of two-qubit gates over 8 qubits with 5 local ones,
+        // followed by single-qubit gates on every qubit.
+        std::vector<std::vector<std::size_t>> gates;
+        for (std::size_t layer = 0; layer < 3; layer++) {
+            for (std::size_t q = 0; q < 8; q++) {
+                gates.push_back({q, (q + 1) % 8});
+            }
+            for (std::size_t q = 0; q < 8; q++) {
+                gates.push_back({(q * 3) % 8});
+            }
+        }
+        const Util::QubitMap map{8};
+        const auto plan = Util::planLocalQubits(5, map, gates);
+        CHECK(allGatesLocal(5, map, gates, plan));
+        const auto planned = Util::countIndexBitSwaps(plan);
+        CHECK(planned <= countGreedySwaps(5, map, gates));
+        CHECK(planned < countDispatcherSwaps(5, gates));
+
+        const auto windowed = Util::planLocalQubits(5, map, gates, 4);
+        CHECK(allGatesLocal(5, map, gates, windowed));
+        CHECK(Util::countIndexBitSwaps(windowed) >= planned);
+    }
+
+    SECTION("Invalid gates") {
+        const Util::QubitMap map{4};
+        CHECK_THROWS_WITH(
+            Util::planLocalQubits(2, map, {{0, 1, 2}}),
+            Catch::Contains("There is not enough local wires"));
+        CHECK_THROWS_WITH(Util::planLocalQubits(2, map, {{4}}),
+                          Catch::Contains("Invalid index bit"));
+        CHECK_THROWS_WITH(Util::planLocalQubits(2, map, {{3, 3}}),
+                          Catch::Contains("Wires must be unique"));
+    }
+}
@@ -0,0 +1,46 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "SampleUtils.hpp"
+
+using namespace Pennylane::CUDA::Util;
+
+TEST_CASE("unpackBitStrings", "[SampleUtils]") {
+    const std::vector<std::uint64_t> bit_strings{0b000, 0b101, 0b011, 0b110};
+    const auto samples = unpackBitStrings(bit_strings, 3);
+    const std::vector<std::size_t> expected{0, 0, 0, 1, 0, 1,
+                                            0, 1, 1, 1, 1, 0};
+    CHECK(samples == expected);
+    CHECK(unpackBitStrings(std::vector<std::uint64_t>{}, 3).empty());
+}
+
+TEST_CASE("countBitStrings", "[SampleUtils]") {
+    SECTION("Empty input") {
+        CHECK(countBitStrings(std::vector<std::uint64_t>{}).empty());
+    }
+    SECTION("Unsorted input") {
+        const std::vector<std::uint64_t> bit_strings{3, 1, 3, 0, 3, 1};
+        const SampleCounts expected{{0, 1}, {1, 2}, {3, 3}};
+        CHECK(countBitStrings(bit_strings) == expected);
+    }
+    SECTION("Runs spanning many chunks") {
+        std::mt19937 re{1337};
+        std::uniform_int_distribution<std::uint64_t> dist(0, 7);
+        std::vector<std::uint64_t> bit_strings(100000);
+        std::vector<std::size_t> expected(8, 0);
+        for (auto &bits : bit_strings) {
+            bits = dist(re);
+            expected[bits]++;
+        }
+        const auto counts = countBitStrings(bit_strings);
+        REQUIRE(counts.size() == 8);
+        for (std::size_t i = 0; i < counts.size(); i++) {
+            CHECK(counts[i].first == i);
+            CHECK(counts[i].second == expected[i]);
+        }
+    }
+}
@@ -429,7 +429,9 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::applySWAP",
 
             svdat01.cuda_sv.applySWAP({0, 1}, false);
             svdat10.cuda_sv.applySWAP({1, 0}, false);
+            svdat01.cuda_sv.applyQubitMap();
             svdat01.cuda_sv.CopyGpuDataToHost(svdat01.sv);
+            svdat10.cuda_sv.applyQubitMap();
             svdat10.cuda_sv.CopyGpuDataToHost(svdat10.sv);
 
             CHECK(svdat01.sv.getDataVector() == Pennylane::approx(expected));
@@ -452,7 +454,9 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::applySWAP",
             svdat02.cuda_sv.applySWAP({0, 2}, false);
             svdat20.cuda_sv.applySWAP({2, 0}, false);
 
+            svdat02.cuda_sv.applyQubitMap();
             svdat02.cuda_sv.CopyGpuDataToHost(svdat02.sv);
+            svdat20.cuda_sv.applyQubitMap();
             svdat20.cuda_sv.CopyGpuDataToHost(svdat20.sv);
 
             CHECK(svdat02.sv.getDataVector() == Pennylane::approx(expected));
@@ -474,7 +478,9 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::applySWAP",
             svdat12.cuda_sv.applySWAP({1, 2}, false);
             svdat21.cuda_sv.applySWAP({2, 1}, false);
 
+            svdat12.cuda_sv.applyQubitMap();
             svdat12.cuda_sv.CopyGpuDataToHost(svdat12.sv);
+            svdat21.cuda_sv.applyQubitMap();
             svdat21.cuda_sv.CopyGpuDataToHost(svdat21.sv);
             ;
 
@@ -499,7 +505,9 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::applySWAP",
             svdat01.cuda_sv.applyOperation("SWAP", {0, 1});
             svdat10.cuda_sv.applyOperation("SWAP", {1, 0});
 
+            svdat01.cuda_sv.applyQubitMap();
             svdat01.cuda_sv.CopyGpuDataToHost(svdat01.sv);
+            svdat10.cuda_sv.applyQubitMap();
             svdat10.cuda_sv.CopyGpuDataToHost(svdat10.sv);
             ;
 
@@ -523,7 +531,9 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::applySWAP",
             svdat02.cuda_sv.applyOperation("SWAP", {0, 2});
             svdat20.cuda_sv.applyOperation("SWAP", {2, 0});
 
+            svdat02.cuda_sv.applyQubitMap();
             svdat02.cuda_sv.CopyGpuDataToHost(svdat02.sv);
+            svdat20.cuda_sv.applyQubitMap();
             svdat20.cuda_sv.CopyGpuDataToHost(svdat20.sv);
 
             CHECK(svdat02.sv.getDataVector() == Pennylane::approx(expected));
@@ -545,7 +555,9 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::applySWAP",
             svdat12.cuda_sv.applyOperation("SWAP", {1, 2});
             svdat21.cuda_sv.applyOperation("SWAP", {2, 1});
 
+            svdat12.cuda_sv.applyQubitMap();
             svdat12.cuda_sv.CopyGpuDataToHost(svdat12.sv);
+            svdat21.cuda_sv.applyQubitMap();
             svdat21.cuda_sv.CopyGpuDataToHost(svdat21.sv);
 
             CHECK(svdat12.sv.getDataVector() == Pennylane::approx(expected));
@@ -929,6 +941,78 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::Hamiltonian_expval_cuSparse",
 
         CHECK(expected == Approx(results).epsilon(1e-7));
     }
+
+    SECTION("GetExpectionPauliSentence") {
+        std::vector<cp_t> init_state{{0.0, 0.0}, {0.0, 0.1}, {0.1, 0.1},
+                                     {0.1, 0.2}, {0.2, 0.2}, {0.3, 0.3},
+                                     {0.3, 0.4}, {0.4, 0.5}};
+        SVDataGPU<TestType> svdat{num_qubits};
+        svdat.cuda_sv.CopyHostDataToGpu(init_state.data(), init_state.size());
+
+        // Pauli decomposition of the CSR matrix above: I + X_1 Y_2.
+        const auto sentence = CUDA::Util::compilePauliSentence<TestType>(
+            {1.0, 1.0}, {"I", "XY"}, {{0}, {1, 2}}, num_qubits);
+        auto results = svdat.cuda_sv.getExpectationValuePauliSentence(sentence);
+
+        TestType expected = 1;
+
+        CHECK(expected == Approx(results).epsilon(1e-6));
+    }
+
+    SECTION("GetExpectionPauliWordsGrouped") {
+        std::vector<cp_t> init_state{{0.0, 0.0}, {0.0, 0.1}, {0.1, 0.1},
+                                     {0.1, 0.2}, {0.2, 0.2}, {0.3, 0.3},
+                                     {0.3, 0.4}, {0.4, 0.5}};
+        SVDataGPU<TestType> svdat{num_qubits};
+        svdat.cuda_sv.CopyHostDataToGpu(init_state.data(), init_state.size());
+
+        // Every group saves fewer sentence passes than it costs, so all
+        // words are evaluated as one Pauli sentence.
+        const std::vector<std::string> words{"XX", "X",  "X", "XX",
+                                             "XZ", "ZZ", "Z", "Y"};
+        const std::vector<std::vector<size_t>> wires{
+            {0, 1}, {0}, {1}, {1, 0}, {0, 2}, {0, 1}, {0}, {1}};
+        const std::vector<cp_t> coeffs{0.1, 0.2, 0.3, 0.4,
+                                       0.5, 0.6, 0.7, 0.8};
+        auto results = svdat.cuda_sv.getExpectationValuePauliWords(
+            words, wires, coeffs.data());
+
+        TestType expected = 0.114;
+
+        CHECK(expected == Approx(results).epsilon(1e-5));
+    }
+
+    SECTION("GetExpectionPauliWordsPlanned") {
+        std::vector<cp_t> init_state{{0.0, 0.0}, {0.0, 0.1}, {0.1, 0.1},
+                                     {0.1, 0.2}, {0.2, 0.2}, {0.3, 0.3},
+                                     {0.3, 0.4}, {0.4, 0.5}};
+        SVDataGPU<TestType> svdat{num_qubits};
+        svdat.cuda_sv.CopyHostDataToGpu(init_state.data(), init_state.size());
+
+        // The X words form a rotated group, the others one Pauli sentence.
+        const std::vector<std::string> words{
+            "X", "X", "X", "XX", "XX", "XX", "XXX", "ZZ", "Z", "Y"};
+        const std::vector<std::vector<size_t>> wires{
+            {0},    {1},    {2}, {0, 1}, {1, 2},
+            {0, 2}, {0, 1, 2}, {0, 1}, {2}, {1}};
+        std::vector<cp_t> coeffs;
+        for (size_t t = 0; t < words.size(); t++) {
+            coeffs.emplace_back(0.1 * static_cast<TestType>(t + 1), 0.0);
+        }
+        const auto plan = CUDA::Util::planPauliExpectation(words, wires);
+        REQUIRE(plan.groups.size() == 1);
+        CHECK(plan.sentence_terms == std::vector<size_t>{7, 8, 9});
+
+        TestType expected = 0;
+        for (size_t t = 0; t < words.size(); t++) {
+            expected += svdat.cuda_sv.getExpectationValuePauliWords(
+                {words[t]}, {wires[t]}, &coeffs[t]);
+        }
+        auto results = svdat.cuda_sv.getExpectationValuePauliWords(
+            words, wires, coeffs.data());
+
+        CHECK(expected == Approx(results).margin(1e-5));
+    }
 }
 
 TEMPLATE_TEST_CASE("StateVectorCudaManaged::SetStateVector",
@@ -1043,3 +1127,360 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::SetIthStates",
         CHECK(expected_state == Pennylane::approx(svdat.sv.getDataVector()));
     }
 }
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::WorkspaceArena",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using PrecisionT = TestType;
+    const std::size_t num_qubits = 4;
+    std::mt19937 re{1337};
+
+    for (const bool stream_ordered : {false, true}) {
+        DYNAMIC_SECTION("Stream-ordered allocations: " << stream_ordered) {
+            auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+            SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+            svdat.cuda_sv.setWorkspacePooling(stream_ordered);
+
+            const std::vector<std::complex<PrecisionT>> matrix(
+                std::size_t{1} << (2 * 3), {0.125, 0});
+            auto run_circuit = [&]() {
+                for (std::size_t i = 0; i < 10; i++) {
+                    svdat.cuda_sv.applyOperation("Toffoli", {0, 1, 3}, false);
+                    svdat.cuda_sv.applyOperation("Hadamard",
+                                                 {i % num_qubits}, false);
+                }
+                svdat.cuda_sv.expval({0, 1, 3}, matrix);
+                svdat.cuda_sv.generate_samples(16);
+            };
+
+            const auto &workspace = svdat.cuda_sv.getWorkspace();
+            run_circuit();
+            const auto num_allocations = workspace.getNumAllocations();
+            CHECK(workspace.getCapacity() >= workspace.getHighWaterMark());
+
+            // Once grown to its peak size, the arena is never reallocated.
+            run_circuit();
+            CHECK(workspace.getNumAllocations() == num_allocations);
+
+            svdat.cuda_sv.releaseWorkspace();
+            CHECK(workspace.getCapacity() == 0);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::QubitMap",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using PrecisionT = TestType;
+    const std::size_t num_qubits = 4;
+    std::mt19937 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // The reference applies SWAP(a, b) as three CNOT gates.
+    SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+    SVDataGPU<PrecisionT> svdat_ref{num_qubits, init_state};
+    const auto apply_both = [&](const std::string &name,
+                                const std::vector<std::size_t> &wires) {
+        if (name == "SWAP") {
+            svdat.cuda_sv.applyOperation("SWAP", wires, false);
+            svdat_ref.cuda_sv.applyOperation("CNOT", {wires[0], wires[1]});
+            svdat_ref.cuda_sv.applyOperation("CNOT", {wires[1], wires[0]});
+            svdat_ref.cuda_sv.applyOperation("CNOT", {wires[0], wires[1]});
+        } else {
+            svdat.cuda_sv.applyOperation(name, wires, false, {0.3});
+            svdat_ref.cuda_sv.applyOperation(name, wires, false, {0.3});
+        }
+    };
+
+    SECTION("SWAP only relabels the qubits") {
+        apply_both("SWAP", {0, 2});
+        apply_both("SWAP", {2, 3});
+        CHECK_FALSE(svdat.cuda_sv.getQubitMap().isIdentity());
+        apply_both("SWAP", {3, 2});
+        apply_both("SWAP", {2, 0});
+        CHECK(svdat.cuda_sv.getQubitMap().isIdentity());
+    }
+
+    SECTION("Gates, probabilities and readout after SWAP") {
+        apply_both("SWAP", {0, 3});
+        apply_both("RX", {0});
+        apply_both("CNOT", {3, 1});
+        apply_both("SWAP", {1, 2});
+        apply_both("Toffoli", {0, 2, 3});
+        apply_both("CSWAP", {1, 0, 3});
+        apply_both("SWAP", {3, 1});
+        apply_both("CRY", {2, 0});
+        REQUIRE_FALSE(svdat.cuda_sv.getQubitMap().isIdentity());
+
+        const std::vector<std::complex<PrecisionT>> z{{1, 0}, {0, 0}, {0, 0},
+                                                      {-1, 0}};
+        CHECK(svdat.cuda_sv.expval({3}, z).x ==
+              Approx(svdat_ref.cuda_sv.expval({3}, z).x).margin(1e-5));
+        CHECK(svdat.cuda_sv.probability({2, 0}) ==
+              Pennylane::approx(svdat_ref.cuda_sv.probability({2, 0})));
+        CHECK(svdat.cuda_sv.getQubitMap().isIdentity());
+
+        apply_both("SWAP", {0, 1});
+        CHECK_THROWS(svdat.cuda_sv.CopyGpuDataToHost(svdat.sv));
+        CHECK_THROWS(svdat.cuda_sv.getData());
+        svdat.cuda_sv.applyQubitMap();
+        CHECK(svdat.cuda_sv.getQubitMap().isIdentity());
+        svdat_ref.cuda_sv.applyQubitMap();
+        svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+        svdat_ref.cuda_sv.CopyGpuDataToHost(svdat_ref.sv);
+        CHECK(svdat.sv.getDataVector() ==
+              Pennylane::approx(svdat_ref.sv.getDataVector()));
+    }
+
+    SECTION("Overwriting the data resets the map") {
+        apply_both("SWAP", {1, 3});
+        svdat.cuda_sv.CopyHostDataToGpu(init_state.data(), init_state.size());
+        CHECK(svdat.cuda_sv.getQubitMap().isIdentity());
+        svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+        CHECK(svdat.sv.getDataVector() == Pennylane::approx(init_state));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::DiagonalBatching",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using PrecisionT = TestType;
+    const std::size_t num_qubits = 5;
+    std::mt19937 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // A QAOA-like cost layer, interrupted by a SWAP and a mixer gate.
+    const std::vector<std::string> ops{
+        "RZ",      "PhaseShift", "S",   "T",       "PauliZ",
+        "SWAP",    "CZ",         "CRZ", "IsingZZ", "ControlledPhaseShift",
+        "Hadamard", "MultiRZ",   "Identity", "IsingZZ", "RX"};
+    const std::vector<std::vector<std::size_t>> wires{
+        {0},    {1},    {2},    {3},       {4},    {0, 3}, {0, 3}, {4, 1},
+        {2, 0}, {3, 4}, {2},    {0, 2, 4}, {1},    {1, 3}, {1}};
+    const std::vector<bool> adjoints{false, true,  true,  false, false,
+                                     false, false, true,  false, true,
+                                     false, false, false, true,  false};
+    std::vector<std::vector<PrecisionT>> params;
+    for (std::size_t i = 0; i < ops.size(); i++) {
+        params.push_back({static_cast<PrecisionT>(0.1 + 0.2 * i)});
+    }
+
+    SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+    SVDataGPU<PrecisionT> svdat_ref{num_qubits, init_state};
+    svdat.cuda_sv.applyOperation(ops, wires, adjoints, params);
+    for (std::size_t i = 0; i < ops.size(); i++) {
+        svdat_ref.cuda_sv.applyOperation(ops[i], wires[i], adjoints[i],
+                                         params[i]);
+    }
+    svdat.cuda_sv.applyQubitMap();
+    svdat_ref.cuda_sv.applyQubitMap();
+    svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+    svdat_ref.cuda_sv.CopyGpuDataToHost(svdat_ref.sv);
+    CHECK(svdat.sv.getDataVector() ==
+          Pennylane::approx(svdat_ref.sv.getDataVector()));
+
+    SECTION("Explicit phase polynomial") {
+        cuUtil::DiagonalPhase<PrecisionT> phase;
+        phase.addGate("IsingZZ", {4, 3}, 0.7, false);
+        phase.addGate("PhaseShift", {0}, 0.2, true);
+        svdat.cuda_sv.applyDiagonalPhase(phase);
+        svdat_ref.cuda_sv.applyOperation("IsingZZ", {0, 1}, false, {0.7});
+        svdat_ref.cuda_sv.applyOperation("PhaseShift", {4}, true, {0.2});
+        svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+        svdat_ref.cuda_sv.CopyGpuDataToHost(svdat_ref.sv);
+        CHECK(svdat.sv.getDataVector() ==
+              Pennylane::approx(svdat_ref.sv.getDataVector()));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::conditional probability",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using PrecisionT = TestType;
+    const std::size_t num_qubits = 4;
+    std::mt19937 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+
+    // Reference from the amplitudes, with wire 0 the most significant bit.
+    const auto conditional =
+        [&](const std::vector<std::complex<PrecisionT>> &state,
+            const std::vector<std::size_t> &wires,
+            const std::vector<std::size_t> &condition_wires,
+            const std::vector<std::size_t> &condition_bits) {
+            std::vector<double> probs(std::size_t{1} << wires.size(), 0.0);
+            double condition_probability = 0;
+            for (std::size_t i = 0; i < state.size(); i++) {
+                const auto bit = [&](std::size_t w) {
+                    return (i >> (num_qubits - 1 - w)) & 1U;
+                };
+                bool satisfied = true;
+                for (std::size_t k = 0; k < condition_wires.size(); k++) {
+                    satisfied &= bit(condition_wires[k]) == condition_bits[k];
+                }
+                if (!satisfied) {
+                    continue;
+                }
+                std::size_t outcome = 0;
+                for (std::size_t j = 0; j < wires.size(); j++) {
+                    outcome |= bit(wires[j]) << j;
+                }
+                probs[outcome] += std::norm(state[i]);
+                condition_probability += std::norm(state[i]);
+            }
+            for (auto &p : probs) {
+                p /= condition_probability;
+            }
+            return probs;
+        };
+
+    SECTION("Conditions on the device") {
+        CHECK(svdat.cuda_sv.probability({3, 0}, {1, 2}, {1, 0}) ==
+              Pennylane::approx(conditional(init_state, {3, 0}, {1, 2},
+                                            {1, 0})));
+        CHECK(svdat.cuda_sv.probability({1}, {3}, {1}) ==
+              Pennylane::approx(conditional(init_state, {1}, {3}, {1})));
+        CHECK(svdat.cuda_sv.probability({2, 0}, {}, {}) ==
+              Pennylane::approx(svdat.cuda_sv.probability({2, 0})));
+    }
+
+    SECTION("Conditions after a SWAP") {
+        svdat.cuda_sv.applyOperation("SWAP", {0, 2}, false);
+        svdat.cuda_sv.applyOperation("SWAP", {1, 3}, false);
+        svdat.cuda_sv.applyOperation("RX", {0}, false, {0.4});
+        SVDataGPU<PrecisionT> svdat_ref{num_qubits, init_state};
+        svdat_ref.cuda_sv.applyOperation("SWAP", {0, 2}, false);
+        svdat_ref.cuda_sv.applyOperation("SWAP", {1, 3}, false);
+        svdat_ref.cuda_sv.applyOperation("RX", {0}, false, {0.4});
+        svdat_ref.cuda_sv.applyQubitMap();
+        svdat_ref.cuda_sv.CopyGpuDataToHost(svdat_ref.sv);
+
+        CHECK(svdat.cuda_sv.probability({0, 3}, {2}, {0}) ==
+              Pennylane::approx(conditional(svdat_ref.sv.getDataVector(),
+                                            {0, 3}, {2}, {0})));
+    }
+
+    SECTION("Invalid conditions") {
+        CHECK_THROWS(svdat.cuda_sv.probability({0}, {0}, {1}));
+        CHECK_THROWS(svdat.cuda_sv.probability({0}, {1, 2}, {1}));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::mid-circuit measurement",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using PrecisionT = TestType;
+    const std::size_t num_qubits = 3;
+    std::mt19937 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // Reference from the amplitudes, with wire 0 the most significant bit.
+    const auto collapsed =
+        [&](std::vector<std::complex<PrecisionT>> state, std::size_t wire,
+            std::size_t outcome) {
+            PrecisionT norm = 0;
+            for (std::size_t i = 0; i < state.size(); i++) {
+                if (((i >> (num_qubits - 1 - wire)) & 1U) != outcome) {
+                    state[i] = 0;
+                }
+                norm += std::norm(state[i]);
+            }
+            for (auto &amp : state) {
+                amp /= std::sqrt(norm);
+            }
+            return state;
+        };
+
+    SECTION("Collapse") {
+        SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+        svdat.cuda_sv.collapse(1, 1);
+        svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+        CHECK(svdat.sv.getDataVector() ==
+              Pennylane::approx(collapsed(init_state, 1, 1)));
+        CHECK(svdat.cuda_sv.getMeasurementOutcomes().empty());
+    }
+
+    SECTION("Collapse as an operation after a SWAP") {
+        SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+        svdat.cuda_sv.applyOperation({"SWAP", "Collapse", "SWAP"},
+                                     {{0, 2}, {0}, {0, 2}},
+                                     {false, false, false}, {{}, {0.0}, {}});
+        svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+        CHECK(svdat.sv.getDataVector() ==
+              Pennylane::approx(collapsed(init_state, 2, 0)));
+    }
+
+    SECTION("Measure a Bell pair") {
+        SVDataGPU<PrecisionT> svdat{num_qubits};
+        svdat.cuda_sv.seedMeasurements(42);
+        svdat.cuda_sv.applyOperation({"Hadamard", "CNOT", "Measure"},
+                                     {{0}, {0, 1}, {0}},
+                                     {false, false, false});
+        const auto &outcomes = svdat.cuda_sv.getMeasurementOutcomes();
+        REQUIRE(outcomes.size() == 1);
+        const auto probs = svdat.cuda_sv.probability({1});
+        CHECK(probs[outcomes[0]] == Approx(1.0));
+        CHECK(svdat.cuda_sv.measure(1) == outcomes[0]);
+        CHECK(svdat.cuda_sv.getMeasurementOutcomes().size() == 2);
+    }
+
+    SECTION("Reset") {
+        SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+        svdat.cuda_sv.applyOperation("Reset", {2}, false);
+        CHECK(svdat.cuda_sv.probability({2})[0] == Approx(1.0));
+        svdat.cuda_sv.applyOperation("RX", {2}, false, {0.7});
+        svdat.cuda_sv.reset(2);
+        CHECK(svdat.cuda_sv.probability({2})[0] == Approx(1.0));
+        CHECK(svdat.cuda_sv.getMeasurementOutcomes().empty());
+    }
+
+    SECTION("Invalid measurements") {
+        SVDataGPU<PrecisionT> svdat{num_qubits};
+        CHECK_THROWS(svdat.cuda_sv.collapse(0, 1));
+        CHECK_THROWS(svdat.cuda_sv.collapse(3, 0));
+        CHECK_THROWS(svdat.cuda_sv.applyOperation("Measure", {0}, true));
+        CHECK_THROWS(svdat.cuda_sv.applyOperation("Reset", {0, 1}, false));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::op stream",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexT = std::complex<PrecisionT>;
+    const std::size_t num_qubits = 3;
+    std::mt19937 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // Hadamard, CZ, RZ, an ISWAP given as a matrix and an adjoint RX.
+    const auto &gate_names = cuUtil::getOpStreamGateNames();
+    const auto code = [&](const std::string &name) {
+        return static_cast<std::int64_t>(
+            std::find(gate_names.begin(), gate_names.end(), name) -
+            gate_names.begin());
+    };
+    std::vector<std::string> names = gate_names;
+    names.emplace_back("ISWAP");
+    const std::vector<std::int64_t> op_codes{
+        code("Hadamard"), code("CZ"), code("RZ"),
+        static_cast<std::int64_t>(gate_names.size()), code("RX")};
+    const std::vector<std::int64_t> wire_offsets{0, 1, 3, 4, 6, 7};
+    const std::vector<std::int64_t> wires{0, 0, 1, 1, 1, 2, 2};
+    const std::vector<std::int64_t> param_offsets{0, 0, 0, 1, 1, 2};
+    const std::vector<PrecisionT> params{0.4, 0.5};
+    const bool inverses[] = {false, false, false, false, true};
+    const std::vector<std::int64_t> matrix_offsets{0, 0, 0, 0, 16, 16};
+    const ComplexT i{0, 1};
+    const std::vector<ComplexT> iswap{1, 0, 0, 0, 0, 0, i, 0,
+                                      0, i, 0, 0, 0, 0, 0, 1};
+    const cuUtil::OpStream<PrecisionT> ops{
+        names,  op_codes, wire_offsets,   wires, param_offsets,
+        params, inverses, matrix_offsets, iswap};
+
+    SVDataGPU<PrecisionT> svdat{num_qubits, init_state};
+    SVDataGPU<PrecisionT> svdat_ref{num_qubits, init_state};
+    svdat.cuda_sv.applyOperation(ops);
+    svdat_ref.cuda_sv.applyOperation("Hadamard", {0}, false);
+    svdat_ref.cuda_sv.applyOperation("CZ", {0, 1}, false);
+    svdat_ref.cuda_sv.applyOperation("RZ", {1}, false, {0.4});
+    svdat_ref.cuda_sv.applyOperation_std("ISWAP", {1, 2}, false, {}, iswap);
+    svdat_ref.cuda_sv.applyOperation("RX", {2}, true, {0.5});
+    svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+    svdat_ref.cuda_sv.CopyGpuDataToHost(svdat_ref.sv);
+    CHECK(svdat.sv.getDataVector() ==
+          Pennylane::approx(svdat_ref.sv.getDataVector()));
+}
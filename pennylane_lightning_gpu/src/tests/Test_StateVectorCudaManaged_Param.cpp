@@ -3,6 +3,7 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <random>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -1282,6 +1283,47 @@ TEMPLATE_TEST_CASE("LightningGPU::applyOperation multiple wires",
     }
 }
 
+TEMPLATE_TEST_CASE("LightningGPU::applyOperation gate fusion",
+                   "[LightningGPU_Param]", float, double) {
+    const size_t num_qubits = 4;
+    std::mt19937 re{1337};
+    const auto init_state = createRandomState<TestType>(re, num_qubits);
+
+    const std::vector<std::string> ops{
+        "RX",      "RY",   "Hadamard", "CNOT", "Rot",     "IsingXX",
+        "PauliY",  "CRZ",  "T",        "SWAP", "MultiRZ", "PhaseShift",
+        "Toffoli", "CRot", "S",        "CZ",   "RZ"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {1}, {2}, {0, 2}, {3}, {1, 3}, {2}, {3, 0}, {1},
+        {2, 1}, {0, 1, 3}, {2}, {3, 1, 0}, {0, 2}, {3}, {1, 2}, {0}};
+    const std::vector<bool> adjoints{false, true,  false, false, true, false,
+                                     false, false, true,  false, true, false,
+                                     false, true,  false, false, false};
+    const std::vector<std::vector<TestType>> params{
+        {0.3}, {0.5}, {}, {}, {0.1, 0.2, 0.3}, {0.4}, {}, {0.7}, {},
+        {},    {0.9}, {-0.2}, {}, {0.6, -0.1, 0.8}, {}, {}, {1.1}};
+
+    SVDataGPU<TestType> svdat_expected{num_qubits, init_state};
+    svdat_expected.cuda_sv.applyOperation(ops, wires, adjoints, params);
+    svdat_expected.cuda_sv.applyQubitMap();
+    svdat_expected.cuda_sv.CopyGpuDataToHost(svdat_expected.sv);
+
+    for (size_t max_qubits = 1; max_qubits <= num_qubits; max_qubits++) {
+        DYNAMIC_SECTION("Fused blocks of at most " << max_qubits
+                                                   << " qubits") {
+            SVDataGPU<TestType> svdat{num_qubits, init_state};
+            svdat.cuda_sv.setGateFusion(max_qubits);
+            CHECK(svdat.cuda_sv.getGateFusion() == max_qubits);
+            svdat.cuda_sv.applyOperation(ops, wires, adjoints, params);
+            svdat.cuda_sv.applyQubitMap();
+            svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+            CHECK(svdat.sv.getDataVector() ==
+                  Pennylane::approx(svdat_expected.sv.getDataVector())
+                      .margin(1e-5));
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE("Sample", "[LightningGPU_Param]", float, double) {
     constexpr uint32_t twos[] = {
         1U << 0U,  1U << 1U,  1U << 2U,  1U << 3U,  1U << 4U,  1U << 5U,
@@ -1336,3 +1378,67 @@ TEMPLATE_TEST_CASE("Sample", "[LightningGPU_Param]", float, double) {
     REQUIRE_THAT(probabilities,
                  Catch::Approx(expected_probabilities).margin(.05));
 }
+
+TEMPLATE_TEST_CASE("Sample counts", "[LightningGPU_Param]", float, double) {
+    const size_t num_qubits = 3;
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    sv.applyOperation({"RX", "RY", "RX"}, {{0}, {1}, {2}},
+                      {false, false, false}, {{0.7}, {0.5}, {0.2}});
+    const auto expected_probabilities = sv.probability({2, 1, 0});
+
+    const size_t num_samples = 100000;
+    SECTION("Packed samples") {
+        const auto packed = sv.generate_samples_packed(num_samples);
+        REQUIRE(packed.size() == num_samples);
+        std::vector<TestType> probabilities(1U << num_qubits, 0);
+        for (const auto bits : packed) {
+            probabilities[bits] += 1 / static_cast<TestType>(num_samples);
+        }
+        for (size_t i = 0; i < probabilities.size(); i++) {
+            CHECK(probabilities[i] ==
+                  Approx(expected_probabilities[i]).margin(.05));
+        }
+    }
+    SECTION("Counts") {
+        const auto counts = sv.generate_counts(num_samples);
+        size_t total = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            if (i > 0) {
+                CHECK(counts[i - 1].first < counts[i].first);
+            }
+            total += counts[i].second;
+            CHECK(counts[i].second / static_cast<double>(num_samples) ==
+                  Approx(expected_probabilities[counts[i].first]).margin(.05));
+        }
+        CHECK(total == num_samples);
+    }
+}
+
+TEMPLATE_TEST_CASE("Sampler cache", "[LightningGPU_Param]", float, double) {
+    const size_t num_qubits = 3;
+    const size_t num_samples = 100;
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.applyOperation("PauliX", {0});
+    CHECK_FALSE(sv.hasValidSampler());
+
+    const auto counts = sv.generate_counts(num_samples);
+    REQUIRE(counts.size() == 1);
+    CHECK(counts[0].first == 0b100);
+    CHECK(sv.hasValidSampler());
+
+    // More shots than the cached sampler was created for.
+    CHECK(sv.generate_samples_packed(2 * num_samples).size() ==
+          2 * num_samples);
+    CHECK(sv.hasValidSampler());
+
+    sv.applyOperation("RY", {2}, false, {M_PI});
+    CHECK_FALSE(sv.hasValidSampler());
+    const auto packed = sv.generate_samples_packed(num_samples);
+    CHECK(packed.front() == 0b101);
+    CHECK(packed.back() == 0b101);
+
+    sv.initSV();
+    CHECK_FALSE(sv.hasValidSampler());
+    CHECK(sv.generate_samples_packed(num_samples).back() == 0);
+}
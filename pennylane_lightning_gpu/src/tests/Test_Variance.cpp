@@ -0,0 +1,44 @@
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "Variance.hpp"
+
+using namespace Pennylane::CUDA;
+
+TEMPLATE_TEST_CASE("getMatrixDiagonal", "[Variance]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    std::vector<TestType> diag;
+
+    CHECK(Util::getMatrixDiagonal<TestType>(
+        {ComplexT{1, 0}, 0, 0, ComplexT{-2, 0}}, diag));
+    CHECK(diag == std::vector<TestType>{1, -2});
+
+    CHECK_FALSE(Util::getMatrixDiagonal<TestType>(
+        {ComplexT{1, 0}, ComplexT{0, 1}, ComplexT{0, -1}, ComplexT{-2, 0}},
+        diag));
+    CHECK_THROWS(Util::getMatrixDiagonal<TestType>({1, 0, 0}, diag));
+}
+
+TEMPLATE_TEST_CASE("diagonalMoments", "[Variance]", float, double) {
+    // Bit j of the outcome is wires[j], while wires[0] is the most
+    // significant bit of the row of the diagonal.
+    const std::vector<double> probabilities{0.1, 0.2, 0.3, 0.4};
+    const std::vector<TestType> diag{1, 2, 3, 4};
+    const std::vector<double> row_values{1, 3, 2, 4};
+
+    double mean = 0;
+    double mean_sq = 0;
+    for (std::size_t outcome = 0; outcome < 4; outcome++) {
+        mean += probabilities[outcome] * row_values[outcome];
+        mean_sq += probabilities[outcome] * row_values[outcome] *
+                   row_values[outcome];
+    }
+    const auto moments = Util::diagonalMoments(probabilities, diag);
+    CHECK(moments.first == Approx(mean));
+    CHECK(moments.second == Approx(mean_sq));
+
+    CHECK_THROWS(Util::diagonalMoments<TestType>({1.0}, diag));
+}
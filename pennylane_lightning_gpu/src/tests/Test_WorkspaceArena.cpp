@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "WorkspaceArena.hpp"
+
+using namespace Pennylane::CUDA::Util;
+
+/// @cond DEV
+namespace {
+/**
+ * @brief Host allocator recording the size of every live allocation.
+ */
+class TrackingAllocator final : public WorkspaceAllocator {
+  private:
+    std::vector<std::size_t> &live_;
+    HostWorkspaceAllocator host_;
+
+  public:
+    explicit TrackingAllocator(std::vector<std::size_t> &live) : live_{live} {}
+
+    auto allocate(std::size_t bytes) -> void * override {
+        live_.push_back(bytes);
+        return host_.allocate(bytes);
+    }
+    void deallocate(void *ptr, std::size_t bytes) override {
+        REQUIRE(live_.size() == 1);
+        CHECK(live_.front() == bytes);
+        live_.clear();
+        host_.deallocate(ptr, bytes);
+    }
+};
+} // namespace
+/// @endcond
+
+TEST_CASE("WorkspaceArena::acquire", "[WorkspaceArena]") {
+    std::vector<std::size_t> live;
+    WorkspaceArena arena{std::make_unique<TrackingAllocator>(live)};
+
+    SECTION("Empty requests do not allocate") {
+        CHECK(arena.acquire(0) == nullptr);
+        CHECK(arena.getNumAllocations() == 0);
+        CHECK(arena.getCapacity() == 0);
+        CHECK(live.empty());
+    }
+    SECTION("Buffer is reused while requests fit") {
+        void *ptr = arena.acquire(100);
+        REQUIRE(ptr != nullptr);
+        CHECK(arena.getCapacity() == WorkspaceArena::alignment);
+        CHECK(arena.acquire(10) == ptr);
+        CHECK(arena.acquire(WorkspaceArena::alignment) == ptr);
+        CHECK(arena.acquire(0) == nullptr);
+        CHECK(arena.getNumAllocations() == 1);
+        CHECK(arena.getHighWaterMark() == WorkspaceArena::alignment);
+        CHECK(live.size() == 1);
+    }
+    SECTION("Arena grows and never shrinks") {
+        arena.acquire(100);
+        arena.acquire(1000);
+        CHECK(arena.getNumAllocations() == 2);
+        CHECK(arena.getCapacity() == 4 * WorkspaceArena::alignment);
+        CHECK(arena.getHighWaterMark() == 1000);
+        CHECK(live == std::vector<std::size_t>{4 * WorkspaceArena::alignment});
+
+        arena.acquire(300);
+        CHECK(arena.getNumAllocations() == 2);
+        CHECK(arena.getCapacity() == 4 * WorkspaceArena::alignment);
+        CHECK(arena.getHighWaterMark() == 1000);
+    }
+    SECTION("Release frees the buffer and keeps the statistics") {
+        arena.acquire(512);
+        arena.release();
+        CHECK(live.empty());
+        CHECK(arena.getCapacity() == 0);
+        CHECK(arena.getHighWaterMark() == 512);
+
+        arena.acquire(64);
+        CHECK(arena.getNumAllocations() == 2);
+        CHECK(arena.getCapacity() == WorkspaceArena::alignment);
+    }
+    SECTION("Replacing the allocator releases the buffer") {
+        arena.acquire(512);
+        arena.setAllocator(std::make_unique<HostWorkspaceAllocator>());
+        CHECK(live.empty());
+        CHECK(arena.getCapacity() == 0);
+        CHECK(arena.acquire(512) != nullptr);
+        CHECK(live.empty());
+    }
+    SECTION("Invalid allocator") {
+        REQUIRE_THROWS(arena.setAllocator(nullptr));
+        REQUIRE_THROWS(WorkspaceArena{nullptr});
+    }
+}
@@ -326,4 +326,136 @@ TEMPLATE_TEST_CASE("CRSMatrix::Split", "[CRSMatrix]", float, double) {
             CHECK(localCSRMatVector[0].getValues().size() == 0);
         }
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE("CRSMatrix::Halo", "[CRSMatrix]", float, double) {
+    using PrecisionT = TestType;
+    using cp_t = std::complex<PrecisionT>;
+    using index_type =
+        typename std::conditional<std::is_same<TestType, float>::value, int32_t,
+                                  int64_t>::type;
+
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+
+    size_t rank = mpi_manager.getRank();
+    size_t size = mpi_manager.getSize();
+
+    index_type csrOffsets[9] = {0, 2, 4, 5, 8, 10, 12, 14, 16};
+    index_type columns[16] = {0, 4, 1, 6, 2, 3, 5, 7,
+                              0, 4, 3, 5, 1, 6, 3, 7};
+
+    std::vector<cp_t> values(16);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = {static_cast<PrecisionT>(i), 0.0};
+    }
+
+    size_t num_rows = 8;
+    size_t local_num_rows = num_rows / size;
+
+    auto rows = scatterCSRMatrixRows<TestType, index_type>(
+        mpi_manager, local_num_rows, csrOffsets, columns, values.data(), 0);
+    auto matrix = splitHaloCSRMatrix<TestType, index_type>(
+        rows, rank, size, local_num_rows);
+    exchangeHaloIndices<TestType, index_type>(mpi_manager, matrix,
+                                              local_num_rows);
+
+    SECTION("Scatter rows") {
+        const size_t first = rank * local_num_rows;
+        for (size_t i = 0; i <= local_num_rows; i++) {
+            CHECK(rows.getCsrOffsets()[i] ==
+                  csrOffsets[first + i] - csrOffsets[first]);
+        }
+        for (size_t i = 0; i < rows.getColumns().size(); i++) {
+            CHECK(rows.getColumns()[i] == columns[csrOffsets[first] + i]);
+            CHECK(rows.getValues()[i] == values[csrOffsets[first] + i]);
+        }
+    }
+
+    SECTION("Split local and halo columns") {
+        const auto first = static_cast<index_type>(rank * local_num_rows);
+        auto &local = matrix.local;
+        auto &halo = matrix.halo;
+        CHECK(local.getValues().size() + halo.getValues().size() ==
+              rows.getValues().size());
+        for (size_t row = 0; row < local_num_rows; row++) {
+            std::vector<std::pair<index_type, PrecisionT>> expected;
+            std::vector<std::pair<index_type, PrecisionT>> result;
+            for (auto i = rows.getCsrOffsets()[row];
+                 i < rows.getCsrOffsets()[row + 1]; i++) {
+                expected.emplace_back(rows.getColumns()[i],
+                                      rows.getValues()[i].real());
+            }
+            for (auto i = local.getCsrOffsets()[row];
+                 i < local.getCsrOffsets()[row + 1]; i++) {
+                CHECK(local.getColumns()[i] <
+                      static_cast<index_type>(local_num_rows));
+                result.emplace_back(local.getColumns()[i] + first,
+                                    local.getValues()[i].real());
+            }
+            for (auto i = halo.getCsrOffsets()[row];
+                 i < halo.getCsrOffsets()[row + 1]; i++) {
+                result.emplace_back(matrix.halo_columns[halo.getColumns()[i]],
+                                    halo.getValues()[i].real());
+            }
+            std::sort(result.begin(), result.end());
+            CHECK(result == expected);
+        }
+        CHECK(matrix.halo_offsets[rank] == matrix.halo_offsets[rank + 1]);
+    }
+
+    SECTION("Exchange halo indices") {
+        REQUIRE(matrix.send_offsets.size() == size + 1);
+        CHECK(matrix.send_offsets[rank] == matrix.send_offsets[rank + 1]);
+        for (const auto index : matrix.send_indices) {
+            CHECK(index < static_cast<index_type>(local_num_rows));
+        }
+        if (size == 2) {
+            std::vector<index_type> halo_columns =
+                rank == 0 ? std::vector<index_type>{4, 5, 6, 7}
+                          : std::vector<index_type>{0, 1, 3};
+            std::vector<index_type> send_indices =
+                rank == 0 ? std::vector<index_type>{0, 1, 3}
+                          : std::vector<index_type>{0, 1, 2, 3};
+            CHECK(matrix.halo_columns == halo_columns);
+            CHECK(matrix.send_indices == send_indices);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("CRSMatrix::ScatterBlocks", "[CRSMatrix]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using index_type =
+        typename std::conditional<std::is_same<TestType, float>::value, int32_t,
+                                  int64_t>::type;
+
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+
+    size_t rank = mpi_manager.getRank();
+    size_t size = mpi_manager.getSize();
+
+    index_type csrOffsets[9] = {0, 2, 4, 5, 8, 10, 12, 14, 16};
+    index_type columns[16] = {0, 4, 1, 6, 2, 3, 5, 7,
+                              0, 4, 3, 5, 1, 6, 3, 7};
+
+    std::vector<cp_t> values(16);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = {static_cast<TestType>(i), 0.0};
+    }
+
+    size_t num_rows = 8;
+    size_t local_num_rows = num_rows / size;
+
+    // Every rank partitions the global matrix to get the expected blocks.
+    auto expected = partitionCSRMatrix<TestType, index_type>(
+        num_rows, local_num_rows, size, csrOffsets, columns, values.data());
+
+    auto blocks = scatterCSRMatrixBlocks<TestType, index_type>(
+        mpi_manager, local_num_rows, csrOffsets, columns, values.data(), 0);
+
+    REQUIRE(blocks.size() == size);
+    for (size_t j = 0; j < size; j++) {
+        CHECK(blocks[j].getCsrOffsets() == expected[rank][j].getCsrOffsets());
+        CHECK(blocks[j].getColumns() == expected[rank][j].getColumns());
+        CHECK(blocks[j].getValues() == expected[rank][j].getValues());
+    }
+}
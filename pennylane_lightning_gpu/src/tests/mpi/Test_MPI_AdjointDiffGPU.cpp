@@ -188,6 +188,71 @@ TEST_CASE("AdjointJacobianGPUMPI::adjointJacobianMPI Op=Mixed, Obs=[XXX]",
     }
 }
 
+TEST_CASE("AdjointJacobianGPUMPI::adjointJacobianMPI Op=Mixed, "
+          "Obs=SparseHam[XXX]",
+          "[AdjointJacobianGPUMPI]") {
+    using IdxT = typename SparseHamiltonianGPUMPI<double>::IdxT;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    std::vector<size_t> tp{0, 1, 2, 3, 4, 5};
+
+    const size_t num_qubits = 3;
+    const size_t num_obs = 1;
+
+    std::vector<std::vector<double>> jacobian(
+        num_obs, std::vector<double>(tp.size(), 0));
+
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+
+    int nGlobalIndexBits =
+        std::bit_width(static_cast<unsigned int>(mpi_manager.getSize())) - 1;
+    int nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    mpi_manager.Barrier();
+
+    int nDevices = 0; // Number of GPU devices per node
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    AdjointJacobianGPUMPI<double, StateVectorCudaMPI> adj;
+    {
+        StateVectorCudaMPI<double> sv_ref(mpi_manager, dt_local, 4,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv_ref.initSV_MPI();
+
+        // X0 X1 X2 is anti-diagonal, so every row block of a rank lies in
+        // the column block of another rank when there are several ranks.
+        std::vector<std::complex<double>> data(8, {1.0, 0.0});
+        std::vector<IdxT> indices{7, 6, 5, 4, 3, 2, 1, 0};
+        std::vector<IdxT> offsets{0, 1, 2, 3, 4, 5, 6, 7, 8};
+        const auto obs = std::make_shared<SparseHamiltonianGPUMPI<double>>(
+            data, indices, offsets, std::vector<size_t>{0, 1, 2});
+        auto ops = adj.createOpsData(
+            {"RZ", "RY", "RZ", "CNOT", "CNOT", "RZ", "RY", "RZ"},
+            {{param[0]},
+             {param[1]},
+             {param[2]},
+             {},
+             {},
+             {param[0]},
+             {param[1]},
+             {param[2]}},
+            {{0}, {0}, {0}, {0, 1}, {1, 2}, {1}, {1}, {1}},
+            {false, false, false, false, false, false, false, false});
+
+        adj.adjointJacobian(sv_ref, jacobian, {obs}, ops, tp, true);
+
+        CAPTURE(jacobian);
+
+        // Same values as the tensor product observable X0 X1 X2
+        CHECK(0.0 == Approx(jacobian[0][0]).margin(1e-7));
+        CHECK(-0.674214427 == Approx(jacobian[0][1]).margin(1e-7));
+        CHECK(0.275139672 == Approx(jacobian[0][2]).margin(1e-7));
+        CHECK(0.275139672 == Approx(jacobian[0][3]).margin(1e-7));
+        CHECK(-0.0129093062 == Approx(jacobian[0][4]).margin(1e-7));
+        CHECK(0.323846156 == Approx(jacobian[0][5]).margin(1e-7));
+    }
+}
+
 TEST_CASE("AdjointJacobianGPUMPI::AdjointJacobianGPUMPI Op=[RX,RX,RX], "
           "Obs=Ham[Z0+Z1+Z2], "
           "TParams=[0,2]",
@@ -240,3 +305,77 @@ TEST_CASE("AdjointJacobianGPUMPI::AdjointJacobianGPUMPI Op=[RX,RX,RX], "
         CHECK((-0.96 * sin(param[2]) == Approx(jacobian[0][1]).margin(1e-7)));
     }
 }
+
+TEST_CASE("AdjointJacobianGPUMPI::adjointJacobian and adjointJacobian_serial "
+          "Op=[RX,RY,RX,RY,RX,RY], Obs=[Z,Z,Z]",
+          "[AdjointJacobianGPUMPI]") {
+    const std::vector<double> param{-M_PI / 7, M_PI / 5,  2 * M_PI / 3,
+                                    M_PI / 9,  -M_PI / 3, M_PI / 4};
+    const std::vector<size_t> tp{0, 1, 2, 3, 4, 5};
+
+    const size_t num_qubits = 3;
+    const size_t num_obs = 3;
+
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+
+    int nGlobalIndexBits =
+        std::bit_width(static_cast<unsigned int>(mpi_manager.getSize())) - 1;
+    int nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    mpi_manager.Barrier();
+
+    std::vector<std::vector<double>> jacobian(
+        num_obs, std::vector<double>(tp.size(), 0));
+    std::vector<std::vector<double>> jacobian_serial(
+        num_obs, std::vector<double>(tp.size(), 0));
+
+    int nDevices = 0; // Number of GPU devices per node
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    AdjointJacobianGPUMPI<double, StateVectorCudaMPI> adj;
+    {
+        StateVectorCudaMPI<double> sv_ref(mpi_manager, dt_local, 4,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv_ref.initSV_MPI();
+
+        const auto obs1 = std::make_shared<NamedObsGPUMPI<double>>(
+            "PauliZ", std::vector<size_t>{0});
+        const auto obs2 = std::make_shared<NamedObsGPUMPI<double>>(
+            "PauliZ", std::vector<size_t>{1});
+        const auto obs3 = std::make_shared<NamedObsGPUMPI<double>>(
+            "PauliZ", std::vector<size_t>{2});
+        auto ops = adj.createOpsData(
+            {"RX", "RY", "RX", "RY", "RX", "RY"},
+            {{param[0]}, {param[1]}, {param[2]}, {param[3]}, {param[4]},
+             {param[5]}},
+            {{0}, {0}, {1}, {1}, {2}, {2}},
+            {false, false, false, false, false, false});
+
+        // The partial overlaps of all ranks are summed once per call.
+        adj.adjointJacobian(sv_ref, jacobian, {obs1, obs2, obs3}, ops, tp,
+                            true);
+        adj.adjointJacobian_serial(sv_ref, jacobian_serial,
+                                   {obs1, obs2, obs3}, ops, tp, true);
+
+        CAPTURE(jacobian);
+        CAPTURE(jacobian_serial);
+
+        // <Z_i> = cos(a_i) cos(b_i) for RY(b_i) RX(a_i) on qubit i.
+        for (size_t i = 0; i < num_obs; i++) {
+            const double a = param[2 * i];
+            const double b = param[2 * i + 1];
+            CHECK(-sin(a) * cos(b) ==
+                  Approx(jacobian[i][2 * i]).margin(1e-7));
+            CHECK(-cos(a) * sin(b) ==
+                  Approx(jacobian[i][2 * i + 1]).margin(1e-7));
+            for (size_t j = 0; j < tp.size(); j++) {
+                CHECK(jacobian_serial[i][j] ==
+                      Approx(jacobian[i][j]).margin(1e-7));
+                if (j / 2 != i) {
+                    CHECK(0.0 == Approx(jacobian[i][j]).margin(1e-7));
+                }
+            }
+        }
+    }
+}
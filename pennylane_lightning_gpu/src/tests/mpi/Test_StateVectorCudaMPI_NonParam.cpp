@@ -13,6 +13,8 @@
 #include "cuGates_host.hpp"
 #include "cuda_helpers.hpp"
 
+#include "ObservablesGPU.hpp"
+#include "ObservablesGPUMPI.hpp"
 #include "StateVectorCudaMPI.hpp"
 #include "StateVectorCudaManaged.hpp"
 #include "StateVectorLQubitRaw.hpp"
@@ -201,12 +203,14 @@ TEMPLATE_TEST_CASE("StateVectorCudaMPI::SetIthStates",
                     nLocalIndexBits);                                          \
                 sv.CopyHostDataToGpu(local_state, false);                      \
                 sv.GATE_METHOD(WIRE, false);                                   \
+                sv.applyQubitMap();                                            \
                 sv.CopyGpuDataToHost(local_state.data(),                       \
                                      static_cast<std::size_t>(subSvLength));   \
                                                                                \
                 SVDataGPU<TestType> svdat{(NUM_QUBITS), init_sv};              \
                 if (mpi_manager.getRank() == 0) {                              \
                     svdat.cuda_sv.GATE_METHOD(WIRE, false);                    \
+                    svdat.cuda_sv.applyQubitMap();                             \
                     svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(),        \
                                                     svLength);                 \
                 }                                                              \
@@ -221,11 +225,13 @@ TEMPLATE_TEST_CASE("StateVectorCudaMPI::SetIthStates",
                     nLocalIndexBits);                                          \
                 sv.CopyHostDataToGpu(local_state, false);                      \
                 sv.applyOperation(GATE_NAME, WIRE, false);                     \
+                sv.applyQubitMap();                                            \
                 sv.CopyGpuDataToHost(local_state.data(),                       \
                                      static_cast<std::size_t>(subSvLength));   \
                 SVDataGPU<TestType> svdat{(NUM_QUBITS), init_sv};              \
                 if (mpi_manager.getRank() == 0) {                              \
                     svdat.cuda_sv.applyOperation(GATE_NAME, WIRE, false);      \
+                    svdat.cuda_sv.applyQubitMap();                             \
                     svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(),        \
                                                     svLength);                 \
                 }                                                              \
@@ -335,6 +341,603 @@ TEMPLATE_TEST_CASE("StateVectorCudaMPI::CSWAP", "[StateVectorCudaMPI_Nonparam]",
                                      msb_3qubit);
 }
 
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::QubitMap",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    size_t subSvLength = 1 << nLocalIndexBits;
+    size_t svLength = 1 << num_qubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    std::vector<cp_t> expected_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, num_qubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    const std::vector<std::string> ops{"Hadamard", "CNOT", "SWAP", "RX",
+                                       "Toffoli",  "SWAP", "CSWAP", "CZ"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {0, num_qubits - 1}, {1, num_qubits - 2}, {1},
+        {0, 1, 2}, {0, 3}, {num_qubits - 1, 0, 1}, {1, 2}};
+
+    StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                    nGlobalIndexBits, nLocalIndexBits);
+    sv.CopyHostDataToGpu(local_state, false);
+    for (size_t i = 0; i < ops.size(); i++) {
+        sv.applyOperation(ops[i], wires[i], false, {0.3});
+    }
+    // Global qubits swapped in by the gates stay local.
+    if (nGlobalIndexBits > 0) {
+        CHECK_FALSE(sv.getQubitMap().isIdentity());
+    }
+
+    const std::vector<cp_t> z{{1, 0}, {0, 0}, {0, 0}, {-1, 0}};
+    double expected_expval_z = 0;
+    SVDataGPU<TestType> svdat{num_qubits, init_sv};
+    if (mpi_manager.getRank() == 0) {
+        for (size_t i = 0; i < ops.size(); i++) {
+            svdat.cuda_sv.applyOperation(ops[i], wires[i], false, {0.3});
+        }
+        svdat.cuda_sv.applyQubitMap();
+        svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(), svLength);
+        expected_expval_z = svdat.cuda_sv.expval({0}, z).x;
+    }
+    mpi_manager.Bcast<double>(expected_expval_z, 0);
+
+    // The expectation value is computed without restoring the layout.
+    CHECK(sv.expval({0}, z).x == Approx(expected_expval_z).margin(1e-5));
+
+    if (nGlobalIndexBits > 0) {
+        CHECK_THROWS(sv.getData());
+    }
+    sv.applyQubitMap();
+    CHECK(sv.getQubitMap().isIdentity());
+    sv.CopyGpuDataToHost(local_state.data(),
+                         static_cast<std::size_t>(subSvLength));
+    auto expected_local_sv = mpi_manager.scatter(expected_sv, 0);
+    CHECK(local_state == Pennylane::approx(expected_local_sv));
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::DiagonalBatching",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    size_t subSvLength = 1 << nLocalIndexBits;
+    size_t svLength = 1 << num_qubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    std::vector<cp_t> expected_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, num_qubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    // Diagonal runs on global wires are applied without index bit swaps.
+    const std::vector<std::string> ops{
+        "RZ",      "IsingZZ", "CZ",  "Hadamard", "ControlledPhaseShift",
+        "MultiRZ", "SWAP",    "CRZ", "T",        "RX"};
+    const std::vector<std::vector<size_t>> wires{
+        {0},    {0, num_qubits - 1},    {1, 2}, {0}, {2, 0},
+        {0, 1, num_qubits - 1},         {0, 3}, {num_qubits - 1, 0},
+        {1},    {2}};
+    const std::vector<bool> adjoints{false, false, false, false, true,
+                                     false, false, true,  true,  false};
+    std::vector<std::vector<PrecisionT>> params;
+    for (size_t i = 0; i < ops.size(); i++) {
+        params.push_back({static_cast<PrecisionT>(0.1 + 0.2 * i)});
+    }
+
+    StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                    nGlobalIndexBits, nLocalIndexBits);
+    sv.CopyHostDataToGpu(local_state, false);
+    sv.applyOperation(ops, wires, adjoints, params);
+
+    SVDataGPU<TestType> svdat{num_qubits, init_sv};
+    if (mpi_manager.getRank() == 0) {
+        for (size_t i = 0; i < ops.size(); i++) {
+            svdat.cuda_sv.applyOperation(ops[i], wires[i], adjoints[i],
+                                         params[i]);
+        }
+        svdat.cuda_sv.applyQubitMap();
+        svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(), svLength);
+    }
+
+    sv.applyQubitMap();
+    sv.CopyGpuDataToHost(local_state.data(),
+                         static_cast<std::size_t>(subSvLength));
+    auto expected_local_sv = mpi_manager.scatter(expected_sv, 0);
+    CHECK(local_state == Pennylane::approx(expected_local_sv));
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::planned index bit swaps",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    size_t subSvLength = 1 << nLocalIndexBits;
+    size_t svLength = 1 << num_qubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    std::vector<cp_t> expected_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, num_qubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    // Gates on the global wires, with SWAP relabellings and diagonal gates
+    // in between, share the swaps of the look-ahead plan.
+    const std::vector<std::string> ops{
+        "RX",   "CNOT", "Hadamard", "RZ",       "CRY", "SWAP",
+        "Rot",  "CNOT", "PauliX",   "IsingXX", "CZ",  "Toffoli"};
+    const std::vector<std::vector<size_t>> wires{
+        {0},    {0, 1},    {1},    {0}, {1, 0}, {0, 3},
+        {0},    {3, 0},    {2},    {1, 0},      {0, 1}, {0, 1, 2}};
+    const std::vector<bool> adjoints{false, false, false, true,
+                                     false, false, true,  false,
+                                     false, true,  false, false};
+    std::vector<std::vector<PrecisionT>> params;
+    for (size_t i = 0; i < ops.size(); i++) {
+        const auto angle = static_cast<PrecisionT>(0.1 + 0.2 * i);
+        params.push_back({angle, 2 * angle, 3 * angle});
+    }
+
+    StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                    nGlobalIndexBits, nLocalIndexBits);
+    sv.CopyHostDataToGpu(local_state, false);
+    sv.applyOperation(ops, wires, adjoints, params);
+
+    SVDataGPU<TestType> svdat{num_qubits, init_sv};
+    if (mpi_manager.getRank() == 0) {
+        for (size_t i = 0; i < ops.size(); i++) {
+            svdat.cuda_sv.applyOperation(ops[i], wires[i], adjoints[i],
+                                         params[i]);
+        }
+        svdat.cuda_sv.applyQubitMap();
+        svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(), svLength);
+    }
+
+    sv.applyQubitMap();
+    sv.CopyGpuDataToHost(local_state.data(),
+                         static_cast<std::size_t>(subSvLength));
+    auto expected_local_sv = mpi_manager.scatter(expected_sv, 0);
+    CHECK(local_state == Pennylane::approx(expected_local_sv));
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::planned swaps across measurements",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    size_t subSvLength = 1 << nLocalIndexBits;
+    size_t svLength = 1 << num_qubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    std::vector<cp_t> expected_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, num_qubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    // Gates on the global wires 0 and 1, around measurements of wire 0
+    // while it is swapped in. The measurements keep the planned layout, so
+    // they add no index bit swap.
+    const std::vector<std::string> gate_ops{"Hadamard", "CNOT", "RX", "CRY",
+                                            "PauliX"};
+    const std::vector<std::vector<size_t>> gate_wires{
+        {0}, {0, 1}, {0}, {1, 0}, {1}};
+    const size_t split = 2;
+    const auto withMeasurement = [&](const std::string &opName) {
+        std::vector<std::string> ops{gate_ops};
+        std::vector<std::vector<size_t>> wires{gate_wires};
+        ops.insert(ops.begin() + split, opName);
+        wires.insert(wires.begin() + split, {0});
+        return std::make_pair(ops, wires);
+    };
+    const auto apply = [&](StateVectorCudaMPI<TestType> &sv,
+                           const std::vector<std::string> &ops,
+                           const std::vector<std::vector<size_t>> &wires) {
+        std::vector<std::vector<PrecisionT>> params(ops.size(), {0.3});
+        params[split] = {1.0};
+        sv.applyOperation(ops, wires, std::vector<bool>(ops.size(), false),
+                          params);
+    };
+
+    StateVectorCudaMPI<TestType> sv_ref(mpi_manager, dt_local,
+                                        mpi_buffersize, nGlobalIndexBits,
+                                        nLocalIndexBits);
+    sv_ref.CopyHostDataToGpu(local_state, false);
+    apply(sv_ref, gate_ops, gate_wires);
+    const size_t num_swaps = sv_ref.getNumGlobalIndexBitSwaps();
+    if (nGlobalIndexBits > 0) {
+        CHECK(num_swaps > 0);
+    }
+
+    SECTION("Measure") {
+        const auto [ops, wires] = withMeasurement("Measure");
+        StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                        nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+        sv.seedMeasurements(42);
+        apply(sv, ops, wires);
+        CHECK(sv.getMeasurementOutcomes().size() == 1);
+        CHECK(sv.getNumGlobalIndexBitSwaps() == num_swaps);
+    }
+
+    SECTION("Collapse") {
+        const auto [ops, wires] = withMeasurement("Collapse");
+        StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                        nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+        apply(sv, ops, wires);
+        CHECK(sv.getNumGlobalIndexBitSwaps() == num_swaps);
+
+        SVDataGPU<TestType> svdat{num_qubits, init_sv};
+        if (mpi_manager.getRank() == 0) {
+            for (size_t i = 0; i < ops.size(); i++) {
+                svdat.cuda_sv.applyOperation(ops[i], wires[i], false,
+                                             {i == split ? 1.0F : 0.3F});
+            }
+            svdat.cuda_sv.applyQubitMap();
+            svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(), svLength);
+        }
+        sv.applyQubitMap();
+        sv.CopyGpuDataToHost(local_state.data(),
+                             static_cast<std::size_t>(subSvLength));
+        auto expected_local_sv = mpi_manager.scatter(expected_sv, 0);
+        CHECK(local_state == Pennylane::approx(expected_local_sv));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::pipelined swaps",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    // Enough qubits for a transfer to span several chunks of a 1 MiB buffer.
+    const size_t nQubits = 20;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = nQubits - nGlobalIndexBits;
+    size_t subSvLength = 1 << nLocalIndexBits;
+    size_t svLength = 1 << nQubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    std::vector<cp_t> expected_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, nQubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    // Pauli rotations, device and host matrices on global wires, with a
+    // local wire among the highest local bits for the CNOT on {1, 0}.
+    const std::vector<std::string> ops{"RX",   "CNOT", "Hadamard", "Rot",
+                                       "CRY", "CNOT", "Toffoli", "IsingXX"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {0, nQubits - 1}, {1}, {0}, {1, 0}, {1, 0}, {0, 1, 2}, {2, 0}};
+    std::vector<std::vector<PrecisionT>> params;
+    for (size_t i = 0; i < ops.size(); i++) {
+        const auto angle = static_cast<PrecisionT>(0.1 + 0.2 * i);
+        params.push_back({angle, 2 * angle, 3 * angle});
+    }
+
+    const std::vector<cp_t> z{{1, 0}, {0, 0}, {0, 0}, {-1, 0}};
+    double expected_expval_z = 0;
+    SVDataGPU<TestType> svdat{nQubits, init_sv};
+    if (mpi_manager.getRank() == 0) {
+        for (size_t i = 0; i < ops.size(); i++) {
+            svdat.cuda_sv.applyOperation(ops[i], wires[i], false, params[i]);
+        }
+        svdat.cuda_sv.applyQubitMap();
+        svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(), svLength);
+        expected_expval_z = svdat.cuda_sv.expval({1}, z).x;
+    }
+    mpi_manager.Bcast<double>(expected_expval_z, 0);
+    auto expected_local_sv = mpi_manager.scatter(expected_sv, 0);
+
+    // Swaps are pipelined by default; the barrier-synchronized path is kept
+    // behind setPipelinedSwaps(false).
+    for (const bool pipelined : {true, false}) {
+        StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                        nGlobalIndexBits, nLocalIndexBits);
+        CHECK(sv.getPipelinedSwaps());
+        sv.setPipelinedSwaps(pipelined);
+        sv.CopyHostDataToGpu(local_state, false);
+        for (size_t i = 0; i < ops.size(); i++) {
+            sv.applyOperation(ops[i], wires[i], false, params[i]);
+        }
+
+        // A global wire is swapped in and out.
+        CHECK(sv.expval({1}, z).x == Approx(expected_expval_z).margin(1e-5));
+
+        std::vector<cp_t> result_sv(subSvLength);
+        sv.applyQubitMap();
+        sv.CopyGpuDataToHost(result_sv.data(),
+                             static_cast<std::size_t>(subSvLength));
+        CHECK(result_sv == Pennylane::approx(expected_local_sv));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::variance",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    using namespace Pennylane::Algorithms;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    size_t svLength = 1 << num_qubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, num_qubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                    nGlobalIndexBits, nLocalIndexBits);
+    sv.CopyHostDataToGpu(local_state, false);
+    SVDataGPU<TestType> svdat{num_qubits, init_sv};
+
+    // Wire 0 is global whenever there is more than one rank.
+    const std::vector<cp_t> diag{{1.0, 0.0},  {0.0, 0.0}, {0.0, 0.0},
+                                 {0.0, 0.0},  {0.0, 0.0}, {-0.5, 0.0},
+                                 {0.0, 0.0},  {0.0, 0.0}, {0.0, 0.0},
+                                 {0.0, 0.0},  {2.0, 0.0}, {0.0, 0.0},
+                                 {0.0, 0.0},  {0.0, 0.0}, {0.0, 0.0},
+                                 {0.3, 0.0}};
+    const std::vector<size_t> diag_wires{num_qubits - 1, 0};
+
+    SECTION("Pauli word") {
+        auto x0 = std::make_shared<NamedObsGPUMPI<TestType>>(
+            "PauliX", std::vector<size_t>{0});
+        auto z1 = std::make_shared<NamedObsGPUMPI<TestType>>(
+            "PauliZ", std::vector<size_t>{num_qubits - 1});
+        auto ob = TensorProdObsGPUMPI<TestType>::create({x0, z1});
+
+        double expected = 0;
+        if (mpi_manager.getRank() == 0) {
+            auto x0_ref = std::make_shared<NamedObsGPU<TestType>>(
+                "PauliX", std::vector<size_t>{0});
+            auto z1_ref = std::make_shared<NamedObsGPU<TestType>>(
+                "PauliZ", std::vector<size_t>{num_qubits - 1});
+            expected = svdat.cuda_sv.variance(
+                *TensorProdObsGPU<TestType>::create({x0_ref, z1_ref}));
+        }
+        mpi_manager.Bcast<double>(expected, 0);
+        CHECK(sv.variance(*ob) == Approx(expected).margin(1e-5));
+    }
+
+    SECTION("Diagonal Hermitian") {
+        HermitianObsGPUMPI<TestType> ob{diag, diag_wires};
+        double expected = 0;
+        if (mpi_manager.getRank() == 0) {
+            HermitianObsGPU<TestType> ob_ref{diag, diag_wires};
+            expected = svdat.cuda_sv.variance(ob_ref);
+        }
+        mpi_manager.Bcast<double>(expected, 0);
+        CHECK(sv.variance(ob) == Approx(expected).margin(1e-5));
+    }
+
+    SECTION("Hamiltonian") {
+        auto x0 = std::make_shared<NamedObsGPUMPI<TestType>>(
+            "PauliX", std::vector<size_t>{0});
+        auto h1 = std::make_shared<NamedObsGPUMPI<TestType>>(
+            "Hadamard", std::vector<size_t>{1});
+        HamiltonianGPUMPI<TestType> ob{
+            std::vector<TestType>{0.4, 0.9},
+            std::vector<std::shared_ptr<ObservableGPUMPI<TestType>>>{x0,
+                                                                     h1}};
+        double expected = 0;
+        if (mpi_manager.getRank() == 0) {
+            auto x0_ref = std::make_shared<NamedObsGPU<TestType>>(
+                "PauliX", std::vector<size_t>{0});
+            auto h1_ref = std::make_shared<NamedObsGPU<TestType>>(
+                "Hadamard", std::vector<size_t>{1});
+            HamiltonianGPU<TestType> ob_ref{
+                std::vector<TestType>{0.4, 0.9},
+                std::vector<std::shared_ptr<ObservableGPU<TestType>>>{
+                    x0_ref, h1_ref}};
+            expected = svdat.cuda_sv.variance(ob_ref);
+        }
+        mpi_manager.Bcast<double>(expected, 0);
+        CHECK(sv.variance(ob) == Approx(expected).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::conditional probability",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    size_t svLength = 1 << num_qubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, num_qubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                    nGlobalIndexBits, nLocalIndexBits);
+    sv.CopyHostDataToGpu(local_state, false);
+    SVDataGPU<TestType> svdat{num_qubits, init_sv};
+
+    // Wire 0 is global whenever there is more than one rank: condition on
+    // global and local wires, for global and local outcome wires.
+    const std::vector<std::vector<size_t>> wires{
+        {num_qubits - 1, 0}, {1, 2}, {0}};
+    const std::vector<std::vector<size_t>> condition_wires{
+        {1, num_qubits - 2}, {0, num_qubits - 1}, {}};
+    const std::vector<std::vector<size_t>> condition_bits{
+        {1, 0}, {1, 1}, {}};
+    for (size_t c = 0; c < wires.size(); c++) {
+        std::vector<double> expected(size_t{1} << wires[c].size());
+        if (mpi_manager.getRank() == 0) {
+            expected = svdat.cuda_sv.probability(wires[c], condition_wires[c],
+                                                 condition_bits[c]);
+        }
+        mpi_manager.Bcast<double>(expected, 0);
+        CHECK(sv.probability(wires[c], condition_wires[c],
+                             condition_bits[c]) ==
+              Pennylane::approx(expected));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::mid-circuit measurement",
+                   "[StateVectorCudaMPI_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using PrecisionT = TestType;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t mpi_buffersize = 1;
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = num_qubits - nGlobalIndexBits;
+    size_t subSvLength = 1 << nLocalIndexBits;
+    size_t svLength = 1 << num_qubits;
+
+    std::vector<cp_t> init_sv(svLength);
+    std::vector<cp_t> expected_sv(svLength);
+    if (mpi_manager.getRank() == 0) {
+        std::mt19937 re{1337};
+        init_sv = createRandomState<PrecisionT>(re, num_qubits);
+    }
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0;
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    StateVectorCudaMPI<TestType> sv(mpi_manager, dt_local, mpi_buffersize,
+                                    nGlobalIndexBits, nLocalIndexBits);
+    SVDataGPU<TestType> svdat{num_qubits, init_sv};
+
+    SECTION("Collapse global and local wires") {
+        // Wire 0 is global whenever there is more than one rank.
+        sv.CopyHostDataToGpu(local_state, false);
+        sv.applyOperation({"Collapse", "Collapse"}, {{0}, {num_qubits - 1}},
+                          {false, false}, {{1.0}, {0.0}});
+        if (mpi_manager.getRank() == 0) {
+            svdat.cuda_sv.collapse(0, 1);
+            svdat.cuda_sv.collapse(num_qubits - 1, 0);
+            svdat.cuda_sv.applyQubitMap();
+            svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(), svLength);
+        }
+        sv.applyQubitMap();
+        sv.CopyGpuDataToHost(local_state.data(),
+                             static_cast<std::size_t>(subSvLength));
+        auto expected_local_sv = mpi_manager.scatter(expected_sv, 0);
+        CHECK(local_state == Pennylane::approx(expected_local_sv));
+    }
+
+    SECTION("Measure and reset") {
+        sv.initSV_MPI();
+        sv.seedMeasurements(42);
+        sv.applyOperation({"Hadamard", "CNOT", "Measure"},
+                          {{num_qubits - 1}, {num_qubits - 1, 0}, {0}},
+                          {false, false, false});
+        const auto &outcomes = sv.getMeasurementOutcomes();
+        REQUIRE(outcomes.size() == 1);
+        auto outcome = outcomes[0];
+        std::vector<double> probs{outcome == 0 ? 1.0 : 0.0,
+                                  outcome == 1 ? 1.0 : 0.0};
+        CHECK(sv.probability({num_qubits - 1}, {}, {}) ==
+              Pennylane::approx(probs));
+        CHECK(mpi_manager.allreduce<size_t>(outcome, "sum") ==
+              outcome * static_cast<size_t>(mpi_manager.getSize()));
+
+        sv.applyOperation("Reset", {0}, false);
+        sv.reset(num_qubits - 1);
+        CHECK(sv.probability({0, num_qubits - 1}, {}, {}) ==
+              Pennylane::approx(std::vector<double>{1.0, 0.0, 0.0, 0.0}));
+        CHECK(sv.getMeasurementOutcomes().size() == 1);
+    }
+}
+
 TEMPLATE_TEST_CASE("StateVectorCudaMPI::expval_Identity",
                    "[StateVectorCudaMPI_Nonparam]", double) {
     using cp_t = std::complex<TestType>;
@@ -752,9 +1355,36 @@ TEMPLATE_TEST_CASE("Sample", "[LightningGPUMPI_NonParam]", double) {
 
     REQUIRE_THAT(probabilities,
                  Catch::Approx(expected_probabilities).margin(.05));
+
+    SECTION("Packed samples") {
+        const auto packed = sv.generate_samples_packed(num_samples);
+        REQUIRE(packed.size() == num_samples);
+        std::vector<TestType> packed_probabilities(N, 0);
+        for (const auto bits : packed) {
+            packed_probabilities[bits] +=
+                1 / static_cast<TestType>(num_samples);
+        }
+        REQUIRE_THAT(packed_probabilities,
+                     Catch::Approx(expected_probabilities).margin(.05));
+    }
+    SECTION("Counts") {
+        const auto sample_counts = sv.generate_counts(num_samples);
+        size_t total = 0;
+        for (size_t i = 0; i < sample_counts.size(); i++) {
+            if (i > 0) {
+                CHECK(sample_counts[i - 1].first < sample_counts[i].first);
+            }
+            total += sample_counts[i].second;
+            CHECK(sample_counts[i].second /
+                      static_cast<TestType>(num_samples) ==
+                  Approx(expected_probabilities[sample_counts[i].first])
+                      .margin(.05));
+        }
+        CHECK(total == num_samples);
+    }
 }
 
-TEMPLATE_TEST_CASE("StateVectorCudaMPI::Ctor", "[StateVectorCudaMPI_Nonparam]",
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::Ctor","[StateVectorCudaMPI_Nonparam]",
                    float, double) {
     using PrecisionT = TestType;
     using cp_t = std::complex<PrecisionT>;
@@ -925,6 +1555,134 @@ TEMPLATE_TEST_CASE("StateVectorCudaMPI::getExpectationValuePauliWords",
 
         CHECK(expval_mpi == Approx(-0.0105768395).margin(1e-7));
     }
+
+    SECTION("Test getExpectationValuePauliWords (grouped words)") {
+
+        StateVectorCudaMPI<PrecisionT> sv(mpi_manager, dt_local, mpi_buffersize,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+
+        // The first 8 words form one qubit-wise commuting group, spanning
+        // global and local wires; "YY" is evaluated on its own.
+        std::vector<std::string> pauli_words = {"ZX", "Z",  "X", "XZ", "IX",
+                                                "ZZ", "Z",  "Z", "YY"};
+        std::vector<std::vector<size_t>> tgts = {
+            {0, 3}, {0}, {3}, {3, 0}, {1, 3}, {1, 2}, {1}, {2}, {0, 1}};
+        std::vector<std::complex<PrecisionT>> coeffs = {
+            {0.1, 0.0}, {0.2, 0.0}, {0.3, 0.0}, {0.4, 0.0}, {0.5, 0.0},
+            {0.6, 0.0}, {0.7, 0.0}, {0.8, 0.0}, {0.9, 0.0}};
+
+        auto expval_mpi =
+            sv.getExpectationValuePauliWords(pauli_words, tgts, coeffs.data());
+
+        CHECK(expval_mpi == Approx(0.1990730414).margin(1e-7));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaMPI::getExpectationValuePauliSentence",
+                   "[StateVectorCudaMPI_Nonparam]", double) {
+    using PrecisionT = TestType;
+    using cp_t = std::complex<PrecisionT>;
+    MPIManager mpi_manager(MPI_COMM_WORLD);
+    size_t numqubits = 4;
+    size_t mpi_buffersize = 1;
+
+    size_t nGlobalIndexBits =
+        std::bit_width(static_cast<size_t>(mpi_manager.getSize())) - 1;
+    size_t nLocalIndexBits = numqubits - nGlobalIndexBits;
+    mpi_manager.Barrier();
+
+    std::vector<cp_t> init_sv{{0.1653855288944372, 0.08360762242222763},
+                              {0.0731293375604395, 0.13209080879903976},
+                              {0.23742759434160687, 0.2613440813782711},
+                              {0.16768740742688235, 0.2340607179431313},
+                              {0.2247465091396771, 0.052469062762363974},
+                              {0.1595307101966878, 0.018355977199570113},
+                              {0.01433428625707798, 0.18836803047905595},
+                              {0.20447553584586473, 0.02069817884076428},
+                              {0.17324175995006008, 0.12834320562185453},
+                              {0.021542232643170886, 0.2537776554975786},
+                              {0.2917899745322105, 0.30227665008366594},
+                              {0.17082687702494623, 0.013880922806771745},
+                              {0.03801974084659355, 0.2233816291263903},
+                              {0.1991010562067874, 0.2378546697582974},
+                              {0.13833362414043807, 0.0571737109901294},
+                              {0.1960850292216881, 0.22946370987301284}};
+
+    auto local_state = mpi_manager.scatter(init_sv, 0);
+
+    int nDevices = 0; // Number of GPU devices per node
+    cudaGetDeviceCount(&nDevices);
+    int deviceId = mpi_manager.getRank() % nDevices;
+    cudaSetDevice(deviceId);
+    DevTag<int> dt_local(deviceId, 0);
+    mpi_manager.Barrier();
+
+    SECTION("Test getExpectationValuePauliSentence (full wires)") {
+        StateVectorCudaMPI<PrecisionT> sv(mpi_manager, dt_local, mpi_buffersize,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+
+        std::vector<std::string> pauli_words = {"XYZI", "ZZXX"};
+        std::vector<std::vector<size_t>> tgts = {{0, 1, 2, 3}, {0, 1, 2, 3}};
+        std::vector<PrecisionT> coeffs = {0.1, 0.2};
+
+        const auto sentence = CUDA::Util::compilePauliSentence(
+            coeffs, pauli_words, tgts, numqubits);
+        auto expval_mpi = sv.getExpectationValuePauliSentence(sentence);
+
+        CHECK(expval_mpi == Approx(0.0014895211).margin(1e-7));
+    }
+
+    SECTION("Test getExpectationValuePauliSentence (global wires)") {
+        StateVectorCudaMPI<PrecisionT> sv(mpi_manager, dt_local, mpi_buffersize,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+
+        std::vector<std::string> pauli_words = {"X", "Y", "Z", "I"};
+        std::vector<std::vector<size_t>> tgts = {{0}, {0}, {0}, {0}};
+        std::vector<PrecisionT> coeffs = {0.1, 0.2, 0.3, 0.4};
+
+        const auto sentence = CUDA::Util::compilePauliSentence(
+            coeffs, pauli_words, tgts, numqubits);
+        auto expval_mpi = sv.getExpectationValuePauliSentence(sentence);
+
+        CHECK(expval_mpi == Approx(0.4589167637).margin(1e-7));
+    }
+
+    SECTION("Test getExpectationValuePauliSentence (local wires)") {
+        StateVectorCudaMPI<PrecisionT> sv(mpi_manager, dt_local, mpi_buffersize,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+
+        std::vector<std::string> pauli_words = {"X", "Y", "Z", "I"};
+        std::vector<std::vector<size_t>> tgts = {
+            {numqubits - 1}, {numqubits - 1}, {numqubits - 1}, {numqubits - 1}};
+        std::vector<PrecisionT> coeffs = {0.1, 0.2, 0.3, 0.4};
+
+        const auto sentence = CUDA::Util::compilePauliSentence(
+            coeffs, pauli_words, tgts, numqubits);
+        auto expval_mpi = sv.getExpectationValuePauliSentence(sentence);
+
+        CHECK(expval_mpi == Approx(0.4841317321).margin(1e-7));
+    }
+
+    SECTION("Test getExpectationValuePauliSentence (mixed wires)") {
+        StateVectorCudaMPI<PrecisionT> sv(mpi_manager, dt_local, mpi_buffersize,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+
+        std::vector<std::string> pauli_words = {"X", "XY", "XYZ", "XYZI"};
+        std::vector<std::vector<size_t>> tgts = {
+            {0}, {0, 1}, {0, 1, 2}, {0, 1, 2, 3}};
+        std::vector<PrecisionT> coeffs = {0.1, 0.2, 0.3, 0.4};
+
+        const auto sentence = CUDA::Util::compilePauliSentence(
+            coeffs, pauli_words, tgts, numqubits);
+        auto expval_mpi = sv.getExpectationValuePauliSentence(sentence);
+
+        CHECK(expval_mpi == Approx(-0.0105768395).margin(1e-7));
+    }
 }
 
 TEMPLATE_TEST_CASE("StateVectorCudaMPI::Hamiltonian_expval_cuSparse",
@@ -981,4 +1739,31 @@ TEMPLATE_TEST_CASE("StateVectorCudaMPI::Hamiltonian_expval_cuSparse",
 
         CHECK(expected == Approx(results).epsilon(1e-7));
     }
+
+    SECTION("GetExpectionCuSparse with halo") {
+        // Rows reference the amplitudes of the other ranks.
+        index_type csrOffsets[9] = {0, 2, 4, 5, 8, 10, 12, 14, 16};
+        index_type columns[16] = {0, 4, 1, 6, 2, 3, 5, 7,
+                                  0, 4, 3, 5, 1, 6, 3, 7};
+
+        std::complex<TestType> values[16] = {
+            {1.0, 0.0},  {0.5, 0.0},  {1.0, 0.0},   {0.0, 0.5},
+            {2.0, 0.0},  {1.0, 0.0},  {0.25, 0.0},  {-0.5, 0.0},
+            {0.5, 0.0},  {-1.0, 0.0}, {0.25, 0.0},  {1.0, 0.0},
+            {0.0, -0.5}, {0.5, 0.0},  {-0.5, 0.0},  {1.0, 0.0}};
+
+        index_type num_csrOffsets = 9;
+        index_type nnz = 16;
+
+        StateVectorCudaMPI<PrecisionT> sv(mpi_manager, dt_local, mpi_buffersize,
+                                          nGlobalIndexBits, nLocalIndexBits);
+        sv.CopyHostDataToGpu(local_state, false);
+
+        auto results = sv.template getExpectationValueOnSparseSpMV<index_type>(
+            csrOffsets, num_csrOffsets, columns, values, nnz);
+
+        TestType expected = 0.52;
+
+        CHECK(expected == Approx(results).epsilon(1e-6));
+    }
 }
@@ -92,10 +92,12 @@ using namespace CUDA;
                     nLocalIndexBits);                                          \
                 sv.CopyHostDataToGpu(local_state, false);                      \
                 sv.GATE_METHOD(WIRE, false, ANGLE);                            \
+                sv.applyQubitMap();                                            \
                 sv.CopyGpuDataToHost(local_state.data(), subSvLength);         \
                 SVDataGPU<TestType> svdat{NUM_QUBITS, init_sv};                \
                 if (mpi_manager.getRank() == 0) {                              \
                     svdat.cuda_sv.GATE_METHOD(WIRE, false, ANGLE);             \
+                    svdat.cuda_sv.applyQubitMap();                             \
                     svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(),        \
                                                     svLength);                 \
                 }                                                              \
@@ -110,11 +112,13 @@ using namespace CUDA;
                     nLocalIndexBits);                                          \
                 sv.CopyHostDataToGpu(local_state, false);                      \
                 sv.applyOperation(GATE_NAME, WIRE, false, ANGLE);              \
+                sv.applyQubitMap();                                            \
                 sv.CopyGpuDataToHost(local_state.data(), subSvLength);         \
                 SVDataGPU<TestType> svdat{NUM_QUBITS, init_sv};                \
                 if (mpi_manager.getRank() == 0) {                              \
                     svdat.cuda_sv.applyOperation(GATE_NAME, WIRE, false,       \
                                                  ANGLE);                       \
+                    svdat.cuda_sv.applyQubitMap();                             \
                     svdat.cuda_sv.CopyGpuDataToHost(expected_sv.data(),        \
                                                     svLength);                 \
                 }                                                              \
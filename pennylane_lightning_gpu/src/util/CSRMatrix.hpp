@@ -17,8 +17,10 @@
 #include <algorithm>
 #include <bit>
 #include <complex>
+#include <utility>
 #include <vector>
 
+#include "CSRPartition.hpp"
 #include "MPIManager.hpp"
 
 /// @cond DEV
@@ -27,50 +29,6 @@ using namespace Pennylane::CUDA;
 } // namespace
 /// @endcond
 namespace Pennylane::MPI {
-/**
- * @brief Manage memory of Compressed Sparse Row (CSR) sparse matrix. CSR format
- * represents a matrix M by three (one-dimensional) arrays, that respectively
- * contain nonzero values, row offsets, and column indices.
- *
- * @tparam Precision Floating-point precision type.
- * @tparam index_type Integer type.
- */
-template <class Precision, class index_type> class CSRMatrix {
-  private:
-    std::vector<index_type> columns_;
-    std::vector<index_type> csrOffsets_;
-    std::vector<std::complex<Precision>> values_;
-
-  public:
-    CSRMatrix(size_t num_rows, size_t nnz)
-        : columns_(nnz, 0), csrOffsets_(num_rows + 1, 0), values_(nnz){};
-
-    CSRMatrix(size_t num_rows, size_t nnz, index_type *column_ptr,
-              index_type *csrOffsets_ptr, std::complex<Precision> *value_ptr)
-        : columns_(column_ptr, column_ptr + nnz),
-          csrOffsets_(csrOffsets_ptr, csrOffsets_ptr + num_rows + 1),
-          values_(value_ptr, value_ptr + nnz){};
-
-    CSRMatrix() = default;
-
-    /**
-     * @brief Get the CSR format index vector of the matrix.
-     */
-    auto getColumns() -> std::vector<index_type> & { return columns_; }
-
-    /**
-     * @brief Get CSR format offset vector of the matrix.
-     */
-    auto getCsrOffsets() -> std::vector<index_type> & { return csrOffsets_; }
-
-    /**
-     * @brief Get CSR format data vector of the matrix.
-     */
-    auto getValues() -> std::vector<std::complex<Precision>> & {
-        return values_;
-    }
-};
-
 /**
  * @brief Convert a global CSR (Compressed Sparse Row) format matrix into
  * local blocks. This operation should be conducted on the rank 0.
@@ -93,70 +51,10 @@ auto splitCSRMatrix(MPIManager &mpi_manager, const size_t &num_rows,
                     const index_type *columns_ptr,
                     const std::complex<Precision> *values_ptr)
     -> std::vector<std::vector<CSRMatrix<Precision, index_type>>> {
-
-    size_t num_row_blocks = mpi_manager.getSize();
-    size_t num_col_blocks = num_row_blocks;
-
-    std::vector<std::vector<CSRMatrix<Precision, index_type>>>
-        splitSparseMatrix(
-            num_row_blocks,
-            std::vector<CSRMatrix<Precision, index_type>>(num_col_blocks));
-
-    size_t row_block_size = num_rows / num_row_blocks;
-    size_t col_block_size = row_block_size;
-
-    // Add OpenMP support here later. Need to pay attention to
-    // race condition.
-    size_t current_global_row, current_global_col;
-    size_t block_row_id, block_col_id;
-    size_t local_row_id, local_col_id;
-    for (size_t row = 0; row < num_rows; row++) {
-        for (size_t col_idx = static_cast<size_t>(csrOffsets_ptr[row]);
-             col_idx < static_cast<size_t>(csrOffsets_ptr[row + 1]);
-             col_idx++) {
-
-            current_global_row = row;
-            current_global_col = columns_ptr[col_idx];
-            std::complex<Precision> current_val = values_ptr[col_idx];
-
-            block_row_id = current_global_row / row_block_size;
-            block_col_id = current_global_col / col_block_size;
-
-            local_row_id = current_global_row % row_block_size;
-            local_col_id = current_global_col % col_block_size;
-
-            if (splitSparseMatrix[block_row_id][block_col_id]
-                    .getCsrOffsets()
-                    .size() == 0) {
-                splitSparseMatrix[block_row_id][block_col_id].getCsrOffsets() =
-                    std::vector<index_type>(row_block_size + 1, 0);
-            }
-
-            splitSparseMatrix[block_row_id][block_col_id]
-                .getCsrOffsets()[local_row_id + 1]++;
-            splitSparseMatrix[block_row_id][block_col_id]
-                .getColumns()
-                .push_back(local_col_id);
-            splitSparseMatrix[block_row_id][block_col_id].getValues().push_back(
-                current_val);
-        }
-    }
-
-    // Add OpenMP support here later.
-    for (size_t block_row_id = 0; block_row_id < num_row_blocks;
-         block_row_id++) {
-        for (size_t block_col_id = 0; block_col_id < num_col_blocks;
-             block_col_id++) {
-            auto &localSpMat = splitSparseMatrix[block_row_id][block_col_id];
-            size_t local_csr_offset_size = localSpMat.getCsrOffsets().size();
-            for (size_t i0 = 1; i0 < local_csr_offset_size; i0++) {
-                localSpMat.getCsrOffsets()[i0] +=
-                    localSpMat.getCsrOffsets()[i0 - 1];
-            }
-        }
-    }
-
-    return splitSparseMatrix;
+    const size_t num_blocks = mpi_manager.getSize();
+    return partitionCSRMatrix<Precision, index_type>(
+        num_rows, num_rows / num_blocks, num_blocks, csrOffsets_ptr,
+        columns_ptr, values_ptr);
 }
 
 /**
@@ -214,4 +112,265 @@ auto scatterCSRMatrix(MPIManager &mpi_manager,
     }
     return localCSRMatrix;
 }
+/**
+ * @brief Scatter the rows of a global CSR (Compressed Sparse Row) format
+ * matrix, held by the root rank, so that each rank receives the rows of its
+ * local state vector segment. Row offsets are rebased to the local rows and
+ * column indices stay global.
+ *
+ * @tparam Precision Floating-point precision type.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param mpi_manager MPIManager object.
+ * @param local_num_rows Number of rows of each rank.
+ * @param csrOffsets_ptr Pointer to the array of row offsets of the global
+ * sparse matrix, read on the root rank only.
+ * @param columns_ptr Pointer to the array of column indices of the global
+ * sparse matrix, read on the root rank only.
+ * @param values_ptr Pointer to the array of the non-zero elements of the
+ * global sparse matrix, read on the root rank only.
+ * @param root Root rank of the scatter operation.
+ */
+template <class Precision, class index_type>
+auto scatterCSRMatrixRows(MPIManager &mpi_manager, size_t local_num_rows,
+                          const index_type *csrOffsets_ptr,
+                          const index_type *columns_ptr,
+                          const std::complex<Precision> *values_ptr,
+                          size_t root) -> CSRMatrix<Precision, index_type> {
+    const size_t num_ranks = mpi_manager.getSize();
+    const bool is_root = mpi_manager.getRank() == root;
+
+    std::vector<size_t> nnzs;
+    if (is_root) {
+        nnzs.reserve(num_ranks);
+        for (size_t k = 0; k < num_ranks; k++) {
+            nnzs.push_back(
+                static_cast<size_t>(csrOffsets_ptr[(k + 1) * local_num_rows] -
+                                    csrOffsets_ptr[k * local_num_rows]));
+        }
+    }
+    size_t local_nnz = mpi_manager.scatter<size_t>(nnzs, root)[0];
+
+    // Rows of rank k, with offsets rebased to its first row.
+    auto rows = [&](size_t k) {
+        const index_type *offsets = csrOffsets_ptr + k * local_num_rows;
+        const index_type begin = offsets[0];
+        const index_type end = offsets[local_num_rows];
+        CSRMatrix<Precision, index_type> block(local_num_rows, nnzs[k]);
+        std::copy(columns_ptr + begin, columns_ptr + end,
+                  block.getColumns().begin());
+        std::copy(values_ptr + begin, values_ptr + end,
+                  block.getValues().begin());
+        std::transform(offsets, offsets + local_num_rows + 1,
+                       block.getCsrOffsets().begin(),
+                       [begin](index_type offset) { return offset - begin; });
+        return block;
+    };
+
+    CSRMatrix<Precision, index_type> localCSRMatrix(local_num_rows, local_nnz);
+    if (is_root) {
+        localCSRMatrix = rows(root);
+    }
+    for (size_t k = 0; k < num_ranks; k++) {
+        if (k == root) {
+            continue;
+        }
+        if (is_root && nnzs[k]) {
+            auto block = rows(k);
+            mpi_manager.Send<std::complex<Precision>>(block.getValues(), k);
+            mpi_manager.Send<index_type>(block.getCsrOffsets(), k);
+            mpi_manager.Send<index_type>(block.getColumns(), k);
+        } else if (mpi_manager.getRank() == k && local_nnz) {
+            mpi_manager.Recv<std::complex<Precision>>(
+                localCSRMatrix.getValues(), root);
+            mpi_manager.Recv<index_type>(localCSRMatrix.getCsrOffsets(), root);
+            mpi_manager.Recv<index_type>(localCSRMatrix.getColumns(), root);
+        }
+    }
+    return localCSRMatrix;
+}
+
+/**
+ * @brief Build the local blocks of a global CSR (Compressed Sparse Row)
+ * format matrix without splitting it on the root rank. Each rank receives
+ * only the rows of its local state vector segment, see scatterCSRMatrixRows,
+ * and partitions them into column blocks itself, so that the root rank never
+ * holds more than the rows of one rank besides the global matrix.
+ *
+ * @tparam Precision Floating-point precision type.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param mpi_manager MPIManager object.
+ * @param local_num_rows Number of rows of each rank.
+ * @param csrOffsets_ptr Pointer to the array of row offsets of the global
+ * sparse matrix, read on the root rank only.
+ * @param columns_ptr Pointer to the array of column indices of the global
+ * sparse matrix, read on the root rank only.
+ * @param values_ptr Pointer to the array of the non-zero elements of the
+ * global sparse matrix, read on the root rank only.
+ * @param root Root rank of the scatter operation.
+ * @return auto Blocks of the rows of this rank, indexed by block column.
+ */
+template <class Precision, class index_type>
+auto scatterCSRMatrixBlocks(MPIManager &mpi_manager, size_t local_num_rows,
+                            const index_type *csrOffsets_ptr,
+                            const index_type *columns_ptr,
+                            const std::complex<Precision> *values_ptr,
+                            size_t root)
+    -> std::vector<CSRMatrix<Precision, index_type>> {
+    auto rows = scatterCSRMatrixRows<Precision, index_type>(
+        mpi_manager, local_num_rows, csrOffsets_ptr, columns_ptr, values_ptr,
+        root);
+    return std::move(partitionCSRMatrix<Precision, index_type>(
+        local_num_rows, local_num_rows, mpi_manager.getSize(),
+        rows.getCsrOffsets().data(), rows.getColumns().data(),
+        rows.getValues().data())[0]);
+}
+
+/**
+ * @brief Rows of a row-partitioned CSR (Compressed Sparse Row) format matrix
+ * owned by one rank, with the non-zero elements split between the columns
+ * of the local state vector segment and the halo, i.e. the remote amplitudes
+ * the rows reference.
+ *
+ * @tparam Precision Floating-point precision type.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ */
+template <class Precision, class index_type> struct HaloCSRMatrix {
+    /// Elements in local columns, with local column indices.
+    CSRMatrix<Precision, index_type> local;
+    /// Elements in remote columns, with column indices into the halo.
+    CSRMatrix<Precision, index_type> halo;
+    /// Global index of each halo amplitude, in increasing order.
+    std::vector<index_type> halo_columns;
+    /// Halo amplitudes owned by rank k are at [halo_offsets[k],
+    /// halo_offsets[k + 1]).
+    std::vector<size_t> halo_offsets;
+    /// Local indices of the amplitudes the other ranks need, grouped by rank.
+    std::vector<index_type> send_indices;
+    /// Amplitudes needed by rank k are at [send_offsets[k],
+    /// send_offsets[k + 1]) of send_indices.
+    std::vector<size_t> send_offsets;
+};
+
+/**
+ * @brief Split the rows owned by a rank into local and halo columns. The
+ * send lists are left empty, see exchangeHaloIndices.
+ *
+ * @tparam Precision Floating-point precision type.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param rows Rows of the rank, with global column indices.
+ * @param rank Rank owning the rows.
+ * @param num_ranks Number of ranks.
+ * @param local_num_rows Number of rows, and of amplitudes, of each rank.
+ */
+template <class Precision, class index_type>
+auto splitHaloCSRMatrix(CSRMatrix<Precision, index_type> &rows, size_t rank,
+                        size_t num_ranks, size_t local_num_rows)
+    -> HaloCSRMatrix<Precision, index_type> {
+    const auto &offsets = rows.getCsrOffsets();
+    const auto &columns = rows.getColumns();
+    const auto &values = rows.getValues();
+    const auto first = static_cast<index_type>(rank * local_num_rows);
+    const auto last = static_cast<index_type>((rank + 1) * local_num_rows);
+    auto is_local = [&](index_type col) { return col >= first && col < last; };
+
+    HaloCSRMatrix<Precision, index_type> matrix;
+    for (const auto col : columns) {
+        if (!is_local(col)) {
+            matrix.halo_columns.push_back(col);
+        }
+    }
+    std::sort(matrix.halo_columns.begin(), matrix.halo_columns.end());
+    matrix.halo_columns.erase(
+        std::unique(matrix.halo_columns.begin(), matrix.halo_columns.end()),
+        matrix.halo_columns.end());
+
+    matrix.halo_offsets.reserve(num_ranks + 1);
+    for (size_t k = 0; k <= num_ranks; k++) {
+        matrix.halo_offsets.push_back(static_cast<size_t>(
+            std::lower_bound(matrix.halo_columns.begin(),
+                             matrix.halo_columns.end(),
+                             static_cast<index_type>(k * local_num_rows)) -
+            matrix.halo_columns.begin()));
+    }
+
+    const size_t num_halo = columns.size() - std::count_if(columns.begin(),
+                                                           columns.end(),
+                                                           is_local);
+    matrix.local = CSRMatrix<Precision, index_type>(
+        local_num_rows, columns.size() - num_halo);
+    matrix.halo = CSRMatrix<Precision, index_type>(local_num_rows, num_halo);
+
+    size_t local_idx = 0;
+    size_t halo_idx = 0;
+    for (size_t row = 0; row < local_num_rows; row++) {
+        for (auto idx = static_cast<size_t>(offsets[row]);
+             idx < static_cast<size_t>(offsets[row + 1]); idx++) {
+            const index_type col = columns[idx];
+            if (is_local(col)) {
+                matrix.local.getColumns()[local_idx] = col - first;
+                matrix.local.getValues()[local_idx++] = values[idx];
+            } else {
+                matrix.halo.getColumns()[halo_idx] = static_cast<index_type>(
+                    std::lower_bound(matrix.halo_columns.begin(),
+                                     matrix.halo_columns.end(), col) -
+                    matrix.halo_columns.begin());
+                matrix.halo.getValues()[halo_idx++] = values[idx];
+            }
+        }
+        matrix.local.getCsrOffsets()[row + 1] =
+            static_cast<index_type>(local_idx);
+        matrix.halo.getCsrOffsets()[row + 1] =
+            static_cast<index_type>(halo_idx);
+    }
+    return matrix;
+}
+
+/**
+ * @brief Exchange the halo column lists, so that each rank knows which of
+ * its amplitudes the other ranks need. Fills the send lists of the matrix.
+ *
+ * Ranks pair up in P - 1 shifted rounds of MPI_Sendrecv, so that no
+ * collective over the halos is needed.
+ *
+ * @tparam Precision Floating-point precision type.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param mpi_manager MPIManager object.
+ * @param matrix Halo matrix of the rank, see splitHaloCSRMatrix.
+ * @param local_num_rows Number of rows, and of amplitudes, of each rank.
+ */
+template <class Precision, class index_type>
+void exchangeHaloIndices(MPIManager &mpi_manager,
+                         HaloCSRMatrix<Precision, index_type> &matrix,
+                         size_t local_num_rows) {
+    const size_t rank = mpi_manager.getRank();
+    const size_t num_ranks = mpi_manager.getSize();
+
+    std::vector<std::vector<index_type>> requests(num_ranks);
+    for (size_t shift = 1; shift < num_ranks; shift++) {
+        const size_t dest = (rank + shift) % num_ranks;
+        const size_t source = (rank + num_ranks - shift) % num_ranks;
+
+        std::vector<index_type> wanted(
+            matrix.halo_columns.begin() + matrix.halo_offsets[dest],
+            matrix.halo_columns.begin() + matrix.halo_offsets[dest + 1]);
+        for (auto &col : wanted) {
+            col -= static_cast<index_type>(dest * local_num_rows);
+        }
+        size_t num_wanted = wanted.size();
+        size_t num_requested = 0;
+        mpi_manager.Sendrecv<size_t>(num_wanted, dest, num_requested, source);
+
+        requests[source].resize(num_requested);
+        mpi_manager.Sendrecv<index_type>(wanted, dest, requests[source],
+                                         source);
+    }
+
+    matrix.send_indices.clear();
+    matrix.send_offsets.assign(1, 0);
+    for (const auto &request : requests) {
+        matrix.send_indices.insert(matrix.send_indices.end(), request.begin(),
+                                   request.end());
+        matrix.send_offsets.push_back(matrix.send_indices.size());
+    }
+}
 } // namespace Pennylane::MPI
\ No newline at end of file
@@ -0,0 +1,217 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CSRPartition.hpp
+ * Host CSR matrices and their partition into square blocks, for distributed
+ * sparse matrix-vector products. This file has no CUDA or MPI dependencies.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include "Error.hpp"
+
+namespace Pennylane::MPI {
+/**
+ * @brief Manage memory of Compressed Sparse Row (CSR) sparse matrix. CSR format
+ * represents a matrix M by three (one-dimensional) arrays, that respectively
+ * contain nonzero values, row offsets, and column indices.
+ *
+ * @tparam Precision Floating-point precision type.
+ * @tparam index_type Integer type.
+ */
+template <class Precision, class index_type> class CSRMatrix {
+  private:
+    std::vector<index_type> columns_;
+    std::vector<index_type> csrOffsets_;
+    std::vector<std::complex<Precision>> values_;
+
+  public:
+    CSRMatrix(size_t num_rows, size_t nnz)
+        : columns_(nnz, 0), csrOffsets_(num_rows + 1, 0), values_(nnz){};
+
+    CSRMatrix(size_t num_rows, size_t nnz, index_type *column_ptr,
+              index_type *csrOffsets_ptr, std::complex<Precision> *value_ptr)
+        : columns_(column_ptr, column_ptr + nnz),
+          csrOffsets_(csrOffsets_ptr, csrOffsets_ptr + num_rows + 1),
+          values_(value_ptr, value_ptr + nnz){};
+
+    CSRMatrix() = default;
+
+    /**
+     * @brief Get the CSR format index vector of the matrix.
+     */
+    auto getColumns() -> std::vector<index_type> & { return columns_; }
+
+    /**
+     * @brief Get CSR format offset vector of the matrix.
+     */
+    auto getCsrOffsets() -> std::vector<index_type> & { return csrOffsets_; }
+
+    /**
+     * @brief Get CSR format data vector of the matrix.
+     */
+    auto getValues() -> std::vector<std::complex<Precision>> & {
+        return values_;
+    }
+};
+
+/**
+ * @brief Partition the rows of a CSR (Compressed Sparse Row) format matrix
+ * into square blocks of `block_size` rows and columns.
+ *
+ * The rows may be a row range of a larger matrix: the offsets index the
+ * column and value arrays directly and need not start at zero. The partition
+ * takes two passes over the non-zero elements, parallelized over rows with
+ * OpenMP. The first pass counts the elements of each block and of each of its
+ * rows, so that every block is allocated exactly once, and the second one
+ * fills the blocks. Blocks without non-zero elements are left empty, without
+ * row offsets.
+ *
+ * @tparam Precision Floating-point precision type.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param num_rows Number of rows to partition, a multiple of `block_size`.
+ * @param block_size Number of rows and columns of each block.
+ * @param num_col_blocks Number of blocks along the columns.
+ * @param csrOffsets_ptr Pointer to the array of row offsets, of size
+ * num_rows + 1.
+ * @param columns_ptr Pointer to the array of column indices.
+ * @param values_ptr Pointer to the array of the non-zero elements.
+ * @return auto Blocks indexed by block row, then by block column.
+ */
+template <class Precision, class index_type>
+auto partitionCSRMatrix(size_t num_rows, size_t block_size,
+                        size_t num_col_blocks, const index_type *csrOffsets_ptr,
+                        const index_type *columns_ptr,
+                        const std::complex<Precision> *values_ptr)
+    -> std::vector<std::vector<CSRMatrix<Precision, index_type>>> {
+    PL_ABORT_IF(block_size == 0 || num_rows % block_size != 0,
+                "The number of rows must be a multiple of the block size");
+    const size_t num_row_blocks = num_rows / block_size;
+    const size_t num_blocks = num_row_blocks * num_col_blocks;
+
+    std::vector<std::vector<CSRMatrix<Precision, index_type>>> blocks(
+        num_row_blocks,
+        std::vector<CSRMatrix<Precision, index_type>>(num_col_blocks));
+
+    // Count pass: non-zero elements of each block.
+    std::vector<size_t> block_nnz(num_blocks, 0);
+#if defined(_OPENMP)
+#pragma omp parallel default(none)                                             \
+    shared(block_nnz, csrOffsets_ptr, columns_ptr, num_rows, block_size,       \
+           num_col_blocks, num_blocks)
+#endif
+    {
+        std::vector<size_t> local_nnz(num_blocks, 0);
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+        for (size_t row = 0; row < num_rows; row++) {
+            const size_t block_row = row / block_size;
+            for (auto idx = static_cast<size_t>(csrOffsets_ptr[row]);
+                 idx < static_cast<size_t>(csrOffsets_ptr[row + 1]); idx++) {
+                const auto col = static_cast<size_t>(columns_ptr[idx]);
+                local_nnz[block_row * num_col_blocks + col / block_size]++;
+            }
+        }
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+        for (size_t block = 0; block < num_blocks; block++) {
+            block_nnz[block] += local_nnz[block];
+        }
+    }
+
+    for (size_t block_row = 0; block_row < num_row_blocks; block_row++) {
+        for (size_t block_col = 0; block_col < num_col_blocks; block_col++) {
+            const size_t nnz =
+                block_nnz[block_row * num_col_blocks + block_col];
+            if (nnz != 0) {
+                blocks[block_row][block_col] =
+                    CSRMatrix<Precision, index_type>(block_size, nnz);
+            }
+        }
+    }
+
+    // Count pass: non-zero elements of each row of each block. Each row
+    // writes its own offset entries.
+#if defined(_OPENMP)
+#pragma omp parallel for default(none)                                         \
+    shared(blocks, csrOffsets_ptr, columns_ptr, num_rows, block_size)
+#endif
+    for (size_t row = 0; row < num_rows; row++) {
+        auto &block_row = blocks[row / block_size];
+        const size_t local_row = row % block_size;
+        for (auto idx = static_cast<size_t>(csrOffsets_ptr[row]);
+             idx < static_cast<size_t>(csrOffsets_ptr[row + 1]); idx++) {
+            const auto col = static_cast<size_t>(columns_ptr[idx]);
+            block_row[col / block_size].getCsrOffsets()[local_row + 1]++;
+        }
+    }
+
+#if defined(_OPENMP)
+#pragma omp parallel for default(none)                                         \
+    shared(blocks, num_col_blocks, num_blocks)
+#endif
+    for (size_t block = 0; block < num_blocks; block++) {
+        auto &offsets =
+            blocks[block / num_col_blocks][block % num_col_blocks]
+                .getCsrOffsets();
+        for (size_t i = 1; i < offsets.size(); i++) {
+            offsets[i] += offsets[i - 1];
+        }
+    }
+
+    // Fill pass: each row writes its own range of every block.
+#if defined(_OPENMP)
+#pragma omp parallel default(none)                                             \
+    shared(blocks, csrOffsets_ptr, columns_ptr, values_ptr, num_rows,          \
+           block_size, num_col_blocks)
+#endif
+    {
+        std::vector<size_t> cursor(num_col_blocks);
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+        for (size_t row = 0; row < num_rows; row++) {
+            auto &block_row = blocks[row / block_size];
+            const size_t local_row = row % block_size;
+            for (size_t block_col = 0; block_col < num_col_blocks;
+                 block_col++) {
+                auto &offsets = block_row[block_col].getCsrOffsets();
+                cursor[block_col] = offsets.empty() ? 0 : offsets[local_row];
+            }
+            for (auto idx = static_cast<size_t>(csrOffsets_ptr[row]);
+                 idx < static_cast<size_t>(csrOffsets_ptr[row + 1]); idx++) {
+                const auto col = static_cast<size_t>(columns_ptr[idx]);
+                const size_t block_col = col / block_size;
+                auto &block = block_row[block_col];
+                const size_t pos = cursor[block_col]++;
+                block.getColumns()[pos] =
+                    static_cast<index_type>(col % block_size);
+                block.getValues()[pos] = values_ptr[idx];
+            }
+        }
+    }
+    return blocks;
+}
+
+} // namespace Pennylane::MPI
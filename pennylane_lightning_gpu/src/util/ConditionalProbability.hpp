@@ -0,0 +1,75 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ConditionalProbability.hpp
+ * Host-side helpers for marginal probabilities conditioned on the values of
+ * other wires. This file has no CUDA dependencies.
+ */
+#pragma once
+
+#include <cstddef>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Check the arguments of a conditional probability: the condition
+ * gives one bit per condition wire, and no wire appears twice.
+ *
+ * @param num_qubits Number of qubits of the state vector.
+ * @param wires Wires whose probabilities are computed.
+ * @param condition_wires Wires whose values are fixed.
+ * @param condition_bits Value, 0 or 1, of each condition wire.
+ */
+inline void checkCondition(std::size_t num_qubits,
+                           const std::vector<std::size_t> &wires,
+                           const std::vector<std::size_t> &condition_wires,
+                           const std::vector<std::size_t> &condition_bits) {
+    PL_ABORT_IF_NOT(condition_wires.size() == condition_bits.size(),
+                    "Incompatible number of condition wires and bits");
+    std::unordered_set<std::size_t> seen;
+    for (const auto w : wires) {
+        PL_ABORT_IF(w >= num_qubits, "Invalid wire index");
+        PL_ABORT_IF_NOT(seen.insert(w).second, "Wires must be unique");
+    }
+    for (std::size_t k = 0; k < condition_wires.size(); k++) {
+        PL_ABORT_IF(condition_wires[k] >= num_qubits, "Invalid wire index");
+        PL_ABORT_IF_NOT(seen.insert(condition_wires[k]).second,
+                        "Wires must be unique");
+        PL_ABORT_IF(condition_bits[k] > 1, "Condition bits must be 0 or 1");
+    }
+}
+
+/**
+ * @brief Divide the joint probabilities of the wires and the condition by
+ * the probability of the condition.
+ *
+ * @param probabilities Joint probabilities, normalized in place.
+ */
+inline void normalizeConditional(std::vector<double> &probabilities) {
+    const double condition_probability =
+        std::accumulate(probabilities.begin(), probabilities.end(), 0.0);
+    PL_ABORT_IF_NOT(condition_probability > 0.0,
+                    "The condition has zero probability");
+    for (auto &p : probabilities) {
+        p /= condition_probability;
+    }
+}
+
+} // namespace Pennylane::CUDA::Util
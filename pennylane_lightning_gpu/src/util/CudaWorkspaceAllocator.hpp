@@ -0,0 +1,80 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CudaWorkspaceAllocator.hpp
+ * Device allocators backing `WorkspaceArena`.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include "DevTag.hpp"
+#include "WorkspaceArena.hpp"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Device allocator using `cudaMalloc` and `cudaFree`.
+ */
+class CudaWorkspaceAllocator final : public WorkspaceAllocator {
+  private:
+    DevTag<int> dev_tag_;
+
+  public:
+    explicit CudaWorkspaceAllocator(const DevTag<int> &dev_tag)
+        : dev_tag_{dev_tag} {}
+
+    auto allocate(std::size_t bytes) -> void * override {
+        void *ptr = nullptr;
+        dev_tag_.refresh();
+        PL_CUDA_IS_SUCCESS(cudaMalloc(&ptr, bytes));
+        return ptr;
+    }
+    void deallocate(void *ptr, [[maybe_unused]] std::size_t bytes) override {
+        PL_CUDA_IS_SUCCESS(cudaFree(ptr));
+    }
+};
+
+/**
+ * @brief Stream-ordered device allocator using `cudaMallocAsync` and
+ * `cudaFreeAsync` on the stream of the given device tag. Freed blocks return
+ * to the memory pool of the device rather than to the driver, so regrowing
+ * the workspace does not synchronize the device.
+ */
+class CudaAsyncWorkspaceAllocator final : public WorkspaceAllocator {
+  private:
+    DevTag<int> dev_tag_;
+
+  public:
+    explicit CudaAsyncWorkspaceAllocator(const DevTag<int> &dev_tag)
+        : dev_tag_{dev_tag} {}
+
+    auto allocate(std::size_t bytes) -> void * override {
+        void *ptr = nullptr;
+        dev_tag_.refresh();
+        PL_CUDA_IS_SUCCESS(
+            cudaMallocAsync(&ptr, bytes, dev_tag_.getStreamID()));
+        return ptr;
+    }
+    void deallocate(void *ptr, [[maybe_unused]] std::size_t bytes) override {
+        PL_CUDA_IS_SUCCESS(cudaFreeAsync(ptr, dev_tag_.getStreamID()));
+    }
+};
+
+} // namespace Pennylane::CUDA::Util
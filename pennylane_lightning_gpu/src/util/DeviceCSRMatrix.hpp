@@ -0,0 +1,293 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeviceCSRMatrix.hpp
+ * Device-resident CSR matrices with their cuSPARSE descriptor, and a
+ * per-device cache of uploads of one host matrix.
+ */
+#pragma once
+
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <cusparse.h>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief CSR matrix uploaded to a device, with its cuSPARSE descriptor.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @tparam IdxT Index type, `int32_t` or `int64_t`.
+ */
+template <class PrecisionT, class IdxT> class DeviceCSRMatrix {
+  public:
+    using CFP_t = decltype(getCudaType(PrecisionT{}));
+
+    /**
+     * @brief Upload a host CSR matrix to the device of `dev_tag`.
+     *
+     * @param offsets_ptr Row offsets, of length `num_offsets`.
+     * @param num_offsets Number of row offsets, i.e. number of rows plus one.
+     * @param columns_ptr Column index of each non-zero element.
+     * @param values_ptr Value of each non-zero element.
+     * @param nnz Number of non-zero elements.
+     * @param dev_tag Device and stream of the copies.
+     */
+    DeviceCSRMatrix(const IdxT *offsets_ptr, std::size_t num_offsets,
+                    const IdxT *columns_ptr,
+                    const std::complex<PrecisionT> *values_ptr,
+                    std::size_t nnz, const DevTag<int> &dev_tag)
+        : DeviceCSRMatrix(offsets_ptr, num_offsets, columns_ptr, values_ptr,
+                          nnz, num_offsets - 1, dev_tag) {}
+
+    /**
+     * @brief Upload a rectangular host CSR matrix to the device of
+     * `dev_tag`.
+     *
+     * @param offsets_ptr Row offsets, of length `num_offsets`.
+     * @param num_offsets Number of row offsets, i.e. number of rows plus one.
+     * @param columns_ptr Column index of each non-zero element.
+     * @param values_ptr Value of each non-zero element.
+     * @param nnz Number of non-zero elements.
+     * @param num_cols Number of columns.
+     * @param dev_tag Device and stream of the copies.
+     */
+    DeviceCSRMatrix(const IdxT *offsets_ptr, std::size_t num_offsets,
+                    const IdxT *columns_ptr,
+                    const std::complex<PrecisionT> *values_ptr,
+                    std::size_t nnz, std::size_t num_cols,
+                    const DevTag<int> &dev_tag)
+        : offsets_{num_offsets, dev_tag, true}, columns_{nnz, dev_tag, true},
+          values_{nnz, dev_tag, true}, num_cols_{num_cols} {
+        PL_ABORT_IF(num_offsets == 0, "The row offsets must not be empty");
+        offsets_.CopyHostDataToGpu(offsets_ptr, num_offsets);
+        columns_.CopyHostDataToGpu(columns_ptr, nnz);
+        values_.CopyHostDataToGpu(values_ptr, nnz);
+
+        cudaDataType_t data_type;
+        cusparseIndexType_t index_type;
+        if constexpr (std::is_same_v<PrecisionT, double>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+        if constexpr (sizeof(IdxT) == sizeof(int64_t)) {
+            index_type = CUSPARSE_INDEX_64I;
+        } else {
+            index_type = CUSPARSE_INDEX_32I;
+        }
+
+        const auto num_rows = static_cast<int64_t>(getNumRows());
+        // Create sparse matrix descriptor in CSR format
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
+            /* cusparseSpMatDescr_t* */ &descriptor_,
+            /* int64_t */ num_rows,
+            /* int64_t */ static_cast<int64_t>(num_cols_),
+            /* int64_t */ static_cast<int64_t>(getNumNonZeros()),
+            /* void* */ offsets_.getData(),
+            /* void* */ columns_.getData(),
+            /* void* */ values_.getData(),
+            /* cusparseIndexType_t */ index_type,
+            /* cusparseIndexType_t */ index_type,
+            /* cusparseIndexBase_t */ CUSPARSE_INDEX_BASE_ZERO,
+            /* cudaDataType */ data_type));
+    }
+
+    /**
+     * @brief Upload a host CSR matrix to the device of `dev_tag`.
+     *
+     * @param offsets Row offsets, of length `num_rows + 1`.
+     * @param columns Column index of each non-zero element.
+     * @param values Value of each non-zero element.
+     * @param dev_tag Device and stream of the copies.
+     */
+    DeviceCSRMatrix(const std::vector<IdxT> &offsets,
+                    const std::vector<IdxT> &columns,
+                    const std::vector<std::complex<PrecisionT>> &values,
+                    const DevTag<int> &dev_tag)
+        : DeviceCSRMatrix(offsets.data(), offsets.size(),
+                          checkedColumns(columns, values.size()),
+                          values.data(), values.size(), dev_tag) {}
+
+    /**
+     * @brief Upload a rectangular host CSR matrix to the device of
+     * `dev_tag`.
+     *
+     * @param offsets Row offsets, of length `num_rows + 1`.
+     * @param columns Column index of each non-zero element.
+     * @param values Value of each non-zero element.
+     * @param num_cols Number of columns.
+     * @param dev_tag Device and stream of the copies.
+     */
+    DeviceCSRMatrix(const std::vector<IdxT> &offsets,
+                    const std::vector<IdxT> &columns,
+                    const std::vector<std::complex<PrecisionT>> &values,
+                    std::size_t num_cols, const DevTag<int> &dev_tag)
+        : DeviceCSRMatrix(offsets.data(), offsets.size(),
+                          checkedColumns(columns, values.size()),
+                          values.data(), values.size(), num_cols, dev_tag) {}
+
+    DeviceCSRMatrix(const DeviceCSRMatrix &) = delete;
+    DeviceCSRMatrix(DeviceCSRMatrix &&) = delete;
+    DeviceCSRMatrix &operator=(const DeviceCSRMatrix &) = delete;
+    DeviceCSRMatrix &operator=(DeviceCSRMatrix &&) = delete;
+
+    ~DeviceCSRMatrix() {
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(descriptor_));
+    }
+
+    [[nodiscard]] auto getDescriptor() const -> cusparseSpMatDescr_t {
+        return descriptor_;
+    }
+    [[nodiscard]] auto getNumRows() const -> std::size_t {
+        return offsets_.getLength() - 1;
+    }
+    [[nodiscard]] auto getNumCols() const -> std::size_t { return num_cols_; }
+    [[nodiscard]] auto getNumNonZeros() const -> std::size_t {
+        return values_.getLength();
+    }
+    [[nodiscard]] auto getDevTag() const -> const DevTag<int> & {
+        return values_.getDevTag();
+    }
+
+    /**
+     * @brief Device memory held by the matrix, in bytes.
+     */
+    [[nodiscard]] auto getBytes() const -> std::size_t {
+        return offsets_.getLength() * sizeof(IdxT) +
+               columns_.getLength() * sizeof(IdxT) +
+               values_.getLength() * sizeof(CFP_t);
+    }
+
+  private:
+    static auto checkedColumns(const std::vector<IdxT> &columns,
+                               std::size_t nnz) -> const IdxT * {
+        PL_ABORT_IF_NOT(columns.size() == nnz,
+                        "The number of columns and values must match");
+        return columns.data();
+    }
+
+    DataBuffer<IdxT, int> offsets_;
+    DataBuffer<IdxT, int> columns_;
+    DataBuffer<CFP_t, int> values_;
+    std::size_t num_cols_;
+    cusparseSpMatDescr_t descriptor_{nullptr};
+};
+
+/**
+ * @brief Reuse statistics of a `DeviceCSRCache`.
+ */
+struct DeviceCSRCacheStats {
+    /// Number of uploads, i.e. of devices the matrix was requested on.
+    std::size_t num_uploads{0};
+    /// Number of requests served by an existing upload.
+    std::size_t num_reuses{0};
+    /// Bytes copied to devices.
+    std::size_t bytes_uploaded{0};
+    /// Bytes that would have been copied without the cache.
+    std::size_t bytes_saved{0};
+    /// Time spent uploading, in seconds.
+    double upload_seconds{0};
+    /// Upload time avoided by reusing uploads, in seconds.
+    double seconds_saved{0};
+};
+
+/**
+ * @brief Lazily created device copies of one host CSR matrix, one per
+ * device. Requests are thread-safe.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @tparam IdxT Index type, `int32_t` or `int64_t`.
+ */
+template <class PrecisionT, class IdxT> class DeviceCSRCache {
+  public:
+    using MatrixT = DeviceCSRMatrix<PrecisionT, IdxT>;
+
+    /**
+     * @brief Get the copy of the matrix on the device of `dev_tag`,
+     * uploading it on first use.
+     *
+     * @param offsets Row offsets of the host matrix.
+     * @param columns Column indices of the host matrix.
+     * @param values Values of the host matrix.
+     * @param dev_tag Device and stream used for the upload.
+     * @return const MatrixT& Device matrix, valid until `clear` is called.
+     */
+    auto get(const std::vector<IdxT> &offsets,
+             const std::vector<IdxT> &columns,
+             const std::vector<std::complex<PrecisionT>> &values,
+             const DevTag<int> &dev_tag) -> const MatrixT & {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (const auto it = matrices_.find(dev_tag.getDeviceID());
+            it != matrices_.end()) {
+            stats_.num_reuses++;
+            stats_.bytes_saved += it->second.matrix->getBytes();
+            stats_.seconds_saved += it->second.upload_seconds;
+            return *it->second.matrix;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        auto matrix =
+            std::make_unique<MatrixT>(offsets, columns, values, dev_tag);
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        stats_.num_uploads++;
+        stats_.bytes_uploaded += matrix->getBytes();
+        stats_.upload_seconds += elapsed.count();
+        const auto &entry =
+            matrices_
+                .emplace(dev_tag.getDeviceID(),
+                         Entry{std::move(matrix), elapsed.count()})
+                .first->second;
+        return *entry.matrix;
+    }
+
+    [[nodiscard]] auto getStats() const -> DeviceCSRCacheStats {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    /**
+     * @brief Release all device copies. The statistics are kept.
+     */
+    void clear() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        matrices_.clear();
+    }
+
+  private:
+    struct Entry {
+        std::unique_ptr<MatrixT> matrix;
+        double upload_seconds;
+    };
+    mutable std::mutex mutex_;
+    std::unordered_map<int, Entry> matrices_;
+    DeviceCSRCacheStats stats_;
+};
+
+} // namespace Pennylane::CUDA::Util
@@ -0,0 +1,196 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiagonalPhase.hpp
+ * Phase-polynomial representation of a product of diagonal gates. This file
+ * has no CUDA dependencies.
+ */
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Whether a gate is diagonal in the computational basis and can be
+ * added to a DiagonalPhase.
+ */
+inline auto isDiagonalGate(const std::string &opName) -> bool {
+    static const std::unordered_set<std::string> diagonal_gates{
+        "Identity", "PauliZ",     "S",  "T",
+        "RZ",       "PhaseShift", "CZ", "CRZ",
+        "ControlledPhaseShift",   "IsingZZ",
+        "MultiRZ"};
+    return diagonal_gates.find(opName) != diagonal_gates.end();
+}
+
+/**
+ * @brief Product of diagonal gates, stored as the phase polynomial
+ *
+ * phase(i) = sum_t angles[t] * (-1)^popcount(i & z_masks[t]),
+ *
+ * so that the product maps the amplitude of basis state `i` to
+ * `exp(1j * phase(i))` times itself. Every diagonal gate of
+ * `isDiagonalGate` adds at most four terms, and terms sharing a Z mask are
+ * merged, so a layer of `IsingZZ` gates on `p` edges has at most `p` terms.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> class DiagonalPhase {
+  public:
+    [[nodiscard]] auto getNumTerms() const -> std::size_t {
+        return z_masks_.size();
+    }
+    [[nodiscard]] auto getZMasks() const
+        -> const std::vector<std::uint64_t> & {
+        return z_masks_;
+    }
+    [[nodiscard]] auto getAngles() const -> const std::vector<PrecisionT> & {
+        return angles_;
+    }
+    /**
+     * @brief Number of gates added since construction or the last `clear`.
+     */
+    [[nodiscard]] auto getNumGates() const -> std::size_t {
+        return num_gates_;
+    }
+
+    /**
+     * @brief Add `angle * (-1)^popcount(i & z_mask)` to the phase.
+     */
+    void addTerm(std::uint64_t z_mask, PrecisionT angle) {
+        const auto [it, inserted] =
+            term_index_.emplace(z_mask, angles_.size());
+        if (inserted) {
+            z_masks_.push_back(z_mask);
+            angles_.push_back(angle);
+        } else {
+            angles_[it->second] += angle;
+        }
+    }
+
+    /**
+     * @brief Multiply by a diagonal gate.
+     *
+     * @param opName Gate name, for which `isDiagonalGate` holds.
+     * @param bits Index bit of each wire of the gate, controls first.
+     * @param param Gate parameter, ignored by non-parametric gates.
+     * @param adjoint Apply the adjoint of the gate.
+     */
+    void addGate(const std::string &opName,
+                 const std::vector<std::size_t> &bits, PrecisionT param,
+                 bool adjoint) {
+        PL_ABORT_IF_NOT(isDiagonalGate(opName), "Gate is not diagonal");
+        std::uint64_t all_bits = 0;
+        for (const auto b : bits) {
+            PL_ABORT_IF(b >= 64, "Diagonal phases support up to 64 qubits");
+            PL_ABORT_IF(all_bits & (std::uint64_t{1} << b),
+                        "Wires must be unique");
+            all_bits |= std::uint64_t{1} << b;
+        }
+        const PrecisionT sign = adjoint ? -1 : 1;
+        const auto mask = [&](std::size_t k) {
+            return std::uint64_t{1} << bits[k];
+        };
+        const auto requireWires = [&](std::size_t num_wires) {
+            PL_ABORT_IF_NOT(bits.size() == num_wires,
+                            "Invalid number of wires");
+        };
+        // exp(1j * phi) on |1>, i.e. phi / 2 * (1 - (-1)^x).
+        const auto phaseShift = [&](PrecisionT phi) {
+            requireWires(1);
+            addTerm(0, sign * phi / 2);
+            addTerm(mask(0), -sign * phi / 2);
+        };
+        // exp(1j * phi) on |11>, i.e. phi / 4 * (1 - z_a)(1 - z_b).
+        const auto controlledPhaseShift = [&](PrecisionT phi) {
+            requireWires(2);
+            addTerm(0, sign * phi / 4);
+            addTerm(mask(0), -sign * phi / 4);
+            addTerm(mask(1), -sign * phi / 4);
+            addTerm(mask(0) | mask(1), sign * phi / 4);
+        };
+
+        constexpr PrecisionT pi = static_cast<PrecisionT>(M_PI);
+        if (opName == "PauliZ") {
+            phaseShift(pi);
+        } else if (opName == "S") {
+            phaseShift(pi / 2);
+        } else if (opName == "T") {
+            phaseShift(pi / 4);
+        } else if (opName == "PhaseShift") {
+            phaseShift(param);
+        } else if (opName == "RZ") {
+            requireWires(1);
+            addTerm(mask(0), -sign * param / 2);
+        } else if (opName == "CZ") {
+            controlledPhaseShift(pi);
+        } else if (opName == "ControlledPhaseShift") {
+            controlledPhaseShift(param);
+        } else if (opName == "CRZ") {
+            // RZ on the target if the control is |1>.
+            requireWires(2);
+            addTerm(mask(1), -sign * param / 4);
+            addTerm(mask(0) | mask(1), sign * param / 4);
+        } else if (opName == "IsingZZ") {
+            requireWires(2);
+            addTerm(all_bits, -sign * param / 2);
+        } else if (opName == "MultiRZ") {
+            PL_ABORT_IF(bits.empty(), "Invalid number of wires");
+            addTerm(all_bits, -sign * param / 2);
+        }
+        num_gates_++;
+    }
+
+    /**
+     * @brief Phase of a basis state, i.e. the CPU reference of the phase
+     * polynomial.
+     */
+    [[nodiscard]] auto getPhase(std::uint64_t index) const -> PrecisionT {
+        PrecisionT phase = 0;
+        for (std::size_t t = 0; t < z_masks_.size(); t++) {
+            const bool odd = std::popcount(index & z_masks_[t]) & 1U;
+            phase += odd ? -angles_[t] : angles_[t];
+        }
+        return phase;
+    }
+
+    /**
+     * @brief Reset to the identity.
+     */
+    void clear() {
+        z_masks_.clear();
+        angles_.clear();
+        term_index_.clear();
+        num_gates_ = 0;
+    }
+
+  private:
+    std::vector<std::uint64_t> z_masks_;
+    std::vector<PrecisionT> angles_;
+    std::unordered_map<std::uint64_t, std::size_t> term_index_;
+    std::size_t num_gates_{0};
+};
+
+} // namespace Pennylane::CUDA::Util
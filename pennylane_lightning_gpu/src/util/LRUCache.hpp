@@ -0,0 +1,241 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LRUCache.hpp
+ * Device-agnostic byte-bounded cache with least-recently-used eviction.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Byte-bounded key-value cache with least-recently-used eviction.
+ *
+ * Every entry is inserted together with the number of bytes it accounts
+ * for. Once the total exceeds the budget, unpinned entries are evicted from
+ * the least-recently-used end until the new entry fits. Pinned entries are
+ * never evicted, and an entry larger than the budget is still inserted after
+ * evicting every unpinned entry. Values are constructed in place and never
+ * moved, so the cache also supports non-movable resource types.
+ *
+ * @tparam Key Key type.
+ * @tparam Value Value type.
+ * @tparam Hash Hash function for `Key`.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class LRUCache {
+  private:
+    struct Entry {
+        Value value;
+        std::size_t bytes;
+        bool pinned;
+        typename std::list<Key>::iterator order_it;
+
+        template <class... Args>
+        Entry(std::size_t bytes_in, bool pinned_in, Args &&...args)
+            : value(std::forward<Args>(args)...), bytes{bytes_in},
+              pinned{pinned_in} {}
+    };
+
+    std::size_t max_bytes_;
+    std::size_t total_bytes_{0};
+    std::size_t hits_{0};
+    std::size_t misses_{0};
+    std::size_t evictions_{0};
+
+    // Most-recently-used key at the front.
+    std::list<Key> order_;
+    std::unordered_map<Key, Entry, Hash> entries_;
+
+    void touch(Entry &entry) {
+        order_.splice(order_.begin(), order_, entry.order_it);
+    }
+
+    /**
+     * @brief Evict least-recently-used unpinned entries until `bytes`
+     * additional bytes fit in the budget, or no unpinned entry is left.
+     */
+    void makeRoom(std::size_t bytes) {
+        if (max_bytes_ == 0) {
+            return;
+        }
+        auto it = order_.end();
+        while (total_bytes_ + bytes > max_bytes_ && it != order_.begin()) {
+            --it;
+            auto entry_it = entries_.find(*it);
+            if (entry_it->second.pinned) {
+                continue;
+            }
+            total_bytes_ -= entry_it->second.bytes;
+            entries_.erase(entry_it);
+            it = order_.erase(it);
+            ++evictions_;
+        }
+    }
+
+  public:
+    /**
+     * @brief Construct a new cache.
+     *
+     * @param max_bytes Byte budget of the cache. `0` disables eviction.
+     */
+    explicit LRUCache(std::size_t max_bytes = 0) : max_bytes_{max_bytes} {}
+
+    LRUCache(const LRUCache &) = delete;
+    LRUCache(LRUCache &&) = delete;
+    LRUCache &operator=(const LRUCache &) = delete;
+    LRUCache &operator=(LRUCache &&) = delete;
+    ~LRUCache() = default;
+
+    /**
+     * @brief Check whether a key is cached without affecting the statistics
+     * or the eviction order.
+     */
+    [[nodiscard]] bool contains(const Key &key) const {
+        return entries_.find(key) != entries_.end();
+    }
+
+    /**
+     * @brief Look up a key, recording a hit or a miss. A hit marks the entry
+     * as most-recently-used.
+     *
+     * @return Value* Pointer to the cached value, or `nullptr` on a miss.
+     */
+    auto find(const Key &key) -> Value * {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            ++misses_;
+            return nullptr;
+        }
+        ++hits_;
+        touch(it->second);
+        return &it->second.value;
+    }
+
+    /**
+     * @brief Access a cached value and mark it as most-recently-used, without
+     * recording a hit.
+     */
+    auto at(const Key &key) -> Value & {
+        auto it = entries_.find(key);
+        PL_ABORT_IF(it == entries_.end(), "Key not found in the cache.");
+        touch(it->second);
+        return it->second.value;
+    }
+
+    /**
+     * @brief Construct a value in place for the given key, evicting entries as
+     * needed. An existing entry with the same key is replaced.
+     *
+     * @param key Key of the new entry.
+     * @param bytes Number of bytes accounted for the entry.
+     * @param pinned Pinned entries are never evicted.
+     * @param args Arguments forwarded to the constructor of `Value`.
+     * @return Value& Reference to the newly inserted value.
+     */
+    template <class... Args>
+    auto emplace(const Key &key, std::size_t bytes, bool pinned,
+                 Args &&...args) -> Value & {
+        erase(key);
+        makeRoom(bytes);
+        auto [it, inserted] = entries_.emplace(
+            std::piecewise_construct, std::forward_as_tuple(key),
+            std::forward_as_tuple(bytes, pinned, std::forward<Args>(args)...));
+        static_cast<void>(inserted);
+        order_.push_front(key);
+        it->second.order_it = order_.begin();
+        total_bytes_ += bytes;
+        return it->second.value;
+    }
+
+    /**
+     * @brief Remove an entry, regardless of whether it is pinned.
+     *
+     * @return true if an entry was removed.
+     */
+    bool erase(const Key &key) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return false;
+        }
+        total_bytes_ -= it->second.bytes;
+        order_.erase(it->second.order_it);
+        entries_.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Remove all entries. The statistics are preserved.
+     *
+     * @param keep_pinned Keep the pinned entries.
+     */
+    void clear(bool keep_pinned = false) {
+        if (!keep_pinned) {
+            entries_.clear();
+            order_.clear();
+            total_bytes_ = 0;
+            return;
+        }
+        for (auto it = order_.begin(); it != order_.end();) {
+            auto entry_it = entries_.find(*it);
+            if (entry_it->second.pinned) {
+                ++it;
+                continue;
+            }
+            total_bytes_ -= entry_it->second.bytes;
+            entries_.erase(entry_it);
+            it = order_.erase(it);
+        }
+    }
+
+    /**
+     * @brief Change the byte budget, evicting entries if it shrinks.
+     */
+    void setMaxBytes(std::size_t max_bytes) {
+        max_bytes_ = max_bytes;
+        makeRoom(0);
+    }
+
+    /**
+     * @brief Reset the hit, miss and eviction counters.
+     */
+    void resetStats() {
+        hits_ = 0;
+        misses_ = 0;
+        evictions_ = 0;
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return entries_.size(); }
+    [[nodiscard]] auto getMaxBytes() const -> std::size_t { return max_bytes_; }
+    [[nodiscard]] auto getTotalBytes() const -> std::size_t {
+        return total_bytes_;
+    }
+    [[nodiscard]] auto getHits() const -> std::size_t { return hits_; }
+    [[nodiscard]] auto getMisses() const -> std::size_t { return misses_; }
+    [[nodiscard]] auto getEvictions() const -> std::size_t {
+        return evictions_;
+    }
+};
+
+} // namespace Pennylane::CUDA::Util
@@ -681,6 +681,31 @@ class MPIManager final {
                                        recvtag, this->getComm(), &status));
     }
 
+    /**
+     * @brief MPI_Sendrecv wrapper for device buffers. Requires a CUDA-aware
+     * MPI implementation.
+     *
+     * @tparam T C++ data type.
+     * @param sendBuf Send buffer (DataBuffer type).
+     * @param dest Rank of destination.
+     * @param recvBuf Receive buffer (DataBuffer type).
+     * @param source Rank of source.
+     */
+    template <typename T>
+    void Sendrecv(DataBuffer<T> &sendBuf, size_t dest, DataBuffer<T> &recvBuf,
+                  size_t source) {
+        MPI_Datatype datatype = getMPIDatatype<T>();
+        MPI_Status status;
+        int sendtag = 0;
+        int recvtag = 0;
+        int destInt = static_cast<int>(dest);
+        int sourceInt = static_cast<int>(source);
+        PL_MPI_IS_SUCCESS(MPI_Sendrecv(
+            sendBuf.getData(), sendBuf.getLength(), datatype, destInt, sendtag,
+            recvBuf.getData(), recvBuf.getLength(), datatype, sourceInt,
+            recvtag, this->getComm(), &status));
+    }
+
     template <typename T>
     void Scan(T &sendBuf, T &recvBuf, const std::string &op_str) {
         MPI_Datatype datatype = getMPIDatatype<T>();
@@ -0,0 +1,193 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file OpStream.hpp
+ * Flat struct-of-arrays encoding of a list of operations, read in place from
+ * host buffers such as NumPy arrays. This file has no CUDA dependencies.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Names of the operations with a fixed op code, which is their index
+ * in this table. A serializer gives any other operation an op code past the
+ * end of the table, and appends its name to the table of the stream.
+ */
+inline auto getOpStreamGateNames() -> const std::vector<std::string> & {
+    static const std::vector<std::string> names{
+        "Identity",
+        "PauliX",
+        "PauliY",
+        "PauliZ",
+        "Hadamard",
+        "S",
+        "T",
+        "RX",
+        "RY",
+        "RZ",
+        "Rot",
+        "PhaseShift",
+        "CNOT",
+        "CY",
+        "CZ",
+        "SWAP",
+        "CSWAP",
+        "Toffoli",
+        "IsingXX",
+        "IsingYY",
+        "IsingZZ",
+        "CRot",
+        "CRX",
+        "CRY",
+        "CRZ",
+        "ControlledPhaseShift",
+        "SingleExcitation",
+        "SingleExcitationMinus",
+        "SingleExcitationPlus",
+        "DoubleExcitation",
+        "DoubleExcitationMinus",
+        "DoubleExcitationPlus",
+        "MultiRZ",
+        "Measure",
+        "Reset",
+        "Collapse"};
+    return names;
+}
+
+/**
+ * @brief Non-owning view of a list of operations stored as flat arrays.
+ *
+ * Operation `k` has the name `names[op_codes[k]]`, the wires
+ * `wires[wire_offsets[k]:wire_offsets[k + 1]]`, the parameters
+ * `params[param_offsets[k]:param_offsets[k + 1]]` and, for operations
+ * without a dedicated kernel, the row-major matrix
+ * `matrices[matrix_offsets[k]:matrix_offsets[k + 1]]`. The buffers must
+ * outlive the view.
+ *
+ * @tparam PrecisionT Floating point precision of the parameters.
+ */
+template <class PrecisionT> class OpStream {
+  public:
+    /**
+     * @brief Check the layout of the buffers and build the view.
+     *
+     * @param names Op-code table, i.e. `getOpStreamGateNames()` followed by
+     * the names of the other operations of the stream.
+     * @param op_codes Op code of each operation.
+     * @param wire_offsets Offsets of the wires of each operation, with one
+     * more entry than operations.
+     * @param wires Wires of all operations.
+     * @param param_offsets Offsets of the parameters of each operation.
+     * @param params Parameters of all operations.
+     * @param inverses Whether to apply the adjoint of each operation.
+     * @param matrix_offsets Offsets of the matrix of each operation.
+     * @param matrices Matrices of all operations.
+     */
+    OpStream(std::vector<std::string> names,
+             std::span<const std::int64_t> op_codes,
+             std::span<const std::int64_t> wire_offsets,
+             std::span<const std::int64_t> wires,
+             std::span<const std::int64_t> param_offsets,
+             std::span<const PrecisionT> params, std::span<const bool> inverses,
+             std::span<const std::int64_t> matrix_offsets,
+             std::span<const std::complex<PrecisionT>> matrices)
+        : names_{std::move(names)}, op_codes_{op_codes},
+          wire_offsets_{wire_offsets}, wires_{wires},
+          param_offsets_{param_offsets}, params_{params}, inverses_{inverses},
+          matrix_offsets_{matrix_offsets}, matrices_{matrices} {
+        PL_ABORT_IF_NOT(inverses_.size() == op_codes_.size(),
+                        "Incompatible number of ops and inverses");
+        checkOffsets(wire_offsets_, wires_.size());
+        checkOffsets(param_offsets_, params_.size());
+        checkOffsets(matrix_offsets_, matrices_.size());
+        for (const auto code : op_codes_) {
+            PL_ABORT_IF(code < 0 ||
+                            static_cast<std::size_t>(code) >= names_.size(),
+                        "Invalid op code");
+        }
+        for (const auto wire : wires_) {
+            PL_ABORT_IF(wire < 0, "Invalid wire index");
+        }
+    }
+
+    [[nodiscard]] auto getNumOps() const -> std::size_t {
+        return op_codes_.size();
+    }
+    [[nodiscard]] auto getName(std::size_t op) const -> const std::string & {
+        return names_[op_codes_[op]];
+    }
+    [[nodiscard]] auto getInverse(std::size_t op) const -> bool {
+        return inverses_[op];
+    }
+    [[nodiscard]] auto hasMatrix(std::size_t op) const -> bool {
+        return matrix_offsets_[op + 1] > matrix_offsets_[op];
+    }
+    [[nodiscard]] auto getWires(std::size_t op) const
+        -> std::vector<std::size_t> {
+        return {wires_.begin() + wire_offsets_[op],
+                wires_.begin() + wire_offsets_[op + 1]};
+    }
+    [[nodiscard]] auto getParams(std::size_t op) const
+        -> std::vector<PrecisionT> {
+        return {params_.begin() + param_offsets_[op],
+                params_.begin() + param_offsets_[op + 1]};
+    }
+    [[nodiscard]] auto getMatrix(std::size_t op) const
+        -> std::vector<std::complex<PrecisionT>> {
+        return {matrices_.begin() + matrix_offsets_[op],
+                matrices_.begin() + matrix_offsets_[op + 1]};
+    }
+
+  private:
+    std::vector<std::string> names_;
+    std::span<const std::int64_t> op_codes_;
+    std::span<const std::int64_t> wire_offsets_;
+    std::span<const std::int64_t> wires_;
+    std::span<const std::int64_t> param_offsets_;
+    std::span<const PrecisionT> params_;
+    std::span<const bool> inverses_;
+    std::span<const std::int64_t> matrix_offsets_;
+    std::span<const std::complex<PrecisionT>> matrices_;
+
+    /**
+     * @brief Check that offsets start at 0, never decrease and end at the
+     * length of their buffer.
+     */
+    void checkOffsets(std::span<const std::int64_t> offsets,
+                      std::size_t length) const {
+        PL_ABORT_IF_NOT(offsets.size() == op_codes_.size() + 1,
+                        "Offsets must have one more entry than ops");
+        PL_ABORT_IF_NOT(offsets.front() == 0, "Offsets must start at 0");
+        for (std::size_t op = 0; op < op_codes_.size(); op++) {
+            PL_ABORT_IF(offsets[op + 1] < offsets[op],
+                        "Offsets must be non-decreasing");
+        }
+        PL_ABORT_IF_NOT(static_cast<std::size_t>(offsets.back()) == length,
+                        "Offsets do not match the buffer length");
+    }
+};
+
+} // namespace Pennylane::CUDA::Util
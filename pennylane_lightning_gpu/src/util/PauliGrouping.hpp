@@ -0,0 +1,298 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PauliGrouping.hpp
+ * Partitioning of Pauli words into qubit-wise commuting groups, and
+ * evaluation of their expectation values from the probabilities of the
+ * rotated state. This file has no CUDA dependencies.
+ */
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/// Largest group measured from the probabilities of its wires; larger groups
+/// are evaluated as part of the Pauli sentence.
+inline constexpr std::size_t max_grouped_wires = 20;
+
+/**
+ * @brief Pauli words sharing an eigenbasis: on every wire, all words of the
+ * group act with the same Pauli operator or with the identity.
+ */
+struct QubitWiseCommutingGroup {
+    /// Wires acted on by at least one word of the group.
+    std::vector<std::size_t> wires;
+    /// Pauli operator measured on each wire, one of `X`, `Y` or `Z`.
+    std::string basis;
+    /// Indices of the words of the group in the input.
+    std::vector<std::size_t> terms;
+    /// For each word, bit `j` is set if the word acts on `wires[j]`.
+    std::vector<std::uint64_t> term_masks;
+
+    /**
+     * @brief Whether the group is measured in the computational basis, so
+     * that no basis rotation is needed.
+     */
+    [[nodiscard]] auto isDiagonal() const -> bool {
+        return std::all_of(basis.begin(), basis.end(),
+                           [](char p) { return p == 'Z'; });
+    }
+
+    /**
+     * @brief Number of passes over the state vector to evaluate the group:
+     * one copy and one gate per X (two per Y) wire if a rotation is needed,
+     * and one reduction.
+     */
+    [[nodiscard]] auto getNumStatePasses() const -> std::size_t {
+        if (isDiagonal()) {
+            return 1;
+        }
+        const auto num_x = std::count(basis.begin(), basis.end(), 'X');
+        const auto num_y = std::count(basis.begin(), basis.end(), 'Y');
+        return 2 + static_cast<std::size_t>(num_x + 2 * num_y);
+    }
+
+    /**
+     * @brief Whether evaluating the group from one reduction takes fewer
+     * passes over the state vector than evaluating its words one by one.
+     */
+    [[nodiscard]] auto isWorthGrouping() const -> bool {
+        return wires.size() <= max_grouped_wires &&
+               getNumStatePasses() < terms.size();
+    }
+};
+
+/**
+ * @brief Greedily partition Pauli words into qubit-wise commuting groups.
+ * Each word joins the first group it is compatible with.
+ *
+ * @param words Pauli words, one of `I`, `X`, `Y` or `Z` per wire.
+ * @param wires Wires of each word.
+ * @return std::vector<QubitWiseCommutingGroup> Groups, in order of creation.
+ * Every group measures at least one wire and at most 64.
+ */
+inline auto
+groupQubitWiseCommuting(const std::vector<std::string> &words,
+                        const std::vector<std::vector<std::size_t>> &wires)
+    -> std::vector<QubitWiseCommutingGroup> {
+    PL_ABORT_IF_NOT(words.size() == wires.size(),
+                    "Incompatible number of Pauli words and wires");
+
+    // Basis of each wire of each group.
+    std::vector<std::unordered_map<std::size_t, char>> bases;
+    std::vector<QubitWiseCommutingGroup> groups;
+    for (std::size_t t = 0; t < words.size(); t++) {
+        PL_ABORT_IF_NOT(words[t].size() == wires[t].size(),
+                        "Each Pauli word requires one wire per operator");
+        for (const char p : words[t]) {
+            PL_ABORT_IF(p != 'I' && p != 'X' && p != 'Y' && p != 'Z',
+                        "Invalid Pauli operator");
+        }
+        const auto compatible = [&](const auto &basis) {
+            for (std::size_t k = 0; k < words[t].size(); k++) {
+                const auto it = basis.find(wires[t][k]);
+                if (words[t][k] != 'I' && it != basis.end() &&
+                    it->second != words[t][k]) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        const auto it = std::find_if(bases.begin(), bases.end(), compatible);
+        const auto g = static_cast<std::size_t>(it - bases.begin());
+        if (it == bases.end()) {
+            bases.emplace_back();
+            groups.emplace_back();
+        }
+        for (std::size_t k = 0; k < words[t].size(); k++) {
+            if (words[t][k] == 'I') {
+                continue;
+            }
+            if (bases[g].emplace(wires[t][k], words[t][k]).second) {
+                groups[g].wires.push_back(wires[t][k]);
+                groups[g].basis.push_back(words[t][k]);
+            }
+        }
+        groups[g].terms.push_back(t);
+    }
+
+    for (auto &group : groups) {
+        if (group.wires.empty()) {
+            // Identity words only: measure any wire.
+            group.wires.push_back(0);
+            group.basis.push_back('Z');
+        }
+        PL_ABORT_IF(group.wires.size() > 64,
+                    "Qubit-wise commuting groups support up to 64 wires");
+        for (const std::size_t t : group.terms) {
+            std::uint64_t mask = 0;
+            for (std::size_t k = 0; k < words[t].size(); k++) {
+                if (words[t][k] == 'I') {
+                    continue;
+                }
+                const auto j = static_cast<std::size_t>(
+                    std::find(group.wires.begin(), group.wires.end(),
+                              wires[t][k]) -
+                    group.wires.begin());
+                mask |= std::uint64_t{1} << j;
+            }
+            group.term_masks.push_back(mask);
+        }
+    }
+    return groups;
+}
+
+/**
+ * @brief How the expectation values of a sum of Pauli words are evaluated:
+ * some qubit-wise commuting groups from the probabilities of their wires, and
+ * the other words by a single application of their compiled Pauli sentence.
+ */
+struct PauliExpectationPlan {
+    /// Groups evaluated from the probabilities of their wires.
+    std::vector<QubitWiseCommutingGroup> groups;
+    /// Indices of the words evaluated as one Pauli sentence.
+    std::vector<std::size_t> sentence_terms;
+};
+
+/**
+ * @brief Plan the evaluation of the expectation values of Pauli words with
+ * the fewest passes over the state vector.
+ *
+ * A Pauli sentence takes one gather per distinct set of flipped (X or Y)
+ * wires and one pass for the inner product. Each group of at most
+ * `max_grouped_wires` wires is measured from probabilities instead if its
+ * passes are fewer than the passes it saves the sentence.
+ *
+ * @param words Pauli words, one of `I`, `X`, `Y` or `Z` per wire.
+ * @param wires Wires of each word.
+ * @return PauliExpectationPlan
+ */
+inline auto planPauliExpectation(
+    const std::vector<std::string> &words,
+    const std::vector<std::vector<std::size_t>> &wires)
+    -> PauliExpectationPlan {
+    auto groups = groupQubitWiseCommuting(words, wires);
+
+    // Number of words of the sentence flipping each set of wires.
+    std::vector<std::vector<std::size_t>> flips(words.size());
+    std::map<std::vector<std::size_t>, std::size_t> flip_counts;
+    for (std::size_t t = 0; t < words.size(); t++) {
+        for (std::size_t k = 0; k < words[t].size(); k++) {
+            if (words[t][k] == 'X' || words[t][k] == 'Y') {
+                flips[t].push_back(wires[t][k]);
+            }
+        }
+        std::sort(flips[t].begin(), flips[t].end());
+        flip_counts[flips[t]]++;
+    }
+    const auto sentence_passes = [&]() -> std::size_t {
+        return flip_counts.empty() ? 0 : flip_counts.size() + 1;
+    };
+
+    PauliExpectationPlan plan;
+    std::vector<bool> grouped(words.size(), false);
+    for (auto &group : groups) {
+        if (group.wires.size() > max_grouped_wires) {
+            continue;
+        }
+        const std::size_t passes = sentence_passes();
+        for (const std::size_t t : group.terms) {
+            if (--flip_counts[flips[t]] == 0) {
+                flip_counts.erase(flips[t]);
+            }
+        }
+        if (group.getNumStatePasses() + sentence_passes() < passes) {
+            for (const std::size_t t : group.terms) {
+                grouped[t] = true;
+            }
+            plan.groups.push_back(std::move(group));
+        } else {
+            for (const std::size_t t : group.terms) {
+                flip_counts[flips[t]]++;
+            }
+        }
+    }
+    for (std::size_t t = 0; t < words.size(); t++) {
+        if (!grouped[t]) {
+            plan.sentence_terms.push_back(t);
+        }
+    }
+    return plan;
+}
+
+/**
+ * @brief Rotate a state vector into the eigenbasis of a group, so that its
+ * words become diagonal: `H` maps X to Z and `H S^dagger` maps Y to Z.
+ *
+ * @tparam StateVectorT State vector type, providing `applyOperation`.
+ * @param sv State vector to rotate.
+ * @param group Qubit-wise commuting group.
+ */
+template <class StateVectorT>
+void rotateToGroupBasis(StateVectorT &sv,
+                        const QubitWiseCommutingGroup &group) {
+    for (std::size_t j = 0; j < group.wires.size(); j++) {
+        if (group.basis[j] == 'Y') {
+            sv.applyOperation("S", {group.wires[j]}, true);
+        }
+        if (group.basis[j] != 'Z') {
+            sv.applyOperation("Hadamard", {group.wires[j]}, false);
+        }
+    }
+}
+
+/**
+ * @brief Expectation values of the words of a group from the probabilities
+ * of its wires, measured in the basis of the group.
+ *
+ * @param probabilities Probabilities of the wires of the group, where bit `j`
+ * of the index is the value of `group.wires[j]`, i.e. the output of
+ * `probability(group.wires)`.
+ * @param group Qubit-wise commuting group.
+ * @param expectations Expectation value of each input word, of which the
+ * entries of the words of the group are written.
+ */
+inline void
+groupExpectationValues(const std::vector<double> &probabilities,
+                       const QubitWiseCommutingGroup &group,
+                       std::vector<double> &expectations) {
+    PL_ABORT_IF(group.wires.size() >= 64, "Too many wires in the group");
+    const std::size_t num_outcomes = std::size_t{1} << group.wires.size();
+    PL_ABORT_IF_NOT(probabilities.size() == num_outcomes,
+                    "The probabilities do not match the group");
+    for (std::size_t t = 0; t < group.terms.size(); t++) {
+        const std::uint64_t mask = group.term_masks[t];
+        double expect = 0;
+        for (std::size_t i = 0; i < num_outcomes; i++) {
+            const bool odd =
+                std::popcount(static_cast<std::uint64_t>(i) & mask) & 1U;
+            expect += odd ? -probabilities[i] : probabilities[i];
+        }
+        expectations[group.terms[t]] = expect;
+    }
+}
+
+} // namespace Pennylane::CUDA::Util
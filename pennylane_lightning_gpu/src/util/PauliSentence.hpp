@@ -0,0 +1,201 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PauliSentence.hpp
+ * Bit-mask representation of a linear combination of Pauli words. This file
+ * has no CUDA dependencies.
+ */
+#pragma once
+
+#include <bit>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Linear combination of Pauli words compiled into bit masks.
+ *
+ * A Pauli word maps the basis state `i ^ x_mask` to `i` with the phase
+ * `coeff * (-1)^popcount(i & z_mask)`, where `x_mask` marks its X and Y
+ * factors, `z_mask` its Y and Z factors, and the `(-i)` of each Y factor
+ * is folded into `coeff`. Terms sharing an `x_mask` are stored contiguously
+ * so that applying the sentence reads each source amplitude once per group:
+ *
+ * out[i] = sum_g in[i ^ x_masks[g]] *
+ *          sum_{t in group g} coeffs[t] * (-1)^popcount(i & z_masks[t])
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct PauliSentence {
+    /// X mask of each group.
+    std::vector<std::uint64_t> x_masks;
+    /// Terms of group `g` are in `[group_offsets[g], group_offsets[g + 1])`.
+    std::vector<std::size_t> group_offsets{0};
+    /// Z mask of each term.
+    std::vector<std::uint64_t> z_masks;
+    /// Coefficient of each term, including the phase of its Y factors.
+    std::vector<std::complex<PrecisionT>> coeffs;
+
+    [[nodiscard]] auto getNumGroups() const -> std::size_t {
+        return x_masks.size();
+    }
+    [[nodiscard]] auto getNumTerms() const -> std::size_t {
+        return z_masks.size();
+    }
+};
+
+/**
+ * @brief Compile Pauli words into a PauliSentence.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param coeffs Coefficient of each word.
+ * @param words Pauli words, one of `I`, `X`, `Y` or `Z` per wire.
+ * @param wires Wires of each word.
+ * @param num_qubits Number of qubits of the state vector; wire `w` maps to
+ * bit `num_qubits - 1 - w` of the basis-state index.
+ * @return PauliSentence<PrecisionT>
+ */
+template <class PrecisionT>
+auto compilePauliSentence(const std::vector<PrecisionT> &coeffs,
+                          const std::vector<std::string> &words,
+                          const std::vector<std::vector<std::size_t>> &wires,
+                          std::size_t num_qubits)
+    -> PauliSentence<PrecisionT> {
+    PL_ABORT_IF_NOT(coeffs.size() == words.size() &&
+                        words.size() == wires.size(),
+                    "Incompatible number of coefficients, words and wires");
+    PL_ABORT_IF(num_qubits > 64, "Pauli sentences support up to 64 qubits");
+
+    struct Term {
+        std::uint64_t z_mask;
+        std::complex<PrecisionT> coeff;
+    };
+    // Ordered by X mask, so that compiling is deterministic.
+    std::map<std::uint64_t, std::vector<Term>> groups;
+    for (std::size_t t = 0; t < words.size(); t++) {
+        PL_ABORT_IF_NOT(words[t].size() == wires[t].size(),
+                        "Each Pauli word requires one wire per operator");
+        std::uint64_t x_mask = 0;
+        std::uint64_t z_mask = 0;
+        std::complex<PrecisionT> coeff{coeffs[t], 0};
+        for (std::size_t k = 0; k < words[t].size(); k++) {
+            PL_ABORT_IF_NOT(wires[t][k] < num_qubits, "Invalid wire index");
+            const std::uint64_t bit = std::uint64_t{1}
+                                      << (num_qubits - 1 - wires[t][k]);
+            switch (words[t][k]) {
+            case 'I':
+                break;
+            case 'X':
+                x_mask |= bit;
+                break;
+            case 'Y':
+                x_mask |= bit;
+                z_mask |= bit;
+                coeff *= std::complex<PrecisionT>{0, -1};
+                break;
+            case 'Z':
+                z_mask |= bit;
+                break;
+            default:
+                PL_ABORT("Invalid Pauli operator");
+            }
+        }
+        groups[x_mask].push_back({z_mask, coeff});
+    }
+
+    PauliSentence<PrecisionT> sentence;
+    for (const auto &[x_mask, terms] : groups) {
+        sentence.x_masks.push_back(x_mask);
+        for (const auto &term : terms) {
+            sentence.z_masks.push_back(term.z_mask);
+            sentence.coeffs.push_back(term.coeff);
+        }
+        sentence.group_offsets.push_back(sentence.z_masks.size());
+    }
+    return sentence;
+}
+
+/**
+ * @brief Part of a Pauli sentence acting on one block of a state vector
+ * distributed over `2^num_global_qubits` blocks.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct PauliSentenceBlock {
+    /// Global bits of the X masks: the block is read from block
+    /// `block_index ^ global_x_mask`.
+    std::uint64_t global_x_mask;
+    /// Terms restricted to the local qubits, with the phase of the global Z
+    /// factors folded into the coefficients.
+    PauliSentence<PrecisionT> local;
+};
+
+/**
+ * @brief Split a Pauli sentence into the block-local sentences producing the
+ * rows of one block of a distributed state vector.
+ *
+ * The state vector is split into blocks of `2^num_local_qubits` amplitudes,
+ * block `b` holding the basis states whose high bits equal `b`. Rows of block
+ * `block_index` are the sum, over the returned parts, of the local sentence
+ * applied to block `block_index ^ global_x_mask`. The parts are ordered by
+ * `global_x_mask`, which does not depend on `block_index`.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param sentence Pauli sentence compiled for all qubits.
+ * @param num_local_qubits Number of qubits of each block.
+ * @param block_index Index of the block whose rows are computed.
+ * @return std::vector<PauliSentenceBlock<PrecisionT>>
+ */
+template <class PrecisionT>
+auto splitPauliSentence(const PauliSentence<PrecisionT> &sentence,
+                        std::size_t num_local_qubits,
+                        std::uint64_t block_index)
+    -> std::vector<PauliSentenceBlock<PrecisionT>> {
+    PL_ABORT_IF(num_local_qubits >= 64, "Invalid number of local qubits");
+    const std::uint64_t local_mask =
+        (std::uint64_t{1} << num_local_qubits) - 1;
+
+    // Groups are sorted by X mask, so groups sharing their global bits are
+    // contiguous.
+    std::vector<PauliSentenceBlock<PrecisionT>> blocks;
+    for (std::size_t g = 0; g < sentence.getNumGroups(); g++) {
+        const std::uint64_t global_x = sentence.x_masks[g] >> num_local_qubits;
+        if (blocks.empty() || blocks.back().global_x_mask != global_x) {
+            blocks.push_back({global_x, {}});
+        }
+        auto &local = blocks.back().local;
+        local.x_masks.push_back(sentence.x_masks[g] & local_mask);
+        for (std::size_t t = sentence.group_offsets[g];
+             t < sentence.group_offsets[g + 1]; t++) {
+            const std::uint64_t global_z =
+                sentence.z_masks[t] >> num_local_qubits;
+            const bool odd = std::popcount(block_index & global_z) & 1U;
+            local.z_masks.push_back(sentence.z_masks[t] & local_mask);
+            local.coeffs.push_back(odd ? -sentence.coeffs[t]
+                                       : sentence.coeffs[t]);
+        }
+        local.group_offsets.push_back(local.z_masks.size());
+    }
+    return blocks;
+}
+
+} // namespace Pennylane::CUDA::Util
@@ -0,0 +1,135 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file QubitMap.hpp
+ * Permutation between the logical index bits of a state vector and the
+ * physical index bits of its amplitudes in memory. This file has no CUDA
+ * dependencies.
+ */
+#pragma once
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Logical-to-physical map of the index bits of a state vector.
+ *
+ * The amplitude of the logical basis state whose bit `b` is `x_b` is stored
+ * at the physical index whose bit `getPhysicalBit(b)` is `x_b`. Swapping two
+ * qubits then only relabels their bits, and the amplitudes are reordered
+ * once, when the physical layout is needed.
+ */
+class QubitMap {
+  public:
+    explicit QubitMap(std::size_t num_qubits = 0)
+        : physical_(num_qubits), logical_(num_qubits) {
+        reset();
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return physical_.size();
+    }
+
+    /**
+     * @brief Physical index bit holding a logical index bit.
+     */
+    [[nodiscard]] auto getPhysicalBit(std::size_t logical_bit) const
+        -> std::size_t {
+        return physical_[logical_bit];
+    }
+
+    /**
+     * @brief Logical index bit held by a physical index bit.
+     */
+    [[nodiscard]] auto getLogicalBit(std::size_t physical_bit) const
+        -> std::size_t {
+        return logical_[physical_bit];
+    }
+
+    /**
+     * @brief Whether the physical layout is the logical one.
+     */
+    [[nodiscard]] auto isIdentity() const -> bool {
+        for (std::size_t b = 0; b < physical_.size(); b++) {
+            if (physical_[b] != b) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Exchange two logical index bits without moving amplitudes, i.e.
+     * apply a SWAP gate.
+     */
+    void swapLogical(std::size_t logical_a, std::size_t logical_b) {
+        PL_ABORT_IF(logical_a >= getNumQubits() || logical_b >= getNumQubits(),
+                    "Invalid index bit");
+        std::swap(physical_[logical_a], physical_[logical_b]);
+        logical_[physical_[logical_a]] = logical_a;
+        logical_[physical_[logical_b]] = logical_b;
+    }
+
+    /**
+     * @brief Record that two physical index bits of the amplitudes have been
+     * exchanged in memory.
+     */
+    void swapPhysical(std::size_t physical_a, std::size_t physical_b) {
+        PL_ABORT_IF(physical_a >= getNumQubits() ||
+                        physical_b >= getNumQubits(),
+                    "Invalid index bit");
+        std::swap(logical_[physical_a], logical_[physical_b]);
+        physical_[logical_[physical_a]] = physical_a;
+        physical_[logical_[physical_b]] = physical_b;
+    }
+
+    /**
+     * @brief Physical index bit swaps restoring the logical layout, to be
+     * applied in order. There are at most `getNumQubits() - 1` swaps.
+     */
+    [[nodiscard]] auto getRestoringSwaps() const
+        -> std::vector<std::pair<std::size_t, std::size_t>> {
+        std::vector<std::pair<std::size_t, std::size_t>> swaps;
+        QubitMap map{*this};
+        for (std::size_t b = 0; b < getNumQubits(); b++) {
+            if (map.physical_[b] != b) {
+                swaps.emplace_back(b, map.physical_[b]);
+                map.swapPhysical(b, map.physical_[b]);
+            }
+        }
+        return swaps;
+    }
+
+    /**
+     * @brief Reset to the identity, e.g. after the amplitudes have been
+     * reordered or overwritten in logical order.
+     */
+    void reset() {
+        std::iota(physical_.begin(), physical_.end(), std::size_t{0});
+        std::iota(logical_.begin(), logical_.end(), std::size_t{0});
+    }
+
+  private:
+    std::vector<std::size_t> physical_;
+    std::vector<std::size_t> logical_;
+};
+
+} // namespace Pennylane::CUDA::Util
@@ -0,0 +1,133 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file QubitPlanner.hpp
+ * Look-ahead planning of the index bit swaps that make the qubits of each
+ * gate local in a distributed state vector. This file has no CUDA
+ * dependencies.
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+#include "QubitMap.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Swaps of a (local, global) physical index bit pair, applied
+ * together before a gate.
+ */
+using IndexBitSwaps = std::vector<std::pair<std::size_t, std::size_t>>;
+
+/**
+ * @brief Plan the index bit swaps bringing the bits of every gate to the
+ * local bits, below `num_local`, leaving the permutation in place between
+ * gates.
+ *
+ * Swapping a global bit in evicts a local bit, as in a cache with
+ * `num_local` slots. The evicted bit is the one, outside the current gate,
+ * whose next use is the farthest away, which minimizes the total number of
+ * swaps when `window` covers all gates. Uses further than `window` gates
+ * ahead are not looked at. Ties go to the highest local bit.
+ *
+ * @param num_local Number of local index bits.
+ * @param map Map of the logical index bits before the first gate.
+ * @param gate_bits Logical index bits of each gate.
+ * @param window Number of gates to look ahead.
+ * @return Swaps to apply before each gate.
+ */
+inline auto
+planLocalQubits(std::size_t num_local, QubitMap map,
+                const std::vector<std::vector<std::size_t>> &gate_bits,
+                std::size_t window = std::numeric_limits<std::size_t>::max())
+    -> std::vector<IndexBitSwaps> {
+    const std::size_t num_qubits = map.getNumQubits();
+    const std::size_t never = std::numeric_limits<std::size_t>::max();
+    PL_ABORT_IF(num_local > num_qubits, "Invalid number of local qubits");
+
+    std::vector<std::vector<std::size_t>> uses(num_qubits);
+    for (std::size_t gate = 0; gate < gate_bits.size(); gate++) {
+        PL_ABORT_IF(gate_bits[gate].size() > num_local,
+                    "There is not enough local wires for bit swap operation.");
+        for (const auto bit : gate_bits[gate]) {
+            PL_ABORT_IF(bit >= num_qubits, "Invalid index bit");
+            uses[bit].push_back(gate);
+        }
+    }
+    std::vector<std::size_t> next(num_qubits, 0);
+    const auto next_use = [&](std::size_t bit, std::size_t gate) {
+        while (next[bit] < uses[bit].size() && uses[bit][next[bit]] <= gate) {
+            next[bit]++;
+        }
+        if (next[bit] == uses[bit].size() ||
+            uses[bit][next[bit]] - gate > window) {
+            return never;
+        }
+        return uses[bit][next[bit]];
+    };
+
+    std::vector<IndexBitSwaps> plan(gate_bits.size());
+    std::vector<bool> in_gate(num_qubits, false);
+    for (std::size_t gate = 0; gate < gate_bits.size(); gate++) {
+        for (const auto bit : gate_bits[gate]) {
+            PL_ABORT_IF(in_gate[bit], "Wires must be unique");
+            in_gate[bit] = true;
+        }
+        for (const auto bit : gate_bits[gate]) {
+            const std::size_t global = map.getPhysicalBit(bit);
+            if (global < num_local) {
+                continue;
+            }
+            std::size_t victim = num_local;
+            std::size_t victim_use = 0;
+            for (std::size_t local = num_local; local-- > 0;) {
+                const std::size_t logical = map.getLogicalBit(local);
+                if (in_gate[logical]) {
+                    continue;
+                }
+                const std::size_t use = next_use(logical, gate);
+                if (victim == num_local || use > victim_use) {
+                    victim = local;
+                    victim_use = use;
+                }
+            }
+            plan[gate].emplace_back(victim, global);
+            map.swapPhysical(victim, global);
+        }
+        for (const auto bit : gate_bits[gate]) {
+            in_gate[bit] = false;
+        }
+    }
+    return plan;
+}
+
+/**
+ * @brief Cost of a plan: total number of index bit swaps.
+ */
+inline auto countIndexBitSwaps(const std::vector<IndexBitSwaps> &plan)
+    -> std::size_t {
+    std::size_t count = 0;
+    for (const auto &swaps : plan) {
+        count += swaps.size();
+    }
+    return count;
+}
+
+} // namespace Pennylane::CUDA::Util
@@ -0,0 +1,139 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SampleUtils.hpp
+ * Host post-processing of sampled bit strings: unpacking into per-wire
+ * values and histogramming into counts. This file has no CUDA dependencies.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace Pennylane::CUDA::Util {
+
+/// Packed sample: bit `num_qubits - 1 - w` holds the value of wire `w`.
+using PackedSample = std::uint64_t;
+
+/// Histogram of packed samples, sorted by bit string.
+using SampleCounts = std::vector<std::pair<PackedSample, std::size_t>>;
+
+/**
+ * @brief Unpack bit strings into one value per wire.
+ *
+ * @tparam BitStrT Integer type of the bit strings.
+ * @param bit_strings Packed samples.
+ * @param num_qubits Number of qubits of each sample.
+ * @return std::vector<std::size_t> Flat array of `num_qubits` entries per
+ * sample, in wire order.
+ */
+template <class BitStrT>
+auto unpackBitStrings(const std::vector<BitStrT> &bit_strings,
+                      std::size_t num_qubits) -> std::vector<std::size_t> {
+    const std::size_t num_samples = bit_strings.size();
+    std::vector<std::size_t> samples(num_samples * num_qubits);
+#if defined(_OPENMP)
+#pragma omp parallel for default(none)                                         \
+    shared(bit_strings, samples, num_samples, num_qubits)
+#endif
+    for (std::size_t i = 0; i < num_samples; i++) {
+        const auto bits = static_cast<PackedSample>(bit_strings[i]);
+        for (std::size_t w = 0; w < num_qubits; w++) {
+            samples[i * num_qubits + w] = (bits >> (num_qubits - 1 - w)) & 1U;
+        }
+    }
+    return samples;
+}
+
+/**
+ * @brief Histogram bit strings sorted in ascending order.
+ *
+ * The input is split into one chunk per thread; each chunk is run-length
+ * encoded independently and runs straddling chunk boundaries are merged.
+ *
+ * @tparam BitStrT Integer type of the bit strings.
+ * @param bit_strings Packed samples in ascending order.
+ * @return SampleCounts Distinct bit strings and their number of occurrences.
+ */
+template <class BitStrT>
+auto countSortedBitStrings(const std::vector<BitStrT> &bit_strings)
+    -> SampleCounts {
+    const std::size_t num_samples = bit_strings.size();
+    if (num_samples == 0) {
+        return {};
+    }
+#if defined(_OPENMP)
+    const auto num_chunks = std::min<std::size_t>(
+        static_cast<std::size_t>(omp_get_max_threads()), num_samples);
+#else
+    const std::size_t num_chunks = 1;
+#endif
+    const std::size_t chunk_size = (num_samples + num_chunks - 1) / num_chunks;
+    std::vector<SampleCounts> chunk_counts(num_chunks);
+
+#if defined(_OPENMP)
+#pragma omp parallel for default(none)                                         \
+    shared(bit_strings, chunk_counts, num_chunks, chunk_size, num_samples)
+#endif
+    for (std::size_t c = 0; c < num_chunks; c++) {
+        const std::size_t first = c * chunk_size;
+        const std::size_t last = std::min(first + chunk_size, num_samples);
+        auto &counts = chunk_counts[c];
+        for (std::size_t i = first; i < last; i++) {
+            const auto bits = static_cast<PackedSample>(bit_strings[i]);
+            if (counts.empty() || counts.back().first != bits) {
+                counts.emplace_back(bits, 0);
+            }
+            counts.back().second++;
+        }
+    }
+
+    SampleCounts counts;
+    for (const auto &chunk : chunk_counts) {
+        auto it = chunk.begin();
+        if (it != chunk.end() && !counts.empty() &&
+            counts.back().first == it->first) {
+            counts.back().second += it->second;
+            ++it;
+        }
+        counts.insert(counts.end(), it, chunk.end());
+    }
+    return counts;
+}
+
+/**
+ * @brief Histogram bit strings in any order.
+ *
+ * @tparam BitStrT Integer type of the bit strings.
+ * @param bit_strings Packed samples.
+ * @return SampleCounts Distinct bit strings, in ascending order, and their
+ * number of occurrences.
+ */
+template <class BitStrT>
+auto countBitStrings(std::vector<BitStrT> bit_strings) -> SampleCounts {
+    if (!std::is_sorted(bit_strings.begin(), bit_strings.end())) {
+        std::sort(bit_strings.begin(), bit_strings.end());
+    }
+    return countSortedBitStrings(bit_strings);
+}
+
+} // namespace Pennylane::CUDA::Util
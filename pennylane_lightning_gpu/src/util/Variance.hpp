@@ -0,0 +1,96 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Variance.hpp
+ * Host-side helpers for the variance of diagonal observables. This file has
+ * no CUDA dependencies.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Get the diagonal of a square matrix whose off-diagonal elements all
+ * vanish.
+ *
+ * @param matrix Square matrix in row-major order.
+ * @param diag Real part of the diagonal, left unspecified if the matrix is not
+ * diagonal.
+ * @return bool Whether the matrix is diagonal.
+ */
+template <class PrecisionT>
+auto getMatrixDiagonal(const std::vector<std::complex<PrecisionT>> &matrix,
+                       std::vector<PrecisionT> &diag) -> bool {
+    std::size_t dim = 0;
+    while (dim * dim < matrix.size()) {
+        dim++;
+    }
+    PL_ABORT_IF_NOT(dim * dim == matrix.size(), "The matrix must be square");
+    diag.resize(dim);
+    for (std::size_t row = 0; row < dim; row++) {
+        for (std::size_t col = 0; col < dim; col++) {
+            if (row != col && matrix[row * dim + col] != PrecisionT{0}) {
+                return false;
+            }
+        }
+        diag[row] = std::real(matrix[row * dim + row]);
+    }
+    return true;
+}
+
+/**
+ * @brief First and second moments of a diagonal observable, from the
+ * probabilities of its wires.
+ *
+ * @param probabilities Probabilities of the wires, where bit `j` of the
+ * outcome is the value of `wires[j]`, as returned by `probability(wires)`.
+ * Outcomes may be missing from a partial sum, e.g. over one MPI rank.
+ * @param diag Diagonal of the observable, where `wires[0]` is the most
+ * significant bit of the row, as in the observable matrix.
+ * @return std::pair<double, double> Sums of `p * d` and `p * d^2`.
+ */
+template <class PrecisionT>
+auto diagonalMoments(const std::vector<double> &probabilities,
+                     const std::vector<PrecisionT> &diag)
+    -> std::pair<double, double> {
+    PL_ABORT_IF_NOT(probabilities.size() == diag.size(),
+                    "Incompatible number of probabilities and diagonal "
+                    "elements");
+    std::size_t num_wires = 0;
+    while ((std::size_t{1} << num_wires) < diag.size()) {
+        num_wires++;
+    }
+    double mean = 0.0;
+    double mean_sq = 0.0;
+    for (std::size_t outcome = 0; outcome < probabilities.size(); outcome++) {
+        std::size_t row = 0;
+        for (std::size_t j = 0; j < num_wires; j++) {
+            row |= ((outcome >> j) & 1U) << (num_wires - 1 - j);
+        }
+        const auto d = static_cast<double>(diag[row]);
+        mean += probabilities[outcome] * d;
+        mean_sq += probabilities[outcome] * d * d;
+    }
+    return {mean, mean_sq};
+}
+
+} // namespace Pennylane::CUDA::Util
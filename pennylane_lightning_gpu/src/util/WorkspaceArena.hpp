@@ -0,0 +1,186 @@
+// Copyright 2022-2023 Xanadu Quantum Technologies Inc. and contributors.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WorkspaceArena.hpp
+ * Grow-only scratch-memory arena shared by the custatevec calls of a
+ * state-vector, and the allocator interface it is built on. This file has no
+ * CUDA dependencies; the device allocators are defined in
+ * CudaWorkspaceAllocator.hpp.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Interface of the raw memory allocators backing a `WorkspaceArena`.
+ */
+class WorkspaceAllocator {
+  public:
+    WorkspaceAllocator() = default;
+    WorkspaceAllocator(const WorkspaceAllocator &) = delete;
+    WorkspaceAllocator(WorkspaceAllocator &&) = delete;
+    WorkspaceAllocator &operator=(const WorkspaceAllocator &) = delete;
+    WorkspaceAllocator &operator=(WorkspaceAllocator &&) = delete;
+    virtual ~WorkspaceAllocator() = default;
+
+    /**
+     * @brief Allocate a block of memory.
+     *
+     * @param bytes Size of the block in bytes. Always positive.
+     * @return void* Pointer to the block.
+     */
+    virtual auto allocate(std::size_t bytes) -> void * = 0;
+
+    /**
+     * @brief Release a block obtained from `allocate`.
+     *
+     * @param ptr Pointer to the block.
+     * @param bytes Size of the block in bytes.
+     */
+    virtual void deallocate(void *ptr, std::size_t bytes) = 0;
+};
+
+/**
+ * @brief Host-memory allocator. Used to exercise the arena logic without a
+ * device.
+ */
+class HostWorkspaceAllocator final : public WorkspaceAllocator {
+  public:
+    auto allocate(std::size_t bytes) -> void * override {
+        void *ptr = std::malloc(bytes);
+        PL_ABORT_IF(ptr == nullptr, "Failed to allocate host workspace.");
+        return ptr;
+    }
+    void deallocate(void *ptr, [[maybe_unused]] std::size_t bytes) override {
+        std::free(ptr);
+    }
+};
+
+/**
+ * @brief Grow-only workspace arena.
+ *
+ * The arena owns a single scratch buffer which is handed out to every caller
+ * requesting workspace. The buffer is only reallocated when a request exceeds
+ * its capacity, so a sequence of calls with bounded workspace requirements
+ * performs a single allocation. The returned pointer is valid until the next
+ * call to `acquire`, `release` or `setAllocator`; callers must therefore not
+ * hold on to it across operations.
+ */
+class WorkspaceArena {
+  private:
+    std::unique_ptr<WorkspaceAllocator> allocator_;
+    void *buffer_{nullptr};
+    std::size_t capacity_{0};
+    std::size_t high_water_mark_{0};
+    std::size_t num_allocations_{0};
+
+  public:
+    /// Capacities are rounded up to a multiple of this many bytes.
+    static constexpr std::size_t alignment = 256;
+
+    /**
+     * @brief Construct a new arena.
+     *
+     * @param allocator Allocator providing the scratch buffer.
+     */
+    explicit WorkspaceArena(std::unique_ptr<WorkspaceAllocator> allocator)
+        : allocator_{std::move(allocator)} {
+        PL_ABORT_IF(allocator_ == nullptr, "Invalid workspace allocator.");
+    }
+
+    WorkspaceArena(const WorkspaceArena &) = delete;
+    WorkspaceArena(WorkspaceArena &&) = delete;
+    WorkspaceArena &operator=(const WorkspaceArena &) = delete;
+    WorkspaceArena &operator=(WorkspaceArena &&) = delete;
+    ~WorkspaceArena() { release(); }
+
+    /**
+     * @brief Get a scratch buffer of at least `bytes` bytes, growing the arena
+     * if needed.
+     *
+     * @param bytes Required workspace size in bytes.
+     * @return void* Pointer to the workspace, or `nullptr` if `bytes` is `0`.
+     */
+    auto acquire(std::size_t bytes) -> void * {
+        high_water_mark_ = std::max(high_water_mark_, bytes);
+        if (bytes == 0) {
+            return nullptr;
+        }
+        if (bytes > capacity_) {
+            release();
+            const std::size_t new_capacity =
+                (bytes + alignment - 1) / alignment * alignment;
+            buffer_ = allocator_->allocate(new_capacity);
+            capacity_ = new_capacity;
+            ++num_allocations_;
+        }
+        return buffer_;
+    }
+
+    /**
+     * @brief Free the scratch buffer. The statistics are preserved.
+     */
+    void release() {
+        if (buffer_ != nullptr) {
+            allocator_->deallocate(buffer_, capacity_);
+            buffer_ = nullptr;
+            capacity_ = 0;
+        }
+    }
+
+    /**
+     * @brief Replace the allocator, freeing the current scratch buffer.
+     *
+     * @param allocator New allocator.
+     */
+    void setAllocator(std::unique_ptr<WorkspaceAllocator> allocator) {
+        PL_ABORT_IF(allocator == nullptr, "Invalid workspace allocator.");
+        release();
+        allocator_ = std::move(allocator);
+    }
+
+    [[nodiscard]] auto getAllocator() const -> const WorkspaceAllocator & {
+        return *allocator_;
+    }
+
+    /**
+     * @brief Size in bytes of the current scratch buffer.
+     */
+    [[nodiscard]] auto getCapacity() const -> std::size_t { return capacity_; }
+
+    /**
+     * @brief Largest workspace size requested from the arena so far.
+     */
+    [[nodiscard]] auto getHighWaterMark() const -> std::size_t {
+        return high_water_mark_;
+    }
+
+    /**
+     * @brief Number of times the arena had to allocate a new buffer.
+     */
+    [[nodiscard]] auto getNumAllocations() const -> std::size_t {
+        return num_allocations_;
+    }
+};
+
+} // namespace Pennylane::CUDA::Util
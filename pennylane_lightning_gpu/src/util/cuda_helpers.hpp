@@ -439,6 +439,37 @@ class CublasCaller {
                                          std::forward<Args>(args)...));
     }
 
+    /**
+     * @brief Call a cuBLAS function returning its scalar result through a
+     * device pointer.
+     *
+     * Behaves as `call`, but switches the handle to
+     * `CUBLAS_POINTER_MODE_DEVICE` for the duration of the call. The result
+     * is then written asynchronously on `stream` and the host is not blocked
+     * until it is explicitly copied back.
+     *
+     * @param func the cuBLAS function to be called.
+     * @param dev_id the CUDA device id on which the function should be
+     * executed.
+     * @param stream the CUDA stream on which the cuBLAS function should be
+     * queued.
+     * @param args the arguments for the cuBLAS function.
+     */
+    template <typename F, typename... Args>
+    void callDeviceResult(F &&func, int dev_id, cudaStream_t stream,
+                          Args &&...args) const {
+        std::lock_guard lk(mtx);
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+        PL_CUBLAS_IS_SUCCESS(cublasSetStream(handle, stream));
+        PL_CUBLAS_IS_SUCCESS(
+            cublasSetPointerMode(handle, CUBLAS_POINTER_MODE_DEVICE));
+        const auto status = std::invoke(std::forward<F>(func), handle,
+                                        std::forward<Args>(args)...);
+        PL_CUBLAS_IS_SUCCESS(
+            cublasSetPointerMode(handle, CUBLAS_POINTER_MODE_HOST));
+        PL_CUBLAS_IS_SUCCESS(status);
+    }
+
   private:
     mutable std::mutex mtx;
     cublasHandle_t handle;
@@ -460,11 +491,11 @@ inline auto innerProdC_CUDA_device(const T *v1, const T *v2,
                                    const CublasCaller &cublas, T *d_result) {
 
     if constexpr (std::is_same_v<T, cuFloatComplex>) {
-        cublas.call(cublasCdotc, dev_id, stream_id, data_size, v1, 1, v2, 1,
-                    d_result);
+        cublas.callDeviceResult(cublasCdotc, dev_id, stream_id, data_size, v1,
+                                1, v2, 1, d_result);
     } else if constexpr (std::is_same_v<T, cuDoubleComplex>) {
-        cublas.call(cublasZdotc, dev_id, stream_id, data_size, v1, 1, v2, 1,
-                    d_result);
+        cublas.callDeviceResult(cublasZdotc, dev_id, stream_id, data_size, v1,
+                                1, v2, 1, d_result);
     }
 }
 
@@ -803,6 +834,15 @@ struct HandleDeleter {
     void operator()(cusparseHandle_t handle) const {
         PL_CUSPARSE_IS_SUCCESS(cusparseDestroy(handle));
     }
+    void operator()(cudaStream_t stream) const {
+        PL_CUDA_IS_SUCCESS(cudaStreamDestroy(stream));
+    }
+    void operator()(cudaEvent_t event) const {
+        PL_CUDA_IS_SUCCESS(cudaEventDestroy(event));
+    }
+    void operator()(custatevecSamplerDescriptor_t sampler) const {
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerDestroy(sampler));
+    }
 };
 
 using SharedCublasCaller = std::shared_ptr<CublasCaller>;
@@ -810,6 +850,9 @@ using SharedCusvHandle =
     std::shared_ptr<std::remove_pointer<custatevecHandle_t>::type>;
 using SharedCusparseHandle =
     std::shared_ptr<std::remove_pointer<cusparseHandle_t>::type>;
+using SharedCudaStream =
+    std::shared_ptr<std::remove_pointer<cudaStream_t>::type>;
+using SharedCudaEvent = std::shared_ptr<std::remove_pointer<cudaEvent_t>::type>;
 
 /**
  * @brief Creates a SharedCublasCaller (a shared pointer to a CublasCaller)
@@ -827,6 +870,19 @@ inline SharedCusvHandle make_shared_cusv_handle() {
     return {h, HandleDeleter()};
 }
 
+/**
+ * @brief Creates a SharedCusvHandle whose work is queued on the given stream.
+ *
+ * @param stream CUDA stream bound to the new handle.
+ */
+inline SharedCusvHandle make_shared_cusv_handle(cudaStream_t stream) {
+    custatevecHandle_t h;
+    PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(&h));
+    SharedCusvHandle handle{h, HandleDeleter()};
+    PL_CUSTATEVEC_IS_SUCCESS(custatevecSetStream(h, stream));
+    return handle;
+}
+
 /**
  * @brief Creates a SharedCusparseHandle (a shared pointer to a cusparseHandle)
  */
@@ -836,4 +892,26 @@ inline SharedCusparseHandle make_shared_cusparse_handle() {
     return {h, HandleDeleter()};
 }
 
+/**
+ * @brief Creates a SharedCudaStream (a shared pointer to a CUDA stream).
+ *
+ * The stream is a regular (blocking) stream, so work queued on the legacy
+ * default stream, such as synchronous copies, stays ordered with it.
+ */
+inline SharedCudaStream make_shared_cuda_stream() {
+    cudaStream_t s;
+    PL_CUDA_IS_SUCCESS(cudaStreamCreate(&s));
+    return {s, HandleDeleter()};
+}
+
+/**
+ * @brief Creates a SharedCudaEvent (a shared pointer to a CUDA event) used
+ * for ordering work between streams. Timing is disabled.
+ */
+inline SharedCudaEvent make_shared_cuda_event() {
+    cudaEvent_t e;
+    PL_CUDA_IS_SUCCESS(cudaEventCreateWithFlags(&e, cudaEventDisableTiming));
+    return {e, HandleDeleter()};
+}
+
 } // namespace Pennylane::CUDA::Util
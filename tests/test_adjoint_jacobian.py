@@ -32,8 +32,9 @@ from pennylane_lightning_gpu.lightning_gpu_qubit_ops import (
     HamiltonianGPU_C128,
     SparseHamiltonianGPU_C64,
     SparseHamiltonianGPU_C128,
+    op_stream_gate_names,
 )
-from pennylane_lightning_gpu._serialize import _serialize_ob
+from pennylane_lightning_gpu._serialize import _serialize_ob, _serialize_ops, _serialize_ops_flat
 
 try:
     from pennylane_lightning_gpu.lightning_gpu import CPP_BINARY_AVAILABLE
@@ -1170,3 +1171,40 @@ def test_obs_not_supported_for_adjoint_diff(bad_obs, use_csingle):
     """Tests observables that can't be serialized for adjoint-differentiation."""
     with pytest.raises(TypeError, match="Please use Pauli-words only."):
         _serialize_ob(bad_obs, dict(enumerate(bad_obs.wires)), use_csingle)
+
+
+@pytest.mark.parametrize("use_csingle", [True, False])
+def test_serialize_ops_flat(use_csingle):
+    """Tests that the flat op stream holds the same operations as the nested serialization."""
+    with qml.tape.QuantumTape() as tape:
+        qml.RX(0.4, wires=1)
+        qml.adjoint(qml.CRY(0.2, wires=[0, 2]))
+        qml.ISWAP(wires=[2, 1])
+        qml.Rot(0.1, 0.2, 0.3, wires=0)
+
+    wires_map = {i: i for i in range(3)}
+    (names, params, wires, inverses, mats), _ = _serialize_ops(tape, wires_map, use_csingle)
+    ops, uses_stateprep = _serialize_ops_flat(tape, wires_map, use_csingle)
+    (
+        extra_names,
+        codes,
+        wire_offsets,
+        flat_wires,
+        param_offsets,
+        flat_params,
+        flat_inverses,
+        mat_offsets,
+        flat_mats,
+    ) = ops
+
+    assert not uses_stateprep
+    assert extra_names == ["ISWAP"]
+    op_names = list(op_stream_gate_names()) + extra_names
+    assert [op_names[c] for c in codes] == names
+    for k in range(len(names)):
+        assert list(flat_wires[wire_offsets[k] : wire_offsets[k + 1]]) == wires[k]
+        assert np.allclose(flat_params[param_offsets[k] : param_offsets[k + 1]], params[k])
+        assert flat_inverses[k] == inverses[k]
+        assert np.allclose(flat_mats[mat_offsets[k] : mat_offsets[k + 1]], np.ravel(mats[k]))
+    assert flat_params.dtype == (np.float32 if use_csingle else np.float64)
+    assert flat_mats.dtype == (np.complex64 if use_csingle else np.complex128)
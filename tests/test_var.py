@@ -121,3 +121,49 @@ class TestTensorVar:
         ) / 4
 
         assert np.allclose(res, expected, tol)
+
+
+@pytest.mark.parametrize("theta, phi, varphi", list(zip(THETA, PHI, VARPHI)))
+class TestObservableVar:
+    """Tests for the single-call variance of Hermitian, Hamiltonian and sparse observables"""
+
+    def _circuit_var(self, dev_name, obs, theta, phi, varphi):
+        dev = qml.device(dev_name, wires=3)
+
+        @qml.qnode(dev)
+        def circuit():
+            qml.RX(theta, wires=[0])
+            qml.RY(phi, wires=[1])
+            qml.RX(varphi, wires=[2])
+            qml.CNOT(wires=[0, 1])
+            qml.CNOT(wires=[1, 2])
+            return qml.var(obs)
+
+        return circuit()
+
+    @pytest.mark.parametrize(
+        "obs",
+        [
+            qml.Hermitian(np.diag([1.0, -0.5, 2.0, 0.3]), wires=[2, 0]),
+            qml.Hermitian(np.array([[1.0, 0.5 - 0.2j], [0.5 + 0.2j, -0.7]]), wires=[1]),
+            qml.Hamiltonian(
+                [0.4, -1.1, 0.25],
+                [qml.PauliX(0) @ qml.PauliY(1), qml.PauliZ(2), qml.PauliX(0) @ qml.PauliZ(2)],
+            ),
+            qml.Hamiltonian([0.4, 0.9], [qml.PauliX(0), qml.Hadamard(1)]),
+            qml.PauliX(0) @ qml.Hermitian(np.diag([1.0, -0.5]), wires=[2]),
+        ],
+    )
+    def test_var(self, obs, theta, phi, varphi, tol):
+        """Test that the variance matches default.qubit"""
+        res = self._circuit_var("lightning.gpu", obs, theta, phi, varphi)
+        expected = self._circuit_var("default.qubit", obs, theta, phi, varphi)
+        assert np.allclose(res, expected, tol)
+
+    def test_sparse_hamiltonian(self, theta, phi, varphi, tol):
+        """Test that the variance of a sparse Hamiltonian matches default.qubit"""
+        H = qml.Hamiltonian([0.4, -1.1], [qml.PauliX(0) @ qml.PauliY(1), qml.PauliZ(2)])
+        obs = qml.SparseHamiltonian(H.sparse_matrix(wire_order=[0, 1, 2]), wires=[0, 1, 2])
+        res = self._circuit_var("lightning.gpu", obs, theta, phi, varphi)
+        expected = self._circuit_var("default.qubit", H, theta, phi, varphi)
+        assert np.allclose(res, expected, tol)